@@ -30,6 +30,7 @@
 #define CYCFG_CLOCKS_H
 
 #include "cycfg_notices.h"
+#include "cy_result.h"
 #include "cy_sysclk.h"
 #if defined (CY_USING_HAL)
 	#include "cyhal_hwmgr.h"
@@ -48,6 +49,8 @@ extern "C" {
 #endif //defined (CY_USING_HAL)
 
 void init_cycfg_clocks(void);
+#define CYCFG_CLOCKS_CAPSENSE_LAZY 1
+cy_rslt_t init_cycfg_clocks_capsense(void);
 
 #if defined(__cplusplus)
 }
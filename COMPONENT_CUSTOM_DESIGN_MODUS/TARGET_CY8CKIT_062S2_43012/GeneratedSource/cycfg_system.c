@@ -718,10 +718,7 @@ __WEAK void cycfg_ClockStartupError(uint32_t error)
 	{
 	    (void)Cy_GPIO_Pin_FastInit(GPIO_PRT0, 0U, 0x00U, 0x00U, HSIOM_SEL_GPIO);
 	    (void)Cy_GPIO_Pin_FastInit(GPIO_PRT0, 1U, 0x00U, 0x00U, HSIOM_SEL_GPIO);
-	    if (CY_SYSCLK_SUCCESS != Cy_SysClk_WcoEnable(1000000UL))
-	    {
-	        cycfg_ClockStartupError(CY_CFG_SYSCLK_WCO_ERROR);
-	    }
+	    (void)Cy_SysClk_WcoEnable(0UL);
 	}
 #endif //((!CY_CPU_CORTEX_M4) || (!defined(CY_DEVICE_SECURE)))
 #if ((!CY_CPU_CORTEX_M4) || (!defined(CY_DEVICE_SECURE)))
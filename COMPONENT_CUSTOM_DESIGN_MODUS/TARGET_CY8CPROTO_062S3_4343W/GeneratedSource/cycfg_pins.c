@@ -229,9 +229,28 @@ void init_cycfg_pins(void)
 #if defined (CY_USING_HAL)
 	cyhal_hwmgr_reserve(&SWCLK_obj);
 #endif //defined (CY_USING_HAL)
+}
 
-	Cy_GPIO_Pin_Init(CYBSP_CMOD_PORT, CYBSP_CMOD_PIN, &CYBSP_CMOD_config);
+cy_rslt_t init_cycfg_pins_capsense(void)
+{
 #if defined (CY_USING_HAL)
-	cyhal_hwmgr_reserve(&CYBSP_CMOD_obj);
+	static const cyhal_resource_inst_t *const resources[] =
+	{
+		&CYBSP_CMOD_obj,
+	};
+	for (uint32_t i = 0u; i < (sizeof(resources) / sizeof(resources[0])); i++)
+	{
+		cy_rslt_t result = cyhal_hwmgr_reserve(resources[i]);
+		if (CY_RSLT_SUCCESS != result)
+		{
+			while (i-- > 0u)
+			{
+				cyhal_hwmgr_free(resources[i]);
+			}
+			return result;
+		}
+	}
 #endif //defined (CY_USING_HAL)
+	Cy_GPIO_Pin_Init(CYBSP_CMOD_PORT, CYBSP_CMOD_PIN, &CYBSP_CMOD_config);
+	return CY_RSLT_SUCCESS;
 }
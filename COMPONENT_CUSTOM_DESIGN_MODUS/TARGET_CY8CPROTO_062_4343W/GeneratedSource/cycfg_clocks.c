@@ -40,10 +40,30 @@
 
 void init_cycfg_clocks(void)
 {
+}
+
+cy_rslt_t init_cycfg_clocks_capsense(void)
+{
+#if defined (CY_USING_HAL)
+	static const cyhal_resource_inst_t *const resources[] =
+	{
+		&CYBSP_CSD_CLK_DIV_obj,
+	};
+	for (uint32_t i = 0u; i < (sizeof(resources) / sizeof(resources[0])); i++)
+	{
+		cy_rslt_t result = cyhal_hwmgr_reserve(resources[i]);
+		if (CY_RSLT_SUCCESS != result)
+		{
+			while (i-- > 0u)
+			{
+				cyhal_hwmgr_free(resources[i]);
+			}
+			return result;
+		}
+	}
+#endif //defined (CY_USING_HAL)
 	Cy_SysClk_PeriphDisableDivider(CY_SYSCLK_DIV_8_BIT, 0U);
 	Cy_SysClk_PeriphSetDivider(CY_SYSCLK_DIV_8_BIT, 0U, 255U);
 	Cy_SysClk_PeriphEnableDivider(CY_SYSCLK_DIV_8_BIT, 0U);
-#if defined (CY_USING_HAL)
-	cyhal_hwmgr_reserve(&CYBSP_CSD_CLK_DIV_obj);
-#endif //defined (CY_USING_HAL)
+	return CY_RSLT_SUCCESS;
 }
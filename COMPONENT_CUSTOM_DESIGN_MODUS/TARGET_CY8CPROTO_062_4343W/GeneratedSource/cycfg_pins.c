@@ -455,16 +455,6 @@ void init_cycfg_pins(void)
 	cyhal_hwmgr_reserve(&CYBSP_WIFI_HOST_WAKE_obj);
 #endif //defined (CY_USING_HAL)
 
-	Cy_GPIO_Pin_Init(CYBSP_CSD_TX_PORT, CYBSP_CSD_TX_PIN, &CYBSP_CSD_TX_config);
-#if defined (CY_USING_HAL)
-	cyhal_hwmgr_reserve(&CYBSP_CSD_TX_obj);
-#endif //defined (CY_USING_HAL)
-
-	Cy_GPIO_Pin_Init(CYBSP_SWO_PORT, CYBSP_SWO_PIN, &CYBSP_SWO_config);
-#if defined (CY_USING_HAL)
-	cyhal_hwmgr_reserve(&CYBSP_SWO_obj);
-#endif //defined (CY_USING_HAL)
-
 	Cy_GPIO_Pin_Init(CYBSP_SWDIO_PORT, CYBSP_SWDIO_PIN, &CYBSP_SWDIO_config);
 #if defined (CY_USING_HAL)
 	cyhal_hwmgr_reserve(&CYBSP_SWDIO_obj);
@@ -474,54 +464,82 @@ void init_cycfg_pins(void)
 #if defined (CY_USING_HAL)
 	cyhal_hwmgr_reserve(&CYBSP_SWDCK_obj);
 #endif //defined (CY_USING_HAL)
+}
 
-	Cy_GPIO_Pin_Init(CYBSP_CINA_PORT, CYBSP_CINA_PIN, &CYBSP_CINA_config);
+cy_rslt_t init_cycfg_pins_capsense(void)
+{
 #if defined (CY_USING_HAL)
-	cyhal_hwmgr_reserve(&CYBSP_CINA_obj);
+	static const cyhal_resource_inst_t *const resources[] =
+	{
+		&CYBSP_CSD_TX_obj,
+		&CYBSP_CINA_obj,
+		&CYBSP_CINB_obj,
+		&CYBSP_CMOD_obj,
+		&CYBSP_CSD_BTN0_obj,
+		&CYBSP_CSD_BTN1_obj,
+		&CYBSP_CSD_SLD0_obj,
+		&CYBSP_CSD_SLD1_obj,
+		&CYBSP_CSD_SLD2_obj,
+		&CYBSP_CSD_SLD3_obj,
+		&CYBSP_CSD_SLD4_obj,
+	};
+	for (uint32_t i = 0u; i < (sizeof(resources) / sizeof(resources[0])); i++)
+	{
+		cy_rslt_t result = cyhal_hwmgr_reserve(resources[i]);
+		if (CY_RSLT_SUCCESS != result)
+		{
+			while (i-- > 0u)
+			{
+				cyhal_hwmgr_free(resources[i]);
+			}
+			return result;
+		}
+	}
 #endif //defined (CY_USING_HAL)
+	Cy_GPIO_Pin_Init(CYBSP_CSD_TX_PORT, CYBSP_CSD_TX_PIN, &CYBSP_CSD_TX_config);
+
+	Cy_GPIO_Pin_Init(CYBSP_CINA_PORT, CYBSP_CINA_PIN, &CYBSP_CINA_config);
 
 	Cy_GPIO_Pin_Init(CYBSP_CINB_PORT, CYBSP_CINB_PIN, &CYBSP_CINB_config);
-#if defined (CY_USING_HAL)
-	cyhal_hwmgr_reserve(&CYBSP_CINB_obj);
-#endif //defined (CY_USING_HAL)
 
 	Cy_GPIO_Pin_Init(CYBSP_CMOD_PORT, CYBSP_CMOD_PIN, &CYBSP_CMOD_config);
-#if defined (CY_USING_HAL)
-	cyhal_hwmgr_reserve(&CYBSP_CMOD_obj);
-#endif //defined (CY_USING_HAL)
 
 	Cy_GPIO_Pin_Init(CYBSP_CSD_BTN0_PORT, CYBSP_CSD_BTN0_PIN, &CYBSP_CSD_BTN0_config);
-#if defined (CY_USING_HAL)
-	cyhal_hwmgr_reserve(&CYBSP_CSD_BTN0_obj);
-#endif //defined (CY_USING_HAL)
 
 	Cy_GPIO_Pin_Init(CYBSP_CSD_BTN1_PORT, CYBSP_CSD_BTN1_PIN, &CYBSP_CSD_BTN1_config);
-#if defined (CY_USING_HAL)
-	cyhal_hwmgr_reserve(&CYBSP_CSD_BTN1_obj);
-#endif //defined (CY_USING_HAL)
 
 	Cy_GPIO_Pin_Init(CYBSP_CSD_SLD0_PORT, CYBSP_CSD_SLD0_PIN, &CYBSP_CSD_SLD0_config);
-#if defined (CY_USING_HAL)
-	cyhal_hwmgr_reserve(&CYBSP_CSD_SLD0_obj);
-#endif //defined (CY_USING_HAL)
 
 	Cy_GPIO_Pin_Init(CYBSP_CSD_SLD1_PORT, CYBSP_CSD_SLD1_PIN, &CYBSP_CSD_SLD1_config);
-#if defined (CY_USING_HAL)
-	cyhal_hwmgr_reserve(&CYBSP_CSD_SLD1_obj);
-#endif //defined (CY_USING_HAL)
 
 	Cy_GPIO_Pin_Init(CYBSP_CSD_SLD2_PORT, CYBSP_CSD_SLD2_PIN, &CYBSP_CSD_SLD2_config);
-#if defined (CY_USING_HAL)
-	cyhal_hwmgr_reserve(&CYBSP_CSD_SLD2_obj);
-#endif //defined (CY_USING_HAL)
 
 	Cy_GPIO_Pin_Init(CYBSP_CSD_SLD3_PORT, CYBSP_CSD_SLD3_PIN, &CYBSP_CSD_SLD3_config);
-#if defined (CY_USING_HAL)
-	cyhal_hwmgr_reserve(&CYBSP_CSD_SLD3_obj);
-#endif //defined (CY_USING_HAL)
 
 	Cy_GPIO_Pin_Init(CYBSP_CSD_SLD4_PORT, CYBSP_CSD_SLD4_PIN, &CYBSP_CSD_SLD4_config);
+	return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t init_cycfg_pins_swo(void)
+{
 #if defined (CY_USING_HAL)
-	cyhal_hwmgr_reserve(&CYBSP_CSD_SLD4_obj);
+	static const cyhal_resource_inst_t *const resources[] =
+	{
+		&CYBSP_SWO_obj,
+	};
+	for (uint32_t i = 0u; i < (sizeof(resources) / sizeof(resources[0])); i++)
+	{
+		cy_rslt_t result = cyhal_hwmgr_reserve(resources[i]);
+		if (CY_RSLT_SUCCESS != result)
+		{
+			while (i-- > 0u)
+			{
+				cyhal_hwmgr_free(resources[i]);
+			}
+			return result;
+		}
+	}
 #endif //defined (CY_USING_HAL)
+	Cy_GPIO_Pin_Init(CYBSP_SWO_PORT, CYBSP_SWO_PIN, &CYBSP_SWO_config);
+	return CY_RSLT_SUCCESS;
 }
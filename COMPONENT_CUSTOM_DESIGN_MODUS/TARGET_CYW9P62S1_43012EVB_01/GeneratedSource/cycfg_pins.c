@@ -263,11 +263,6 @@ void init_cycfg_pins(void)
 	cyhal_hwmgr_reserve(&CYBSP_WIFI_HOST_WAKE_obj);
 #endif //defined (CY_USING_HAL)
 
-	Cy_GPIO_Pin_Init(CYBSP_SWO_PORT, CYBSP_SWO_PIN, &CYBSP_SWO_config);
-#if defined (CY_USING_HAL)
-	cyhal_hwmgr_reserve(&CYBSP_SWO_obj);
-#endif //defined (CY_USING_HAL)
-
 	Cy_GPIO_Pin_Init(CYBSP_SWDIO_PORT, CYBSP_SWDIO_PIN, &CYBSP_SWDIO_config);
 #if defined (CY_USING_HAL)
 	cyhal_hwmgr_reserve(&CYBSP_SWDIO_obj);
@@ -277,19 +272,58 @@ void init_cycfg_pins(void)
 #if defined (CY_USING_HAL)
 	cyhal_hwmgr_reserve(&CYBSP_SWDCK_obj);
 #endif //defined (CY_USING_HAL)
+}
 
-	Cy_GPIO_Pin_Init(CYBSP_CINA_PORT, CYBSP_CINA_PIN, &CYBSP_CINA_config);
+cy_rslt_t init_cycfg_pins_capsense(void)
+{
 #if defined (CY_USING_HAL)
-	cyhal_hwmgr_reserve(&CYBSP_CINA_obj);
+	static const cyhal_resource_inst_t *const resources[] =
+	{
+		&CYBSP_CINA_obj,
+		&CYBSP_CINB_obj,
+		&CYBSP_CMOD_obj,
+	};
+	for (uint32_t i = 0u; i < (sizeof(resources) / sizeof(resources[0])); i++)
+	{
+		cy_rslt_t result = cyhal_hwmgr_reserve(resources[i]);
+		if (CY_RSLT_SUCCESS != result)
+		{
+			while (i-- > 0u)
+			{
+				cyhal_hwmgr_free(resources[i]);
+			}
+			return result;
+		}
+	}
 #endif //defined (CY_USING_HAL)
+	Cy_GPIO_Pin_Init(CYBSP_CINA_PORT, CYBSP_CINA_PIN, &CYBSP_CINA_config);
 
 	Cy_GPIO_Pin_Init(CYBSP_CINB_PORT, CYBSP_CINB_PIN, &CYBSP_CINB_config);
-#if defined (CY_USING_HAL)
-	cyhal_hwmgr_reserve(&CYBSP_CINB_obj);
-#endif //defined (CY_USING_HAL)
 
 	Cy_GPIO_Pin_Init(CYBSP_CMOD_PORT, CYBSP_CMOD_PIN, &CYBSP_CMOD_config);
+	return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t init_cycfg_pins_swo(void)
+{
 #if defined (CY_USING_HAL)
-	cyhal_hwmgr_reserve(&CYBSP_CMOD_obj);
+	static const cyhal_resource_inst_t *const resources[] =
+	{
+		&CYBSP_SWO_obj,
+	};
+	for (uint32_t i = 0u; i < (sizeof(resources) / sizeof(resources[0])); i++)
+	{
+		cy_rslt_t result = cyhal_hwmgr_reserve(resources[i]);
+		if (CY_RSLT_SUCCESS != result)
+		{
+			while (i-- > 0u)
+			{
+				cyhal_hwmgr_free(resources[i]);
+			}
+			return result;
+		}
+	}
 #endif //defined (CY_USING_HAL)
+	Cy_GPIO_Pin_Init(CYBSP_SWO_PORT, CYBSP_SWO_PIN, &CYBSP_SWO_config);
+	return CY_RSLT_SUCCESS;
 }
@@ -30,6 +30,7 @@
 #define CYCFG_PINS_H
 
 #include "cycfg_notices.h"
+#include "cy_result.h"
 #include "cy_gpio.h"
 #if defined (CY_USING_HAL)
 	#include "cyhal_hwmgr.h"
@@ -374,6 +375,10 @@ extern const cy_stc_gpio_pin_config_t CYBSP_CMOD_config;
 #endif //defined (CY_USING_HAL)
 
 void init_cycfg_pins(void);
+#define CYCFG_PINS_CAPSENSE_LAZY 1
+cy_rslt_t init_cycfg_pins_capsense(void);
+#define CYCFG_PINS_SWO_LAZY 1
+cy_rslt_t init_cycfg_pins_swo(void);
 
 #if defined(__cplusplus)
 }
@@ -0,0 +1,130 @@
+/******************************************************************************
+ * File Name: test_app_log.cpp
+ *
+ * Description:
+ *   Unit tests of the deferred log ring of source/app_log.cpp. Producer
+ *   threads write records without locks while another thread drains the ring,
+ *   the '#L:' lines printed to a temporary file must hold every record which
+ *   was not counted as dropped, complete and in the order of its producer.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <unistd.h>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "app_log.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#define TEST_PRODUCERS             (4U)
+#define TEST_RECORDS               (20000U)
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+TEST(TestAppLog, ConcurrentProducersAndDrain)
+{
+    std::vector<std::thread> producers;
+    std::atomic<bool> go{false};
+    std::atomic<uint32_t> running{TEST_PRODUCERS};
+    uint32_t next[TEST_PRODUCERS] = { 0 };
+    uint32_t printed = 0;
+    unsigned long id;
+    unsigned long seq;
+    unsigned long check;
+    char line[128];
+    FILE *out = tmpfile();
+    int saved_stdout;
+
+    ASSERT_NE((FILE *)NULL, out);
+    fflush(stdout);
+    saved_stdout = dup(STDOUT_FILENO);
+    ASSERT_LE(0, dup2(fileno(out), STDOUT_FILENO));
+
+    for (uint32_t p = 0; p < TEST_PRODUCERS; p++)
+    {
+        producers.emplace_back([p, &go, &running] {
+            while (!go)
+            {
+            }
+            for (uint32_t i = 0; i < TEST_RECORDS; i++)
+            {
+                uint32_t args[2] = { i, ~i };
+                app_log_write(p, args, 2U, 0U);
+            }
+            running--;
+        });
+    }
+    go = true;
+    while (0U != running)
+    {
+        app_log_flush();
+    }
+    for (std::thread &producer : producers)
+    {
+        producer.join();
+    }
+    app_log_flush();
+
+    fflush(stdout);
+    ASSERT_LE(0, dup2(saved_stdout, STDOUT_FILENO));
+    close(saved_stdout);
+
+    rewind(out);
+    while (NULL != fgets(line, sizeof(line), out))
+    {
+        if (0 != strncmp(line, "#L:", 3))
+        {
+            continue;
+        }
+        ASSERT_EQ(3, sscanf(line, "#L:%08lx:%08lx:%08lx", &id, &seq, &check)) << line;
+        ASSERT_LT(id, TEST_PRODUCERS) << line;
+        /* Complete, and after the previous record of the producer. */
+        ASSERT_EQ(0xFFFFFFFFUL, seq ^ check) << line;
+        ASSERT_LE(next[id], seq) << line;
+        next[id] = seq + 1UL;
+        printed++;
+    }
+    fclose(out);
+
+    EXPECT_LT(0U, printed);
+    EXPECT_EQ(TEST_PRODUCERS * TEST_RECORDS, printed + app_log_get_dropped());
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,16 @@
+# Deferred log ring with several producers and a concurrent drain, printed
+# as '#L:' lines.
+
+set(unittest-sources
+    ${APP_SOURCE}/app_log.cpp
+    ${APP_STUBS}/mbed_stub.cpp
+)
+
+set(unittest-test-sources
+    app_log/test_app_log.cpp
+)
+
+set(unittest-definitions
+    MBED_CONF_APP_LOG_DEFERRED=1
+    MBED_CONF_APP_LOG_BINARY_OUTPUT=1
+)
@@ -0,0 +1,160 @@
+/******************************************************************************
+ * File Name: test_app_mcast.cpp
+ *
+ * Description:
+ *   Unit tests of the all-multicast switch of source/app_mcast.cpp, counting
+ *   the get and set IOCTLs of each suspend and resume.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include <string.h>
+#include "gtest/gtest.h"
+#include "app_mcast.h"
+#include "app_olm.h"
+#include "whd_emac.h"
+#include "whd_wifi_api.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#define TEST_CYCLES                (5U)
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+static app_olm_hook_t test_hook = NULL;
+static char test_ifp;
+
+/* Mode of the WLAN and the IOCTLs received. */
+static uint32_t test_allmulti;
+static whd_result_t test_get_result;
+static uint32_t test_gets;
+static uint32_t test_sets;
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/* The offload manager, the EMAC and the IOCTLs of the WLAN host driver. */
+cy_rslt_t app_olm_add_hook(app_olm_hook_t hook)
+{
+    test_hook = hook;
+    return CY_RSLT_SUCCESS;
+}
+
+WHD_EMAC &WHD_EMAC::get_instance()
+{
+    static WHD_EMAC emac;
+    return emac;
+}
+
+extern "C" whd_result_t whd_wifi_get_iovar_value(whd_interface_t ifp, const char *iovar,
+                                                 uint32_t *value)
+{
+    EXPECT_EQ((whd_interface_t)&test_ifp, ifp);
+    EXPECT_STREQ("allmulti", iovar);
+    test_gets++;
+    *value = test_allmulti;
+    return test_get_result;
+}
+
+extern "C" whd_result_t whd_wifi_set_iovar_value(whd_interface_t ifp, const char *iovar,
+                                                 uint32_t value)
+{
+    EXPECT_EQ((whd_interface_t)&test_ifp, ifp);
+    EXPECT_STREQ("allmulti", iovar);
+    test_sets++;
+    test_allmulti = value;
+    return WHD_SUCCESS;
+}
+
+/* Cycles with the mode off, in a child process: the hook keeps the mode
+ * read on the first suspend for the rest of the process.
+ */
+static void test_mode_off(void)
+{
+    test_allmulti = 0U;
+    test_get_result = WHD_SUCCESS;
+    for (uint32_t i = 0; i < TEST_CYCLES; i++)
+    {
+        test_hook(true);
+        test_hook(false);
+    }
+    exit(((1U == test_gets) && (0U == test_sets)) ? 0 : 1);
+}
+
+class TestAppMcast : public testing::Test
+{
+protected:
+    void SetUp()
+    {
+        WHD_EMAC::get_instance().ifp = (whd_interface_t)&test_ifp;
+        if (NULL == test_hook)
+        {
+            ASSERT_EQ(CY_RSLT_SUCCESS, app_mcast_init());
+        }
+        ASSERT_NE((app_olm_hook_t)NULL, test_hook);
+    }
+};
+
+TEST_F(TestAppMcast, NoTransactionWhenOff)
+{
+    EXPECT_EXIT(test_mode_off(), testing::ExitedWithCode(0), "");
+}
+
+TEST_F(TestAppMcast, OneSetPerTransition)
+{
+    /* A failed read leaves the mode alone and is retried. */
+    test_allmulti = 1U;
+    test_get_result = 1U;
+    test_hook(true);
+    test_hook(false);
+    EXPECT_EQ(1U, test_gets);
+    EXPECT_EQ(0U, test_sets);
+    EXPECT_EQ(1U, test_allmulti);
+
+    test_get_result = WHD_SUCCESS;
+    for (uint32_t i = 0; i < TEST_CYCLES; i++)
+    {
+        test_hook(true);
+        EXPECT_EQ(0U, test_allmulti);
+        test_hook(false);
+        EXPECT_EQ(1U, test_allmulti);
+    }
+    EXPECT_EQ(2U, test_gets);
+    EXPECT_EQ(2U * TEST_CYCLES, test_sets);
+}
+
+
+/* [] END OF FILE */
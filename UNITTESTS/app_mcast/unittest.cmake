@@ -0,0 +1,11 @@
+# All-multicast mode of the WLAN over suspend and resume cycles, counting
+# the IOCTLs of each transition.
+
+set(unittest-sources
+    ${APP_SOURCE}/app_mcast.cpp
+    ${APP_STUBS}/mbed_stub.cpp
+)
+
+set(unittest-test-sources
+    app_mcast/test_app_mcast.cpp
+)
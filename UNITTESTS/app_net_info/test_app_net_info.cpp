@@ -0,0 +1,192 @@
+/******************************************************************************
+ * File Name: test_app_net_info.cpp
+ *
+ * Description:
+ *   Host unit tests and micro-benchmark of the network-info snapshot of
+ *   source/app_net_info.cpp. The simulated interface delays each query like an
+ *   IOCTL to the WLAN, the benchmark compares the cost of the snapshot with the
+ *   five separate queries it replaces.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "gtest/gtest.h"
+#include "app_net_info.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+/* Simulated duration of one IOCTL round trip to the WLAN. */
+#define TEST_QUERY_DELAY_MS        (2)
+
+/* Snapshots per benchmark run, 100 ms apart. */
+#define TEST_BENCH_CALLS           (50)
+#define TEST_BENCH_PERIOD_MS       (100)
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+static uint32_t test_queries(const whd_sta_sim_calls_t *calls)
+{
+    return calls->get_mac_address + calls->get_netmask + calls->get_gateway +
+           calls->get_ip_address + calls->get_rssi;
+}
+
+class TestAppNetInfo : public testing::Test
+{
+protected:
+    void SetUp()
+    {
+        app_net_info_attach(&wifi);
+        app_net_info_invalidate();
+    }
+
+    WhdSTAInterface wifi;
+    app_net_info_t info;
+};
+
+TEST_F(TestAppNetInfo, first_snapshot_queries_all_parameters)
+{
+    ASSERT_EQ(CY_RSLT_SUCCESS, app_net_info_get(&wifi, &info));
+
+    EXPECT_STREQ(wifi.sim_mac, info.mac);
+    EXPECT_STREQ(wifi.sim_ip, info.ip.get_ip_address());
+    EXPECT_STREQ(wifi.sim_netmask, info.netmask.get_ip_address());
+    EXPECT_STREQ(wifi.sim_gateway, info.gateway.get_ip_address());
+    EXPECT_EQ(wifi.sim_rssi, info.rssi);
+    EXPECT_EQ(5U, test_queries(&wifi.sim_calls));
+}
+
+TEST_F(TestAppNetInfo, stable_parameters_are_cached)
+{
+    ASSERT_EQ(CY_RSLT_SUCCESS, app_net_info_get(&wifi, &info));
+    ASSERT_EQ(CY_RSLT_SUCCESS, app_net_info_get(&wifi, &info));
+
+    EXPECT_EQ(1U, wifi.sim_calls.get_mac_address);
+    EXPECT_EQ(1U, wifi.sim_calls.get_ip_address);
+    EXPECT_EQ(1U, wifi.sim_calls.get_rssi);
+}
+
+TEST_F(TestAppNetInfo, rssi_is_queried_again_after_the_maximum_age)
+{
+    ASSERT_EQ(CY_RSLT_SUCCESS, app_net_info_get(&wifi, &info));
+
+    wifi.sim_rssi = -70;
+    mbed_host_clock_advance_ms(MBED_CONF_APP_NET_INFO_RSSI_MAX_AGE_MS - 100);
+    ASSERT_EQ(CY_RSLT_SUCCESS, app_net_info_get(&wifi, &info));
+    EXPECT_EQ(-48, info.rssi);
+
+    mbed_host_clock_advance_ms(100);
+    ASSERT_EQ(CY_RSLT_SUCCESS, app_net_info_get(&wifi, &info));
+    EXPECT_EQ(-70, info.rssi);
+    EXPECT_EQ(2U, wifi.sim_calls.get_rssi);
+    EXPECT_EQ(1U, wifi.sim_calls.get_ip_address);
+}
+
+TEST_F(TestAppNetInfo, link_event_invalidates_the_snapshot)
+{
+    ASSERT_EQ(CY_RSLT_SUCCESS, app_net_info_get(&wifi, &info));
+
+    wifi.sim_ip = "10.0.0.7";
+    wifi.sim_set_link_event(NSAPI_STATUS_GLOBAL_UP);
+    ASSERT_EQ(CY_RSLT_SUCCESS, app_net_info_get(&wifi, &info));
+
+    EXPECT_STREQ("10.0.0.7", info.ip.get_ip_address());
+    EXPECT_EQ(10U, test_queries(&wifi.sim_calls));
+}
+
+TEST_F(TestAppNetInfo, snapshot_without_address_is_not_cached)
+{
+    wifi.sim_ip_result = NSAPI_ERROR_NO_ADDRESS;
+    EXPECT_EQ(CY_RSLT_TYPE_ERROR, app_net_info_get(&wifi, &info));
+
+    wifi.sim_ip_result = NSAPI_ERROR_OK;
+    EXPECT_EQ(CY_RSLT_SUCCESS, app_net_info_get(&wifi, &info));
+    EXPECT_EQ(2U, wifi.sim_calls.get_ip_address);
+}
+
+/* Snapshots at a 100 ms period against the five queries of the previous
+ * connect path, which every caller repeated.
+ */
+TEST_F(TestAppNetInfo, benchmark_query_cost)
+{
+    SocketAddress address;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::microseconds direct_us;
+    std::chrono::microseconds snapshot_us;
+    uint32_t direct_queries;
+    uint32_t snapshot_queries;
+
+    wifi.sim_query_delay_ms = TEST_QUERY_DELAY_MS;
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < TEST_BENCH_CALLS; i++)
+    {
+        (void)wifi.get_mac_address();
+        (void)wifi.get_netmask(&address);
+        (void)wifi.get_gateway(&address);
+        (void)wifi.get_rssi();
+        (void)wifi.get_ip_address(&address);
+    }
+    direct_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start);
+    direct_queries = test_queries(&wifi.sim_calls);
+
+    wifi.sim_calls = whd_sta_sim_calls_t();
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < TEST_BENCH_CALLS; i++)
+    {
+        ASSERT_EQ(CY_RSLT_SUCCESS, app_net_info_get(&wifi, &info));
+        mbed_host_clock_advance_ms(TEST_BENCH_PERIOD_MS);
+    }
+    snapshot_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                      std::chrono::steady_clock::now() - start);
+    snapshot_queries = test_queries(&wifi.sim_calls);
+
+    printf("%u calls, %u ms per query: direct %u queries %lu us, "
+           "snapshot %u queries %lu us\n",
+           TEST_BENCH_CALLS, TEST_QUERY_DELAY_MS,
+           direct_queries, (unsigned long)direct_us.count(),
+           snapshot_queries, (unsigned long)snapshot_us.count());
+
+    /* Four stable queries once, then the RSSI once per maximum age. */
+    EXPECT_EQ(5U * TEST_BENCH_CALLS, direct_queries);
+    EXPECT_EQ(4U + ((TEST_BENCH_CALLS * TEST_BENCH_PERIOD_MS) /
+                    MBED_CONF_APP_NET_INFO_RSSI_MAX_AGE_MS),
+              snapshot_queries);
+    EXPECT_LT(snapshot_us * 10, direct_us);
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,11 @@
+# Network-info snapshot and its query cost on the simulated WLAN interface.
+
+set(unittest-sources
+    ${APP_SOURCE}/app_net_info.cpp
+    ${APP_STUBS}/mbed_stub.cpp
+    ${APP_STUBS}/WhdSTAInterface_stub.cpp
+)
+
+set(unittest-test-sources
+    app_net_info/test_app_net_info.cpp
+)
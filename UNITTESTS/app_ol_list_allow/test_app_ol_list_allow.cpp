@@ -0,0 +1,141 @@
+/******************************************************************************
+ * File Name: test_app_ol_list_allow.cpp
+ *
+ * Description:
+ *   Unit tests of the allowlist policy of app_ol_list on the simulated WLAN,
+ *   with the local port 5000 and the remote port 8883 kept.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "gtest/gtest.h"
+#include "app_ol_list.h"
+#include "app_olm.h"
+#include "lpa_sim.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#define TEST_HOST_IP               "192.168.1.10"
+#define TEST_PEER_IP               "192.168.1.20"
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+static lpa_sim_dest_t test_udp(uint16_t sport, uint16_t dport)
+{
+    lpa_sim_frame_t frame = lpa_sim_udp(sport, dport);
+
+    return lpa_sim_rx(&frame).dest;
+}
+
+static lpa_sim_dest_t test_eth(uint16_t eth_type)
+{
+    lpa_sim_frame_t frame = {};
+
+    frame.eth_type = eth_type;
+    return lpa_sim_rx(&frame).dest;
+}
+
+class TestAppOlListAllow : public testing::Test
+{
+protected:
+    void SetUp()
+    {
+        lpa_sim_reset(TEST_HOST_IP);
+        ASSERT_EQ(0, olm.init_ols(&whd, &ip));
+    }
+
+    void TearDown()
+    {
+        if (lpa_sim_host_suspended())
+        {
+            olm.wake();
+        }
+    }
+
+    AppOlmInterface &olm = AppOlmInterface::get_instance();
+    int whd = 0;
+    int ip = 0;
+};
+
+/* ARP, EAPOL, DHCP client, DNS responses and the two ports, nothing else. */
+TEST_F(TestAppOlListAllow, list_holds_the_keep_filters_only)
+{
+    ol_desc_t *list = app_ol_list_get();
+
+    ASSERT_NE(nullptr, list);
+    const cy_pf_ol_cfg_t *filter = (const cy_pf_ol_cfg_t *)list[0].cfg;
+    uint8_t count = 0;
+
+    for (; CY_PF_OL_FEAT_LAST != filter->feature; filter++, count++)
+    {
+        EXPECT_EQ(0U, filter->bits & CY_PF_ACTION_DISCARD);
+        EXPECT_EQ((uint32_t)APP_PF_PROFILE_SLEEP, filter->bits);
+    }
+    EXPECT_EQ(6U, count);
+}
+
+TEST_F(TestAppOlListAllow, only_kept_traffic_reaches_the_suspended_host)
+{
+    lpa_sim_frame_t arp = lpa_sim_arp_request(TEST_PEER_IP, TEST_HOST_IP);
+    lpa_sim_frame_t icmp = {};
+
+    icmp.eth_type = LPA_SIM_ETH_TYPE_IPV4;
+    icmp.ip_proto = LPA_SIM_IP_PROTO_ICMP;
+
+    olm.sleep();
+
+    EXPECT_EQ(LPA_SIM_HOST, lpa_sim_rx(&arp).dest);
+    EXPECT_EQ(LPA_SIM_HOST, test_eth(LPA_SIM_ETH_TYPE_EAPOL));
+    EXPECT_EQ(LPA_SIM_HOST, test_udp(67, 68));
+    EXPECT_EQ(LPA_SIM_HOST, test_udp(53, 40000));
+    EXPECT_EQ(LPA_SIM_HOST, test_udp(40000, 5000));
+    EXPECT_EQ(LPA_SIM_HOST, test_udp(8883, 40000));
+
+    EXPECT_EQ(LPA_SIM_DROPPED, lpa_sim_rx(&icmp).dest);
+    EXPECT_EQ(LPA_SIM_DROPPED, test_udp(40000, 1900));
+    EXPECT_EQ(LPA_SIM_DROPPED, test_udp(40000, 53));
+    EXPECT_EQ(LPA_SIM_DROPPED, test_udp(5000, 40000));
+}
+
+/* The keep filters belong to the sleep profile only. */
+TEST_F(TestAppOlListAllow, awake_host_receives_all_traffic)
+{
+    EXPECT_EQ(LPA_SIM_HOST, test_udp(40000, 1900));
+    EXPECT_EQ(LPA_SIM_HOST, test_udp(40000, 5000));
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,21 @@
+# Allowlist filter policy on the simulated WLAN: only the kept traffic
+# reaches the suspended host.
+
+set(unittest-sources
+    ${APP_SOURCE}/app_ol_list.cpp
+    ${APP_SOURCE}/app_olm.cpp
+    ${APP_STUBS}/mbed_stub.cpp
+    ${APP_STUBS}/app_log_stub.cpp
+    ${APP_STUBS}/lpa_sim_stub.cpp
+    ${APP_STUBS}/cycfg_connectivity_wifi_stub.cpp
+)
+
+set(unittest-test-sources
+    app_ol_list_allow/test_app_ol_list_allow.cpp
+)
+
+set(unittest-definitions
+    MBED_CONF_APP_PF_POLICY=APP_PF_POLICY_ALLOW
+    "MBED_CONF_APP_PF_KEEP_LOCAL_PORTS={5000}"
+    "MBED_CONF_APP_PF_KEEP_REMOTE_PORTS={8883}"
+)
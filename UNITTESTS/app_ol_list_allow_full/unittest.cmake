@@ -0,0 +1,20 @@
+# Allowlist filter policy with more keep filters than APP_OL_PF_MAX: 4 for
+# ARP, EAPOL, DHCP and DNS and 5 application ports.
+
+set(unittest-sources
+    ${APP_SOURCE}/app_ol_list.cpp
+    ${APP_SOURCE}/app_olm.cpp
+    ${APP_STUBS}/mbed_stub.cpp
+    ${APP_STUBS}/app_log_stub.cpp
+    ${APP_STUBS}/lpa_sim_stub.cpp
+    ${APP_STUBS}/cycfg_connectivity_wifi_stub.cpp
+)
+
+set(unittest-test-sources
+    app_ol_list_allow_full/test_app_ol_list_allow_full.cpp
+)
+
+set(unittest-definitions
+    MBED_CONF_APP_PF_POLICY=APP_PF_POLICY_ALLOW
+    "MBED_CONF_APP_PF_KEEP_LOCAL_PORTS={5000,5001,5002,5003,5004}"
+)
@@ -0,0 +1,189 @@
+/******************************************************************************
+ * File Name: test_app_ol_list_arp.cpp
+ *
+ * Description:
+ *   Unit tests of the ARP offload of app_ol_list on the simulated WLAN.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "gtest/gtest.h"
+#include "app_ol_list.h"
+#include "app_olm.h"
+#include "cy_lpa_wifi_arp_ol.h"
+#include "lpa_sim.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#define TEST_HOST_IP               "192.168.1.10"
+#define TEST_PEER_IP               "192.168.1.20"
+#define TEST_OTHER_IP              "192.168.1.30"
+
+/* ARP requests of the latency measurement, one per suspend. */
+#define TEST_ARP_REQUESTS          (20)
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/* Sends one ARP request for the host address per suspend and returns the
+ * summed reply latency.
+ */
+static uint32_t test_arp_latency_ms(CyOlmInterface &olm)
+{
+    lpa_sim_frame_t request = lpa_sim_arp_request(TEST_PEER_IP, TEST_HOST_IP);
+    uint32_t total_ms = 0;
+
+    for (uint32_t i = 0; i < TEST_ARP_REQUESTS; i++)
+    {
+        olm.sleep();
+        lpa_sim_rx_t rx = lpa_sim_rx(&request);
+        EXPECT_NE(LPA_SIM_DROPPED, rx.dest);
+        total_ms += rx.reply_ms;
+        olm.wake();
+    }
+
+    return total_ms;
+}
+
+class TestAppOlListArp : public testing::Test
+{
+protected:
+    void SetUp()
+    {
+        lpa_sim_reset(TEST_HOST_IP);
+        ASSERT_EQ(0, olm.init_ols(&whd, &ip));
+    }
+
+    void TearDown()
+    {
+        if (lpa_sim_host_suspended())
+        {
+            olm.wake();
+        }
+    }
+
+    AppOlmInterface &olm = AppOlmInterface::get_instance();
+    int whd = 0;
+    int ip = 0;
+};
+
+TEST_F(TestAppOlListArp, arp_follows_the_packet_filter)
+{
+    ol_desc_t *list = app_ol_list_get();
+
+    ASSERT_NE(nullptr, list);
+    EXPECT_STREQ("Pkt_Filter", list[0].name);
+    EXPECT_STREQ("ARP", list[1].name);
+    EXPECT_EQ(&arp_ol_fns, list[1].fns);
+    EXPECT_EQ(nullptr, list[2].name);
+}
+
+TEST_F(TestAppOlListArp, awake_host_answers_arp)
+{
+    lpa_sim_frame_t request = lpa_sim_arp_request(TEST_PEER_IP, TEST_HOST_IP);
+    lpa_sim_rx_t rx = lpa_sim_rx(&request);
+
+    EXPECT_EQ(LPA_SIM_HOST, rx.dest);
+    EXPECT_FALSE(rx.woke_host);
+    EXPECT_EQ((uint32_t)LPA_SIM_HOST_REPLY_MS, rx.reply_ms);
+}
+
+TEST_F(TestAppOlListArp, suspended_host_is_not_woken_by_arp)
+{
+    lpa_sim_frame_t request = lpa_sim_arp_request(TEST_PEER_IP, TEST_HOST_IP);
+
+    olm.sleep();
+    lpa_sim_rx_t rx = lpa_sim_rx(&request);
+
+    EXPECT_EQ(LPA_SIM_WLAN, rx.dest);
+    EXPECT_FALSE(rx.woke_host);
+    EXPECT_EQ(0U, lpa_sim_host_wakes());
+}
+
+/* Without peer auto reply, requests for other addresses still reach the
+ * host; the packet filters keep ARP.
+ */
+TEST_F(TestAppOlListArp, arp_for_peers_is_passed_without_peer_auto_reply)
+{
+    lpa_sim_frame_t learn = lpa_sim_arp_request(TEST_OTHER_IP, TEST_HOST_IP);
+    lpa_sim_frame_t request = lpa_sim_arp_request(TEST_PEER_IP, TEST_OTHER_IP);
+
+    olm.sleep();
+    (void)lpa_sim_rx(&learn);
+    lpa_sim_rx_t rx = lpa_sim_rx(&request);
+
+    EXPECT_EQ(MBED_CONF_APP_ARP_OFFLOAD_PEER_AUTO_REPLY ? LPA_SIM_WLAN : LPA_SIM_HOST,
+              rx.dest);
+}
+
+/* Reply latency of ARP requests sent while the host is suspended, with the
+ * offload list and with the same list without its ARP entry.
+ */
+TEST_F(TestAppOlListArp, latency_with_and_without_offload)
+{
+    ol_desc_t baseline_list[APP_OL_LIST_MAX + 1] = {};
+    uint8_t count = 0;
+
+    for (ol_desc_t *ol = app_ol_list_get(); NULL != ol->name; ol++)
+    {
+        if (0 != strcmp("ARP", ol->name))
+        {
+            baseline_list[count++] = *ol;
+        }
+    }
+
+    uint32_t offload_ms = test_arp_latency_ms(olm);
+    uint32_t offload_wakes = lpa_sim_host_wakes();
+
+    lpa_sim_reset(TEST_HOST_IP);
+    CyOlmInterface baseline(baseline_list);
+    ASSERT_EQ(0, baseline.init_ols(&whd, &ip));
+    uint32_t baseline_ms = test_arp_latency_ms(baseline);
+    uint32_t baseline_wakes = lpa_sim_host_wakes();
+
+    printf("%u ARP requests while suspended: offload %u ms per reply, %u host wakes; "
+           "host %u ms per reply, %u host wakes\n", TEST_ARP_REQUESTS,
+           offload_ms / TEST_ARP_REQUESTS, offload_wakes,
+           baseline_ms / TEST_ARP_REQUESTS, baseline_wakes);
+
+    EXPECT_EQ(0U, offload_wakes);
+    EXPECT_EQ((uint32_t)TEST_ARP_REQUESTS, baseline_wakes);
+    EXPECT_EQ((uint32_t)(TEST_ARP_REQUESTS * LPA_SIM_WLAN_REPLY_MS), offload_ms);
+    EXPECT_EQ((uint32_t)(TEST_ARP_REQUESTS * (LPA_SIM_HOST_REPLY_MS + LPA_SIM_HOST_WAKE_MS)),
+              baseline_ms);
+}
+
+
+/* [] END OF FILE */
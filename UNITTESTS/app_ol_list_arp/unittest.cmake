@@ -0,0 +1,20 @@
+# ARP offload of the offload list on the simulated WLAN: ARP requests for
+# the host address answered while the host stays suspended, and the reply
+# latency against the host answering them itself.
+
+set(unittest-sources
+    ${APP_SOURCE}/app_ol_list.cpp
+    ${APP_SOURCE}/app_olm.cpp
+    ${APP_STUBS}/mbed_stub.cpp
+    ${APP_STUBS}/app_log_stub.cpp
+    ${APP_STUBS}/lpa_sim_stub.cpp
+    ${APP_STUBS}/cycfg_connectivity_wifi_stub.cpp
+)
+
+set(unittest-test-sources
+    app_ol_list_arp/test_app_ol_list_arp.cpp
+)
+
+set(unittest-definitions
+    MBED_CONF_APP_ARP_OFFLOAD=1
+)
@@ -0,0 +1,20 @@
+# Offload list with more packet filters than APP_OL_PF_MAX.
+
+set(unittest-sources
+    ${APP_SOURCE}/app_ol_list.cpp
+    ${APP_SOURCE}/app_olm.cpp
+    ${APP_STUBS}/mbed_stub.cpp
+    ${APP_STUBS}/app_log_stub.cpp
+    ${APP_STUBS}/lpa_sim_stub.cpp
+    ${APP_STUBS}/cycfg_connectivity_wifi_stub.cpp
+)
+
+set(unittest-test-sources
+    app_ol_list_full/test_app_ol_list_full.cpp
+)
+
+# The design filter, 6 preset ports and the 4 filters of the quiet hours.
+set(unittest-definitions
+    MBED_CONF_APP_PF_PRESETS=APP_PF_PRESET_CHATTER
+    MBED_CONF_APP_PF_QUIET_ENABLE=1
+)
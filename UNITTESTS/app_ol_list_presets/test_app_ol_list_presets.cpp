@@ -0,0 +1,164 @@
+/******************************************************************************
+ * File Name: test_app_ol_list_presets.cpp
+ *
+ * Description:
+ *   Unit tests of the discard presets of app_ol_list on the simulated WLAN,
+ *   built once per pf-presets value. Each build logs its filter table, which
+ *   tools/pf_replay.py replays against tools/pf_chatter.pcap.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+
+#include <unistd.h>
+#include "gtest/gtest.h"
+#include "app_ol_list.h"
+#include "app_olm.h"
+#include "lpa_sim.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#define TEST_HOST_IP               "192.168.1.10"
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+typedef struct
+{
+    uint32_t preset;
+    uint16_t port;
+} test_preset_port_t;
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+static const test_preset_port_t test_ports[] =
+{
+    { APP_PF_PRESET_SSDP,    1900 },
+    { APP_PF_PRESET_MDNS,    5353 },
+    { APP_PF_PRESET_LLMNR,   5355 },
+    { APP_PF_PRESET_NETBIOS, 137  },
+    { APP_PF_PRESET_NETBIOS, 138  },
+    { APP_PF_PRESET_WSD,     3702 },
+};
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+static lpa_sim_dest_t test_udp(uint16_t dport)
+{
+    lpa_sim_frame_t frame = lpa_sim_udp(40000, dport);
+
+    return lpa_sim_rx(&frame).dest;
+}
+
+class TestAppOlListPresets : public testing::Test
+{
+protected:
+    void SetUp()
+    {
+        lpa_sim_reset(TEST_HOST_IP);
+        ASSERT_EQ(0, olm.init_ols(&whd, &ip));
+    }
+
+    void TearDown()
+    {
+        if (lpa_sim_host_suspended())
+        {
+            olm.wake();
+        }
+    }
+
+    AppOlmInterface &olm = AppOlmInterface::get_instance();
+    int whd = 0;
+    int ip = 0;
+};
+
+/* The selected presets are dropped while suspended only. */
+TEST_F(TestAppOlListPresets, selected_presets_are_dropped_while_suspended)
+{
+    for (const test_preset_port_t &p : test_ports)
+    {
+        EXPECT_EQ(LPA_SIM_HOST, test_udp(p.port)) << "port " << p.port;
+    }
+
+    olm.sleep();
+    for (const test_preset_port_t &p : test_ports)
+    {
+        bool selected = (0 != (MBED_CONF_APP_PF_PRESETS & p.preset));
+
+        EXPECT_EQ(selected ? LPA_SIM_DROPPED : LPA_SIM_HOST, test_udp(p.port))
+            << "port " << p.port;
+    }
+}
+
+/* Logs the filter table, the design filter and one per selected port, for
+ * the pf-replay tests.
+ */
+TEST_F(TestAppOlListPresets, filter_table_is_logged)
+{
+    FILE *log = fopen(TEST_LOG_FILE, "w+");
+    uint32_t expected = 1;
+    uint32_t lines = 0;
+    char line[128];
+    int saved_stdout;
+
+    ASSERT_NE((FILE *)NULL, log);
+    fflush(stdout);
+    saved_stdout = dup(STDOUT_FILENO);
+    ASSERT_LE(0, dup2(fileno(log), STDOUT_FILENO));
+
+    app_ol_list_pf_print();
+
+    fflush(stdout);
+    ASSERT_LE(0, dup2(saved_stdout, STDOUT_FILENO));
+    close(saved_stdout);
+
+    for (const test_preset_port_t &p : test_ports)
+    {
+        expected += (0 != (MBED_CONF_APP_PF_PRESETS & p.preset)) ? 1 : 0;
+    }
+
+    rewind(log);
+    while (NULL != fgets(line, sizeof(line), log))
+    {
+        lines += (NULL != strstr(line, "Filter ")) ? 1 : 0;
+    }
+    EXPECT_EQ(0, fclose(log));
+    EXPECT_EQ(expected, lines);
+}
+
+
+/* [] END OF FILE */
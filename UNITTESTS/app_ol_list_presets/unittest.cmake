@@ -0,0 +1,34 @@
+# Discard presets on the simulated WLAN, built once per preset. Each variant
+# logs its filter table for the tools/pf_replay.py replay of
+# tools/pf_chatter.pcap.
+
+set(unittest-sources
+    ${APP_SOURCE}/app_ol_list.cpp
+    ${APP_SOURCE}/app_olm.cpp
+    ${APP_STUBS}/mbed_stub.cpp
+    ${APP_STUBS}/app_log_stub.cpp
+    ${APP_STUBS}/lpa_sim_stub.cpp
+    ${APP_STUBS}/cycfg_connectivity_wifi_stub.cpp
+)
+
+set(unittest-test-sources
+    app_ol_list_presets/test_app_ol_list_presets.cpp
+)
+
+# app_ol_list_pf_print() logs at the info level.
+set(unittest-definitions
+    MBED_CONF_APP_LOG_LEVEL=2
+)
+
+set(unittest-variants none ssdp mdns llmnr netbios wsd chatter)
+foreach(variant ${unittest-variants})
+    string(TOUPPER ${variant} preset)
+    set(unittest-definitions-${variant}
+        "MBED_CONF_APP_PF_PRESETS=APP_PF_PRESET_${preset}"
+        "TEST_LOG_FILE=\"app_ol_list_presets-${variant}.log\""
+    )
+endforeach()
+set(unittest-definitions-none
+    MBED_CONF_APP_PF_PRESETS=0
+    "TEST_LOG_FILE=\"app_ol_list_presets-none.log\""
+)
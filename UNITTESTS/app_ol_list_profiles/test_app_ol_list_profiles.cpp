@@ -0,0 +1,212 @@
+/******************************************************************************
+ * File Name: test_app_ol_list_profiles.cpp
+ *
+ * Description:
+ *   Unit tests of the sleep and wake packet filter profiles of app_ol_list on
+ *   the simulated WLAN. The list holds the ICMP discard filter of the design,
+ *   moved to the sleep profile by pf-permissive-wake, the SSDP and mDNS
+ *   presets and two filters added with app_ol_list_pf_add().
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "gtest/gtest.h"
+#include "app_ol_list.h"
+#include "app_olm.h"
+#include "lpa_sim.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#define TEST_HOST_IP               "192.168.1.10"
+
+#define TEST_PORT_SSDP             (1900U)
+#define TEST_PORT_MDNS             (5353U)
+#define TEST_PORT_WAKE_DISCARD     (7000U)  /* Added to the wake profile */
+#define TEST_PORT_SLEEP_DISCARD    (7001U)  /* Added to the sleep profile */
+#define TEST_PORT_SESSION          (5000U)  /* Application traffic */
+
+#define TEST_CYCLES                (3)
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+/* Expected destination of each kind of frame in one profile. */
+typedef struct
+{
+    lpa_sim_dest_t icmp;
+    lpa_sim_dest_t ssdp;
+    lpa_sim_dest_t mdns;
+    lpa_sim_dest_t wake_discard;
+    lpa_sim_dest_t sleep_discard;
+    lpa_sim_dest_t session;
+} test_verdicts_t;
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+static const test_verdicts_t awake_verdicts =
+{
+    .icmp = LPA_SIM_HOST,
+    .ssdp = LPA_SIM_HOST,
+    .mdns = LPA_SIM_HOST,
+    .wake_discard = LPA_SIM_DROPPED,
+    .sleep_discard = LPA_SIM_HOST,
+    .session = LPA_SIM_HOST,
+};
+
+static const test_verdicts_t suspended_verdicts =
+{
+    .icmp = LPA_SIM_DROPPED,
+    .ssdp = LPA_SIM_DROPPED,
+    .mdns = LPA_SIM_DROPPED,
+    .wake_discard = LPA_SIM_HOST,
+    .sleep_discard = LPA_SIM_DROPPED,
+    .session = LPA_SIM_HOST,
+};
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+static lpa_sim_dest_t test_udp(uint16_t dport)
+{
+    lpa_sim_frame_t frame = lpa_sim_udp(40000, dport);
+
+    return lpa_sim_rx(&frame).dest;
+}
+
+static lpa_sim_dest_t test_icmp(void)
+{
+    lpa_sim_frame_t frame = {};
+
+    frame.eth_type = LPA_SIM_ETH_TYPE_IPV4;
+    frame.ip_proto = LPA_SIM_IP_PROTO_ICMP;
+    return lpa_sim_rx(&frame).dest;
+}
+
+static void test_expect_verdicts(const test_verdicts_t *expected)
+{
+    EXPECT_TRUE(lpa_sim_pf_consistent());
+    EXPECT_EQ(expected->icmp, test_icmp());
+    EXPECT_EQ(expected->ssdp, test_udp(TEST_PORT_SSDP));
+    EXPECT_EQ(expected->mdns, test_udp(TEST_PORT_MDNS));
+    EXPECT_EQ(expected->wake_discard, test_udp(TEST_PORT_WAKE_DISCARD));
+    EXPECT_EQ(expected->sleep_discard, test_udp(TEST_PORT_SLEEP_DISCARD));
+    EXPECT_EQ(expected->session, test_udp(TEST_PORT_SESSION));
+}
+
+static void test_add_discard(uint16_t port, uint32_t profile)
+{
+    cy_pf_ol_cfg_t filter = {};
+
+    filter.feature = CY_PF_OL_FEAT_PORTNUM;
+    filter.bits = CY_PF_ACTION_DISCARD;
+    filter.u.port.portnum = port;
+    filter.u.port.direction = PF_PN_PORT_DEST;
+    ASSERT_EQ(CY_RSLT_SUCCESS, app_ol_list_pf_add(&filter, profile));
+}
+
+class TestAppOlListProfiles : public testing::Test
+{
+protected:
+    /* The list is built once, by the first offload manager instance. */
+    static void SetUpTestSuite()
+    {
+        test_add_discard(TEST_PORT_WAKE_DISCARD, APP_PF_PROFILE_WAKE);
+        test_add_discard(TEST_PORT_SLEEP_DISCARD, APP_PF_PROFILE_SLEEP);
+    }
+
+    void SetUp()
+    {
+        lpa_sim_reset(TEST_HOST_IP);
+        ASSERT_EQ(0, olm.init_ols(&whd, &ip));
+    }
+
+    void TearDown()
+    {
+        if (lpa_sim_host_suspended())
+        {
+            olm.wake();
+        }
+    }
+
+    AppOlmInterface &olm = AppOlmInterface::get_instance();
+    int whd = 0;
+    int ip = 0;
+};
+
+TEST_F(TestAppOlListProfiles, filters_cannot_be_added_to_a_built_list)
+{
+    cy_pf_ol_cfg_t filter = {};
+
+    filter.feature = CY_PF_OL_FEAT_PORTNUM;
+    filter.u.port.portnum = 7002;
+    EXPECT_EQ(CY_RSLT_TYPE_ERROR, app_ol_list_pf_add(&filter, APP_PF_PROFILE_ALWAYS));
+}
+
+TEST_F(TestAppOlListProfiles, wake_profile_applies_after_init)
+{
+    test_expect_verdicts(&awake_verdicts);
+}
+
+TEST_F(TestAppOlListProfiles, verdicts_switch_at_every_transition)
+{
+    for (uint32_t cycle = 0; cycle < TEST_CYCLES; cycle++)
+    {
+        olm.sleep();
+        ASSERT_TRUE(app_olm_is_suspended());
+        test_expect_verdicts(&suspended_verdicts);
+
+        olm.wake();
+        ASSERT_FALSE(app_olm_is_suspended());
+        test_expect_verdicts(&awake_verdicts);
+    }
+}
+
+/* Frames passed while suspended wake the host; the ones dropped do not. */
+TEST_F(TestAppOlListProfiles, only_passed_frames_wake_the_host)
+{
+    olm.sleep();
+
+    (void)test_icmp();
+    (void)test_udp(TEST_PORT_SSDP);
+    (void)test_udp(TEST_PORT_SLEEP_DISCARD);
+    EXPECT_EQ(0U, lpa_sim_host_wakes());
+
+    (void)test_udp(TEST_PORT_SESSION);
+    EXPECT_EQ(1U, lpa_sim_host_wakes());
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,20 @@
+# Sleep and wake packet filter profiles on the simulated WLAN: the verdict
+# of each kind of frame before and after every suspend and resume.
+
+set(unittest-sources
+    ${APP_SOURCE}/app_ol_list.cpp
+    ${APP_SOURCE}/app_olm.cpp
+    ${APP_STUBS}/mbed_stub.cpp
+    ${APP_STUBS}/app_log_stub.cpp
+    ${APP_STUBS}/lpa_sim_stub.cpp
+    ${APP_STUBS}/cycfg_connectivity_wifi_stub.cpp
+)
+
+set(unittest-test-sources
+    app_ol_list_profiles/test_app_ol_list_profiles.cpp
+)
+
+set(unittest-definitions
+    MBED_CONF_APP_PF_PERMISSIVE_WAKE=1
+    "MBED_CONF_APP_PF_PRESETS=(APP_PF_PRESET_SSDP|APP_PF_PRESET_MDNS)"
+)
@@ -0,0 +1,194 @@
+/******************************************************************************
+ * File Name: test_app_ol_list_tko.cpp
+ *
+ * Description:
+ *   Unit tests of the TCP keepalive offload of app_ol_list on the simulated
+ *   WLAN. The peer of the simulator acknowledges a keepalive only if its
+ *   sequence and acknowledgement numbers match the data exchanged so far.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "gtest/gtest.h"
+#include "app_ol_list.h"
+#include "app_olm.h"
+#include "cy_lpa_wifi_tko_ol.h"
+#include "lpa_sim.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#define TEST_HOST_IP               "192.168.1.10"
+#define TEST_PEER_IP               "192.168.1.20"
+#define TEST_LOCAL_PORT            (50000U)
+#define TEST_REMOTE_PORT           (8883U)
+
+#define TEST_CYCLES                (5)
+#define TEST_KEEPALIVES_PER_CYCLE  (3)
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+class TestAppOlListTko : public testing::Test
+{
+protected:
+    void SetUp()
+    {
+        lpa_sim_reset(TEST_HOST_IP);
+        ASSERT_EQ(0, olm.init_ols(&whd, &ip));
+
+        conn.local_port = TEST_LOCAL_PORT;
+        conn.remote_ip = TEST_PEER_IP;
+        conn.remote_port = TEST_REMOTE_PORT;
+        lpa_sim_tcp_open(&conn, 1000, 0xFFFFFF00U);
+        ASSERT_EQ(CY_RSLT_SUCCESS,
+                  app_ol_list_tko_set(0, SocketAddress(TEST_PEER_IP, TEST_REMOTE_PORT),
+                                      TEST_LOCAL_PORT));
+    }
+
+    void TearDown()
+    {
+        if (lpa_sim_host_suspended())
+        {
+            olm.wake();
+        }
+        (void)app_ol_list_tko_clear(0);
+        lpa_sim_tcp_close(&conn);
+    }
+
+    /* Suspends for the given number of keepalive intervals. */
+    void suspend_intervals(uint32_t intervals)
+    {
+        olm.sleep();
+        lpa_sim_advance_s(intervals * MBED_CONF_APP_TKO_OFFLOAD_INTERVAL);
+    }
+
+    AppOlmInterface &olm = AppOlmInterface::get_instance();
+    lpa_sim_tcp_t conn = {};
+    int whd = 0;
+    int ip = 0;
+};
+
+TEST_F(TestAppOlListTko, tko_follows_the_packet_filter)
+{
+    ol_desc_t *list = app_ol_list_get();
+
+    ASSERT_NE(nullptr, list);
+    EXPECT_STREQ("Pkt_Filter", list[0].name);
+    EXPECT_STREQ("TKO", list[1].name);
+    EXPECT_EQ(nullptr, list[2].name);
+}
+
+TEST_F(TestAppOlListTko, invalid_connections_are_rejected)
+{
+    EXPECT_EQ(CY_RSLT_TYPE_ERROR,
+              app_ol_list_tko_set(MAX_TKO, SocketAddress(TEST_PEER_IP, 1), 1));
+    EXPECT_EQ(CY_RSLT_TYPE_ERROR,
+              app_ol_list_tko_set(1, SocketAddress("fe80::1", 1), 1));
+    EXPECT_EQ(CY_RSLT_TYPE_ERROR, app_ol_list_tko_clear(MAX_TKO));
+}
+
+/* Data in both directions while awake, then keepalives while suspended,
+ * with sequence numbers wrapping during the cycles.
+ */
+TEST_F(TestAppOlListTko, keepalives_stay_consistent_across_suspend_cycles)
+{
+    for (uint32_t cycle = 0; cycle < TEST_CYCLES; cycle++)
+    {
+        ASSERT_TRUE(lpa_sim_tcp_send(&conn, 100 + cycle));
+        ASSERT_EQ(LPA_SIM_HOST, lpa_sim_tcp_peer_send(&conn, 64).dest);
+
+        suspend_intervals(TEST_KEEPALIVES_PER_CYCLE);
+        EXPECT_EQ(0U, lpa_sim_host_wakes());
+        olm.wake();
+    }
+
+    EXPECT_EQ((uint32_t)(TEST_CYCLES * TEST_KEEPALIVES_PER_CYCLE), conn.keepalives);
+    EXPECT_EQ(0U, conn.bad_segments);
+    EXPECT_TRUE(lpa_sim_tcp_send(&conn, 1));
+}
+
+/* Peer data wakes the host, which resumes the connection with the numbers
+ * the keepalives used and hands the new ones over on the next suspend.
+ */
+TEST_F(TestAppOlListTko, peer_data_wakes_the_host_and_resumes_consistently)
+{
+    suspend_intervals(1);
+
+    lpa_sim_rx_t rx = lpa_sim_tcp_peer_send(&conn, 32);
+    EXPECT_EQ(LPA_SIM_HOST, rx.dest);
+    EXPECT_TRUE(rx.woke_host);
+    olm.wake();
+
+    ASSERT_TRUE(lpa_sim_tcp_send(&conn, 16));
+    suspend_intervals(2);
+    olm.wake();
+
+    EXPECT_EQ(3U, conn.keepalives);
+    EXPECT_EQ(0U, conn.bad_segments);
+}
+
+/* Checks the model itself: keepalives with the numbers taken before the
+ * peer sent more data acknowledge too little and are rejected.
+ */
+TEST_F(TestAppOlListTko, stale_numbers_are_rejected_by_the_peer)
+{
+    suspend_intervals(1);
+    (void)lpa_sim_tcp_peer_send(&conn, 32);
+    lpa_sim_advance_s(MBED_CONF_APP_TKO_OFFLOAD_INTERVAL);
+
+    EXPECT_EQ(1U, conn.keepalives);
+    EXPECT_EQ(1U, conn.bad_segments);
+}
+
+TEST_F(TestAppOlListTko, cleared_connection_gets_no_keepalives)
+{
+    ASSERT_EQ(CY_RSLT_SUCCESS, app_ol_list_tko_clear(0));
+
+    suspend_intervals(2);
+    olm.wake();
+
+    EXPECT_EQ(0U, conn.keepalives);
+    EXPECT_EQ(0U, conn.bad_segments);
+}
+
+TEST_F(TestAppOlListTko, no_keepalives_while_awake)
+{
+    lpa_sim_advance_s(2 * MBED_CONF_APP_TKO_OFFLOAD_INTERVAL);
+
+    EXPECT_EQ(0U, conn.keepalives);
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,19 @@
+# TCP keepalive offload of the offload list on the simulated WLAN: the
+# sequence numbers of the keepalives stay consistent across suspend cycles.
+
+set(unittest-sources
+    ${APP_SOURCE}/app_ol_list.cpp
+    ${APP_SOURCE}/app_olm.cpp
+    ${APP_STUBS}/mbed_stub.cpp
+    ${APP_STUBS}/app_log_stub.cpp
+    ${APP_STUBS}/lpa_sim_stub.cpp
+    ${APP_STUBS}/cycfg_connectivity_wifi_stub.cpp
+)
+
+set(unittest-test-sources
+    app_ol_list_tko/test_app_ol_list_tko.cpp
+)
+
+set(unittest-definitions
+    MBED_CONF_APP_TKO_OFFLOAD=1
+)
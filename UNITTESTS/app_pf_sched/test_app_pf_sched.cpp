@@ -0,0 +1,247 @@
+/******************************************************************************
+ * File Name: test_app_pf_sched.cpp
+ *
+ * Description:
+ *   Unit tests of the quiet hours schedule of app_pf_sched, 22:00 to 06:00
+ *   with port 8080 kept, driven by a fake clock on the simulated WLAN.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "gtest/gtest.h"
+#include "app_pf_sched.h"
+#include "app_ol_list.h"
+#include "app_olm.h"
+#include "lpa_sim.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#define TEST_HOST_IP               "192.168.1.10"
+
+/* 2026-01-01 00:00:00 UTC */
+#define TEST_MIDNIGHT              ((time_t)1767225600L)
+#define TEST_AT(hour, min, sec)    (TEST_MIDNIGHT + (hour) * 3600L + (min) * 60L + (sec))
+
+#define TEST_PORT_KEPT             (8080U)
+#define TEST_PORT_OTHER            (1900U)
+
+/* Suspend cycles of the concurrency test, and the duration of each filter
+ * IOCTL, which lets the threads interleave.
+ */
+#define TEST_RACE_ITERATIONS       (300)
+#define TEST_RACE_IOCTL_US         (20)
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+static time_t test_now;
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+static time_t test_clock(void)
+{
+    return test_now;
+}
+
+static lpa_sim_dest_t test_udp(uint16_t dport)
+{
+    lpa_sim_frame_t frame = lpa_sim_udp(40000, dport);
+
+    return lpa_sim_rx(&frame).dest;
+}
+
+/* The WLAN filters match the configuration, checked with no transition in
+ * progress.
+ */
+static bool test_consistent(void)
+{
+    app_olm_lock();
+    bool consistent = lpa_sim_pf_consistent();
+    app_olm_unlock();
+
+    return consistent;
+}
+
+class TestAppPfSched : public testing::Test
+{
+protected:
+    void SetUp()
+    {
+        lpa_sim_reset(TEST_HOST_IP);
+        ASSERT_EQ(0, olm.init_ols(&whd, &ip));
+        app_pf_sched_set_clock(test_clock);
+
+        /* Start every test outside the window. */
+        test_now = TEST_AT(12, 0, 0);
+        (void)app_pf_sched_step();
+    }
+
+    void TearDown()
+    {
+        if (lpa_sim_host_suspended())
+        {
+            olm.wake();
+        }
+        app_pf_sched_set_clock(NULL);
+    }
+
+    AppOlmInterface &olm = AppOlmInterface::get_instance();
+    int whd = 0;
+    int ip = 0;
+};
+
+TEST_F(TestAppPfSched, waits_for_the_rtc)
+{
+    test_now = 0;
+
+    EXPECT_EQ(60U, app_pf_sched_step());
+}
+
+TEST_F(TestAppPfSched, wakes_up_at_the_window_boundaries)
+{
+    test_now = TEST_AT(21, 59, 30);
+    EXPECT_EQ(30U, app_pf_sched_step());
+
+    test_now = TEST_AT(5, 0, 1) + 86400L;
+    EXPECT_EQ(3599U, app_pf_sched_step());
+}
+
+/* Windows hours away are rechecked every hour. */
+TEST_F(TestAppPfSched, sleeps_one_hour_at_most)
+{
+    test_now = TEST_AT(22, 0, 0);
+    EXPECT_EQ(3600U, app_pf_sched_step());
+
+    test_now = TEST_AT(6, 0, 0) + 86400L;
+    EXPECT_EQ(3600U, app_pf_sched_step());
+}
+
+/* A group the WLAN failed to switch is switched again at the next step. */
+TEST_F(TestAppPfSched, failed_switch_is_retried)
+{
+    olm.sleep();
+    lpa_sim_fail_pf_ioctls(1);
+
+    test_now = TEST_AT(22, 0, 0);
+    EXPECT_EQ(60U, app_pf_sched_step());
+    EXPECT_FALSE(lpa_sim_pf_consistent());
+
+    test_now = TEST_AT(22, 1, 0);
+    EXPECT_EQ(3600U, app_pf_sched_step());
+    EXPECT_TRUE(lpa_sim_pf_consistent());
+    EXPECT_EQ(LPA_SIM_DROPPED, test_udp(TEST_PORT_OTHER));
+    EXPECT_EQ(LPA_SIM_HOST, test_udp(TEST_PORT_KEPT));
+}
+
+/* A boundary crossed while suspended switches the WLAN right away. */
+TEST_F(TestAppPfSched, quiet_hours_switch_the_suspended_wlan)
+{
+    olm.sleep();
+    EXPECT_EQ(LPA_SIM_HOST, test_udp(TEST_PORT_OTHER));
+
+    test_now = TEST_AT(22, 0, 0);
+    (void)app_pf_sched_step();
+    EXPECT_TRUE(lpa_sim_pf_consistent());
+    EXPECT_EQ(LPA_SIM_DROPPED, test_udp(TEST_PORT_OTHER));
+    EXPECT_EQ(LPA_SIM_HOST, test_udp(TEST_PORT_KEPT));
+
+    test_now = TEST_AT(6, 0, 0) + 86400L;
+    (void)app_pf_sched_step();
+    EXPECT_TRUE(lpa_sim_pf_consistent());
+    EXPECT_EQ(LPA_SIM_HOST, test_udp(TEST_PORT_OTHER));
+}
+
+/* A boundary crossed while awake applies at the next suspend, the quiet
+ * filters belong to the sleep profile.
+ */
+TEST_F(TestAppPfSched, quiet_hours_apply_at_the_next_suspend)
+{
+    test_now = TEST_AT(23, 0, 0);
+    (void)app_pf_sched_step();
+    EXPECT_EQ(LPA_SIM_HOST, test_udp(TEST_PORT_OTHER));
+
+    olm.sleep();
+    EXPECT_EQ(LPA_SIM_DROPPED, test_udp(TEST_PORT_OTHER));
+    EXPECT_EQ(LPA_SIM_HOST, test_udp(TEST_PORT_KEPT));
+}
+
+TEST_F(TestAppPfSched, steps_inside_the_window_switch_nothing)
+{
+    test_now = TEST_AT(22, 0, 0);
+    (void)app_pf_sched_step();
+    olm.sleep();
+
+    test_now = TEST_AT(5, 30, 0) + 86400L;
+    EXPECT_EQ(1800U, app_pf_sched_step());
+    EXPECT_EQ(LPA_SIM_DROPPED, test_udp(TEST_PORT_OTHER));
+}
+
+/* Group switches from one thread while another suspends and resumes: the
+ * WLAN always holds the filters of the configuration.
+ */
+TEST_F(TestAppPfSched, group_switches_are_atomic_with_transitions)
+{
+    std::atomic<uint32_t> inconsistent{0};
+    std::atomic<bool> done{false};
+
+    lpa_sim_set_ioctl_us(TEST_RACE_IOCTL_US);
+
+    std::thread toggler([&inconsistent, &done]()
+    {
+        for (uint32_t i = 0; !done; i++)
+        {
+            (void)app_ol_list_pf_set_group(APP_PF_GROUP_QUIET, 0 == (i & 1));
+            inconsistent += test_consistent() ? 0 : 1;
+        }
+    });
+
+    for (uint32_t i = 0; i < TEST_RACE_ITERATIONS; i++)
+    {
+        olm.sleep();
+        inconsistent += test_consistent() ? 0 : 1;
+        olm.wake();
+        inconsistent += test_consistent() ? 0 : 1;
+    }
+
+    done = true;
+    toggler.join();
+    (void)app_ol_list_pf_set_group(APP_PF_GROUP_QUIET, false);
+
+    EXPECT_EQ(0U, inconsistent.load());
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,24 @@
+# Quiet hours filter schedule with a fake clock on the simulated WLAN, and
+# group switches concurrent with suspend and resume.
+
+set(unittest-sources
+    ${APP_SOURCE}/app_pf_sched.cpp
+    ${APP_SOURCE}/app_ol_list.cpp
+    ${APP_SOURCE}/app_olm.cpp
+    ${APP_STUBS}/mbed_stub.cpp
+    ${APP_STUBS}/app_log_stub.cpp
+    ${APP_STUBS}/app_wco_stub.cpp
+    ${APP_STUBS}/lpa_sim_stub.cpp
+    ${APP_STUBS}/cycfg_connectivity_wifi_stub.cpp
+)
+
+set(unittest-test-sources
+    app_pf_sched/test_app_pf_sched.cpp
+)
+
+set(unittest-definitions
+    MBED_CONF_APP_PF_QUIET_ENABLE=1
+    MBED_CONF_APP_PF_QUIET_START_MIN=1320
+    MBED_CONF_APP_PF_QUIET_END_MIN=360
+    "MBED_CONF_APP_PF_QUIET_KEEP_PORTS={8080}"
+)
@@ -0,0 +1,295 @@
+/******************************************************************************
+ * File Name: test_app_qlog.cpp
+ *
+ * Description:
+ *   Unit tests of the page allocation of app_qlog on a NOR flash emulated by
+ *   app_xip_stub.cpp. Each boot of the kit is a child process, which a power
+ *   loss during an erase or a program ends at once.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <random>
+#include "gtest/gtest.h"
+#include "app_qlog.h"
+#include "app_olm.h"
+#include "app_stats.h"
+#include "app_host_stubs.h"
+#include "cy_syslib.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+/* Six 4 KB sectors, the last four of which hold the log: 32 pages. */
+#define TEST_SECTOR_SIZE           (4096U)
+#define TEST_MEM_SIZE              (6U * TEST_SECTOR_SIZE)
+#define TEST_LOG_SECTORS           (4U)
+#define TEST_LOG_BASE              (TEST_MEM_SIZE - (TEST_LOG_SECTORS * TEST_SECTOR_SIZE))
+
+#define TEST_BOOTS                 (300)
+#define TEST_PAGES_PER_BOOT        (3)
+
+/* Every fourth boot runs without a power loss. */
+#define TEST_CLEAN_BOOT_EVERY      (4)
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+/* Page header of app_qlog.cpp. */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t seq;
+    uint16_t count;
+    uint16_t rec_size;
+    uint32_t crc;
+} test_header_t;
+
+/* State shared with the boots. */
+typedef struct
+{
+    uint32_t next_time;       /* time_s of the next wake record */
+    uint32_t failures;
+    char     message[256];    /* First failure */
+} test_shared_t;
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+static test_shared_t *test_shared;
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/* The test runs the log without the offload manager and the statistics. */
+cy_rslt_t app_olm_add_hook(app_olm_hook_t hook)
+{
+    (void)hook;
+    return CY_RSLT_SUCCESS;
+}
+
+bool app_stats_get_last_cycle(app_stats_cycle_t *cycle)
+{
+    (void)cycle;
+    return false;
+}
+
+uint32_t Cy_SysLib_GetResetReason(void)
+{
+    return 0;
+}
+
+static void test_fail(const char *what, uint32_t pos, uint32_t value)
+{
+    if (0U == test_shared->failures++)
+    {
+        snprintf(test_shared->message, sizeof(test_shared->message),
+                 "%s: position %u, value %u", what, pos, value);
+    }
+}
+
+/******************************************************************************
+ * Function Name: test_check_mount
+ ******************************************************************************
+ * Summary:
+ *   Checks the log found by app_qlog_init() against the bookkeeping of the
+ *   flash: every page written completely and not erased since is a log page
+ *   older than the next page, and the wake records grow with the sequence
+ *   numbers of the pages.
+ *
+ *****************************************************************************/
+static void test_check_mount(void)
+{
+    const app_xip_host_ctrl_t *ctrl = app_xip_host_ctrl();
+    const uint8_t *flash = app_xip_host_flash();
+    app_qlog_stats_t stats;
+    uint32_t first_time[TEST_LOG_SECTORS * TEST_SECTOR_SIZE / APP_QLOG_PAGE_SIZE];
+    uint32_t seqs[TEST_LOG_SECTORS * TEST_SECTOR_SIZE / APP_QLOG_PAGE_SIZE];
+    uint32_t written = 0;
+
+    app_qlog_get_stats(&stats);
+    if ((TEST_LOG_SECTORS * TEST_SECTOR_SIZE / APP_QLOG_PAGE_SIZE) != stats.pages)
+    {
+        test_fail("log region", 0, stats.pages);
+        return;
+    }
+
+    for (uint32_t pos = 0; pos < stats.pages; pos++)
+    {
+        uint32_t offset = TEST_LOG_BASE + (pos * APP_QLOG_PAGE_SIZE);
+        const app_qlog_rec_t *recs;
+        test_header_t header;
+
+        if (APP_XIP_HOST_WRITTEN != ctrl->page_state[offset / APP_QLOG_PAGE_SIZE])
+        {
+            continue;
+        }
+
+        memcpy(&header, &flash[offset], sizeof(header));
+        recs = (const app_qlog_rec_t *)&flash[offset + 16U];
+        if ((APP_QLOG_MAGIC != header.magic) || (pos != (header.seq % stats.pages)))
+        {
+            test_fail("written page without a log header", pos, header.seq);
+            continue;
+        }
+        if (header.seq >= stats.next_seq)
+        {
+            test_fail("written page not older than the next page", pos, header.seq);
+        }
+
+        seqs[written] = header.seq;
+        first_time[written] = 0;
+        for (uint32_t i = 0; i < header.count; i++)
+        {
+            if (APP_QLOG_REC_WAKE != recs[i].type)
+            {
+                continue;
+            }
+            if ((0U != first_time[written]) && (recs[i].time_s <= first_time[written]))
+            {
+                test_fail("records out of order", pos, recs[i].time_s);
+            }
+            if (0U == first_time[written])
+            {
+                first_time[written] = recs[i].time_s;
+            }
+        }
+        written++;
+    }
+
+    for (uint32_t i = 0; i < written; i++)
+    {
+        for (uint32_t j = 0; j < written; j++)
+        {
+            if ((seqs[i] < seqs[j]) && (0U != first_time[i]) && (0U != first_time[j]) &&
+                (first_time[i] >= first_time[j]))
+            {
+                test_fail("pages out of order", seqs[i], seqs[j]);
+            }
+        }
+    }
+}
+
+/******************************************************************************
+ * Function Name: test_boot
+ ******************************************************************************
+ * Summary:
+ *   One boot of the kit, run in a child process: mounts the log, checks it
+ *   and writes a few pages of wake records. A power loss ends the process
+ *   in app_xip_stub.cpp.
+ *
+ *****************************************************************************/
+static void test_boot(void)
+{
+    if (CY_RSLT_SUCCESS != app_qlog_init())
+    {
+        test_fail("mount", 0, 0);
+        _exit(0);
+    }
+    test_check_mount();
+
+    for (uint32_t page = 0; page < TEST_PAGES_PER_BOOT; page++)
+    {
+        for (uint32_t i = 0; i < APP_QLOG_RECS_PER_PAGE; i++)
+        {
+            app_qlog_rec_t rec = { 0 };
+
+            rec.time_s = ++test_shared->next_time;
+            rec.type = APP_QLOG_REC_WAKE;
+            app_qlog_append(&rec);
+        }
+        if (CY_RSLT_SUCCESS != app_qlog_flush())
+        {
+            test_fail("flush", page, 0);
+        }
+    }
+
+    _exit(0);
+}
+
+TEST(TestAppQlog, PowerLossDuringEraseAndProgram)
+{
+    std::mt19937 rng(1);
+    app_xip_host_ctrl_t *ctrl;
+
+    test_shared = (test_shared_t *)mmap(NULL, sizeof(*test_shared), PROT_READ | PROT_WRITE,
+                                        MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(MAP_FAILED, (void *)test_shared);
+    memset(test_shared, 0, sizeof(*test_shared));
+    app_xip_host_create(TEST_MEM_SIZE, TEST_SECTOR_SIZE, APP_QLOG_PAGE_SIZE);
+    ctrl = app_xip_host_ctrl();
+
+    for (uint32_t boot = 0; boot < TEST_BOOTS; boot++)
+    {
+        int status = 0;
+        pid_t pid;
+
+        /* A loss at one of the erases and programs of the boot. */
+        ctrl->loss_op = UINT32_MAX;
+        if ((TEST_CLEAN_BOOT_EVERY - 1U) != (boot % TEST_CLEAN_BOOT_EVERY))
+        {
+            ctrl->loss_op = ctrl->ops + (rng() % (2U * TEST_PAGES_PER_BOOT));
+        }
+        ctrl->loss_bytes = rng();
+
+        pid = fork();
+        ASSERT_LE(0, pid);
+        if (0 == pid)
+        {
+            test_boot();
+        }
+        ASSERT_EQ(pid, waitpid(pid, &status, 0));
+        ASSERT_TRUE(WIFEXITED(status) && (0 == WEXITSTATUS(status))) << "boot " << boot;
+        ASSERT_EQ(0U, test_shared->failures) << "boot " << boot << ": " << test_shared->message;
+    }
+
+    EXPECT_EQ(0U, ctrl->overwrites);
+    EXPECT_LT(0U, ctrl->losses);
+
+    printf("%u boots, %u power losses, erases per sector:", TEST_BOOTS, ctrl->losses);
+    for (uint32_t sector = TEST_LOG_BASE / TEST_SECTOR_SIZE;
+         sector < TEST_MEM_SIZE / TEST_SECTOR_SIZE; sector++)
+    {
+        EXPECT_LT(0U, ctrl->sector_erases[sector]);
+        printf(" %u", ctrl->sector_erases[sector]);
+    }
+    printf("\n");
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,18 @@
+# Wear-leveled QSPI log on a file-backed NOR flash, with power losses
+# injected into its erases and programs.
+
+set(unittest-sources
+    ${APP_SOURCE}/app_qlog.cpp
+    ${APP_STUBS}/mbed_stub.cpp
+    ${APP_STUBS}/app_log_stub.cpp
+    ${APP_STUBS}/app_xip_stub.cpp
+)
+
+set(unittest-test-sources
+    app_qlog/test_app_qlog.cpp
+)
+
+set(unittest-definitions
+    MBED_CONF_APP_QSPI_LOG=1
+    MBED_CONF_APP_QSPI_LOG_SECTORS=4
+)
@@ -0,0 +1,226 @@
+/******************************************************************************
+ * File Name: test_app_qspi_bench.cpp
+ *
+ * Description:
+ *   Unit tests of the read command selection of app_qspi_bench. The random
+ *   benchmarks and the choices of app_qspi_bench_select() are written as a
+ *   console log, which tools/qspi_bench.py selects again in the
+ *   qspi-bench-select test.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <random>
+#include "gtest/gtest.h"
+#include "app_qspi_bench.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+/* Console log of the random benchmarks, in the working directory of ctest. */
+#define TEST_LOG_FILE              "app_qspi_bench.log"
+
+#define TEST_BENCHMARKS            (500)
+
+/* Entry of the command table which repeats the generated command of the
+ * CY8CKIT-062S2-43012, quad 1-4-4.
+ */
+#define TEST_GENERATED_DUP         (6U)
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+/* Names of the command table of app_qspi_bench.cpp. */
+static const char *test_names[] =
+{
+    "generated", "read 1-1-1", "fast 1-1-1", "dual 1-1-2", "dual 1-2-2",
+    "quad 1-1-4", "quad 1-4-4",
+};
+
+#define TEST_MODES                 (sizeof(test_names) / sizeof(test_names[0]))
+
+/* Quad I/O read of the generated memory slot and of the command table. */
+static const cy_stc_smif_mem_cmd_t test_quad_io =
+{
+    0xECU, CY_SMIF_WIDTH_SINGLE, CY_SMIF_WIDTH_QUAD, 0x01U, CY_SMIF_WIDTH_QUAD, 4U,
+    CY_SMIF_WIDTH_QUAD
+};
+
+static const cy_stc_smif_mem_cmd_t test_fast_read =
+{
+    0x0CU, CY_SMIF_WIDTH_SINGLE, CY_SMIF_WIDTH_SINGLE, APP_QSPI_NO_MODE, CY_SMIF_WIDTH_SINGLE,
+    8U, CY_SMIF_WIDTH_SINGLE
+};
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+static app_qspi_bench_result_t test_result(uint32_t xip_kbps, uint32_t dma_kbps,
+                                           uint32_t latency_ns)
+{
+    app_qspi_bench_result_t result = { true, xip_kbps, dma_kbps, latency_ns };
+    return result;
+}
+
+TEST(TestAppQspiBench, CostIsOneMissAndTheSequentialReads)
+{
+    app_qspi_bench_result_t result = test_result(8000U, 7000U, 2000U);
+
+    EXPECT_EQ(2000U + 128000U, app_qspi_bench_cost_ns(&result));
+
+    result.xip_kbps = 0U;
+    EXPECT_EQ(UINT32_MAX, app_qspi_bench_cost_ns(&result));
+
+    result = test_result(8000U, 7000U, 2000U);
+    result.valid = false;
+    EXPECT_EQ(UINT32_MAX, app_qspi_bench_cost_ns(&result));
+}
+
+TEST(TestAppQspiBench, SelectsTheLowestCost)
+{
+    app_qspi_bench_result_t results[] =
+    {
+        test_result(4000U, 4000U, 3000U),
+        test_result(8000U, 7000U, 2000U),
+        test_result(16000U, 1000U, 1000U),
+        test_result(8000U, 9000U, 3000U),
+    };
+
+    EXPECT_EQ(2U, app_qspi_bench_select(results, 4U));
+}
+
+TEST(TestAppQspiBench, DmaThroughputBreaksTies)
+{
+    app_qspi_bench_result_t results[] =
+    {
+        test_result(8000U, 7000U, 2000U),
+        test_result(8000U, 7500U, 2000U),
+        test_result(8000U, 7500U, 2000U),
+        test_result(8000U, 7200U, 2000U),
+    };
+
+    /* The first of equal commands stays. */
+    EXPECT_EQ(1U, app_qspi_bench_select(results, 4U));
+}
+
+TEST(TestAppQspiBench, SkipsInvalidCommands)
+{
+    app_qspi_bench_result_t results[] =
+    {
+        test_result(4000U, 4000U, 3000U),
+        test_result(64000U, 60000U, 100U),
+        test_result(0U, 0U, 0U),
+    };
+
+    results[1].valid = false;
+    EXPECT_EQ(0U, app_qspi_bench_select(results, 3U));
+
+    /* None valid: the generated command stays. */
+    results[0].valid = false;
+    results[2].valid = false;
+    EXPECT_EQ(0U, app_qspi_bench_select(results, 3U));
+}
+
+TEST(TestAppQspiBench, SameCommand)
+{
+    cy_stc_smif_mem_cmd_t cmd = test_quad_io;
+
+    EXPECT_TRUE(app_qspi_bench_same_cmd(&cmd, &test_quad_io));
+    EXPECT_FALSE(app_qspi_bench_same_cmd(&test_fast_read, &test_quad_io));
+
+    /* The dummy cycles of another latency code. */
+    cmd.dummyCycles = 8U;
+    EXPECT_FALSE(app_qspi_bench_same_cmd(&cmd, &test_quad_io));
+
+    /* The continuous read mode byte. */
+    cmd = test_quad_io;
+    cmd.mode = 0xA0U;
+    EXPECT_FALSE(app_qspi_bench_same_cmd(&cmd, &test_quad_io));
+
+    /* The width of an absent mode byte does not matter. */
+    cmd = test_fast_read;
+    cmd.modeWidth = CY_SMIF_WIDTH_QUAD;
+    EXPECT_TRUE(app_qspi_bench_same_cmd(&cmd, &test_fast_read));
+}
+
+TEST(TestAppQspiBench, RandomBenchmarksLog)
+{
+    static const uint32_t xip_kbps[] = { 0U, 2000U, 4000U, 8000U, 16000U };
+    static const uint32_t dma_kbps[] = { 0U, 3000U, 6000U };
+    static const uint32_t latency_ns[] = { 0U, 1000U, 2000U, 66000U };
+    std::mt19937 rng(1);
+    FILE *log = fopen(TEST_LOG_FILE, "w");
+
+    ASSERT_NE((FILE *)NULL, log);
+
+    /* Few distinct values, so that costs tie often. */
+    for (uint32_t bench = 0; bench < TEST_BENCHMARKS; bench++)
+    {
+        app_qspi_bench_result_t results[TEST_MODES];
+        uint8_t best;
+
+        for (uint8_t i = 0; i < TEST_MODES; i++)
+        {
+            results[i] = test_result(xip_kbps[rng() % 5U], dma_kbps[rng() % 3U],
+                                     latency_ns[rng() % 4U]);
+            results[i].valid = (0U != (rng() % 4U));
+            if (TEST_GENERATED_DUP == i)
+            {
+                memset(&results[i], 0, sizeof(results[i]));
+                fprintf(log, "QSPI bench: %s is the generated command\n", test_names[i]);
+            }
+            else if (!results[i].valid)
+            {
+                fprintf(log, "QSPI bench: %s fails the read check\n", test_names[i]);
+            }
+            else
+            {
+                fprintf(log, "QSPI bench: %s xip %u kB/s, dma %u kB/s, latency %u ns, cost %u ns\n",
+                        test_names[i], results[i].xip_kbps, results[i].dma_kbps,
+                        results[i].latency_ns, app_qspi_bench_cost_ns(&results[i]));
+            }
+        }
+
+        best = app_qspi_bench_select(results, TEST_MODES);
+        ASSERT_NE(TEST_GENERATED_DUP, best);
+        fprintf(log, "QSPI bench: selected %s\n", test_names[best]);
+    }
+
+    EXPECT_EQ(0, fclose(log));
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,10 @@
+# Read command selection of the QSPI benchmark, and a console log of random
+# benchmarks for the cross-check of tools/qspi_bench.py.
+
+set(unittest-sources
+    ${APP_SOURCE}/app_qspi_bench_select.cpp
+)
+
+set(unittest-test-sources
+    app_qspi_bench/test_app_qspi_bench.cpp
+)
@@ -0,0 +1,175 @@
+/******************************************************************************
+ * File Name: test_app_stats.cpp
+ *
+ * Description:
+ *   Unit tests of the wake period statistics of source/app_stats.cpp. The
+ *   test drives the offload manager hook with synthetic WLAN host driver and
+ *   SDIO bus counters and checks the attribution of each period to its wake
+ *   reason.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "gtest/gtest.h"
+#include "app_stats.h"
+#include "app_olm.h"
+#include "whd_emac.h"
+#include "whd_int.h"
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+static app_olm_hook_t test_hook = NULL;
+static app_bus_stats_t test_bus;
+static struct whd_driver test_driver;
+static struct whd_interface test_ifp = { &test_driver };
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/* The offload manager, the EMAC and the SDIO bus counters of the kit. */
+cy_rslt_t app_olm_add_hook(app_olm_hook_t hook)
+{
+    test_hook = hook;
+    return CY_RSLT_SUCCESS;
+}
+
+WHD_EMAC &WHD_EMAC::get_instance()
+{
+    static WHD_EMAC emac;
+    return emac;
+}
+
+bool app_sdio_trace_get(app_bus_stats_t *stats)
+{
+    *stats = test_bus;
+    return true;
+}
+
+cy_rslt_t app_sdio_profile_init(void)
+{
+    return CY_RSLT_SUCCESS;
+}
+
+bool app_sdio_profile_get_last(app_sdio_profile_t *profile)
+{
+    (void)profile;
+    return false;
+}
+
+void app_sdio_profile_print(const app_sdio_profile_t *profile)
+{
+    (void)profile;
+}
+
+void app_sdio_profile_dump(void)
+{
+}
+
+/* One wake period: the sleep, the wake with or without a host wake
+ * interrupt, and the activity until the next suspend.
+ */
+static void test_cycle(uint32_t sleep_ms, bool wlan, uint32_t awake_ms, uint32_t rx,
+                       uint32_t tx, uint32_t cmd53)
+{
+    mbed_host_clock_advance_ms(sleep_ms);
+    if (wlan)
+    {
+        test_bus.oob_intrs++;
+    }
+    test_hook(false);
+
+    mbed_host_clock_advance_ms(awake_ms);
+    test_driver.whd_stats.rx_total += rx;
+    test_driver.whd_stats.tx_total += tx;
+    test_bus.cmd53_read += cmd53;
+    test_hook(true);
+}
+
+TEST(TestAppStats, AttributesEachWakeToItsReason)
+{
+    app_stats_cycle_t cycle;
+    app_stats_reason_t wlan;
+    app_stats_reason_t host;
+    app_stats_reason_t unknown;
+
+    WHD_EMAC::get_instance().ifp = &test_ifp;
+    ASSERT_EQ(CY_RSLT_SUCCESS, app_stats_init());
+    ASSERT_NE((app_olm_hook_t)NULL, test_hook);
+
+    /* The first suspend closes no period. */
+    test_hook(true);
+    EXPECT_FALSE(app_stats_get_last_cycle(&cycle));
+
+    test_cycle(1000U, true, 40U, 3U, 1U, 5U);
+    ASSERT_TRUE(app_stats_get_last_cycle(&cycle));
+    EXPECT_EQ(1U, cycle.cycle);
+    EXPECT_EQ(APP_WAKE_REASON_WLAN, cycle.reason);
+    EXPECT_EQ(1000U, cycle.sleep_ms);
+    EXPECT_EQ(40U, cycle.delta.time_ms);
+    EXPECT_EQ(3U, cycle.delta.whd.rx_total);
+    EXPECT_EQ(5U, cycle.delta.bus.cmd53_read);
+
+    test_cycle(500U, false, 10U, 0U, 2U, 1U);
+    ASSERT_TRUE(app_stats_get_last_cycle(&cycle));
+    EXPECT_EQ(APP_WAKE_REASON_HOST, cycle.reason);
+
+    test_cycle(2000U, true, 60U, 7U, 2U, 9U);
+
+    app_stats_get_reason(APP_WAKE_REASON_WLAN, &wlan);
+    app_stats_get_reason(APP_WAKE_REASON_HOST, &host);
+    app_stats_get_reason(APP_WAKE_REASON_UNKNOWN, &unknown);
+
+    EXPECT_EQ(2U, wlan.cycles);
+    EXPECT_EQ(3000U, wlan.sleep_ms);
+    EXPECT_EQ(100U, wlan.total.time_ms);
+    EXPECT_EQ(10U, wlan.total.whd.rx_total);
+    EXPECT_EQ(3U, wlan.total.whd.tx_total);
+    EXPECT_EQ(14U, wlan.total.bus.cmd53_read);
+
+    EXPECT_EQ(1U, host.cycles);
+    EXPECT_EQ(500U, host.sleep_ms);
+    EXPECT_EQ(10U, host.total.time_ms);
+    EXPECT_EQ(0U, host.total.whd.rx_total);
+    EXPECT_EQ(2U, host.total.whd.tx_total);
+    EXPECT_EQ(1U, host.total.bus.cmd53_read);
+
+    EXPECT_EQ(0U, unknown.cycles);
+
+    /* Runs through the log stub, which drops the lines. */
+    app_stats_print_summary();
+}
+
+
+/* [] END OF FILE */
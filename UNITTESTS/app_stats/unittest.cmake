@@ -0,0 +1,16 @@
+# Wake periods attributed to their reason from synthetic WLAN and bus
+# counters.
+
+set(unittest-sources
+    ${APP_SOURCE}/app_stats.cpp
+    ${APP_STUBS}/mbed_stub.cpp
+    ${APP_STUBS}/app_log_stub.cpp
+)
+
+set(unittest-test-sources
+    app_stats/test_app_stats.cpp
+)
+
+set(unittest-definitions
+    APP_SDIO_TRACE_ENABLED=1
+)
@@ -0,0 +1,290 @@
+/******************************************************************************
+ * File Name: test_app_wl_connect.cpp
+ *
+ * Description:
+ *   Host unit tests of the asynchronous connect API of
+ *   source/app_wl_connect.cpp against the simulated WLAN interface, with
+ *   injected association delays and failures.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "app_wl_connect.h"
+#include "app_host_stubs.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+/* Longest wait for a completion in the tests. */
+#define TEST_DONE_TIMEOUT_MS       (2000)
+
+/* Threads requesting a connect at the same time. */
+#define TEST_CONCURRENT_CALLERS    (8U)
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+/* Completions delivered by the connect worker. */
+static std::mutex done_mutex;
+static std::condition_variable done_cond;
+static uint32_t done_count;
+static app_wl_conn_info_t done_info;
+static std::thread::id done_thread;
+static bool done_while_connecting;
+
+static WhdSTAInterface *test_wifi;
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+static void test_done_cb(const app_wl_conn_info_t *info)
+{
+    std::lock_guard<std::mutex> lock(done_mutex);
+
+    done_info = *info;
+    done_thread = std::this_thread::get_id();
+    done_while_connecting = test_wifi->sim_connecting;
+    done_count++;
+    done_cond.notify_all();
+}
+
+/* Waits for a number of completions and for the worker to return from the
+ * last one, a new request is only accepted after that.
+ */
+static bool test_wait_done(uint32_t count)
+{
+    std::unique_lock<std::mutex> lock(done_mutex);
+
+    if (!done_cond.wait_for(lock, std::chrono::milliseconds(TEST_DONE_TIMEOUT_MS),
+                            [count] { return done_count >= count; }))
+    {
+        return false;
+    }
+    lock.unlock();
+
+    return rtos::Thread::host_wait_idle(TEST_DONE_TIMEOUT_MS);
+}
+
+class TestAppWlConnect : public testing::Test
+{
+protected:
+    void SetUp()
+    {
+        test_wifi = &wifi;
+        done_count = 0;
+        done_info = app_wl_conn_info_t();
+        rtos::Thread::host_start_failures = 0;
+        app_net_info_attach(&wifi);
+        app_net_info_invalidate();
+    }
+
+    void TearDown()
+    {
+        /* Leave no worker running into the next test. */
+        EXPECT_TRUE(test_wait_done(expected_done));
+        EXPECT_EQ(expected_done, done_count);
+        EXPECT_EQ(0, app_dvfs_host_refs());
+    }
+
+    WhdSTAInterface wifi;
+    uint32_t expected_done = 0;
+};
+
+TEST_F(TestAppWlConnect, returns_before_the_association_completes)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    wifi.sim_connect_delay_ms = 300;
+    ASSERT_EQ(CY_RSLT_SUCCESS, app_wl_connect_async(&wifi, "ssid", "pwd",
+                                                    NSAPI_SECURITY_WPA2,
+                                                    test_done_cb));
+    expected_done = 1;
+
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+    EXPECT_EQ(0U, done_count);
+
+    ASSERT_TRUE(test_wait_done(1));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(300));
+    EXPECT_NE(std::this_thread::get_id(), done_thread);
+    EXPECT_EQ(done_thread, wifi.sim_connect_thread);
+    EXPECT_FALSE(done_while_connecting);
+}
+
+TEST_F(TestAppWlConnect, delivers_one_snapshot_of_the_link)
+{
+    ASSERT_EQ(CY_RSLT_SUCCESS, app_wl_connect_async(&wifi, "ssid", "pwd",
+                                                    NSAPI_SECURITY_WPA2,
+                                                    test_done_cb));
+    expected_done = 1;
+    ASSERT_TRUE(test_wait_done(1));
+
+    EXPECT_EQ(CY_RSLT_SUCCESS, done_info.result);
+    EXPECT_STREQ(wifi.sim_mac, done_info.net.mac);
+    EXPECT_STREQ(wifi.sim_ip, done_info.net.ip.get_ip_address());
+    EXPECT_STREQ(wifi.sim_netmask, done_info.net.netmask.get_ip_address());
+    EXPECT_STREQ(wifi.sim_gateway, done_info.net.gateway.get_ip_address());
+    EXPECT_EQ(wifi.sim_rssi, done_info.net.rssi);
+    EXPECT_EQ(1U, wifi.sim_calls.connect);
+    EXPECT_EQ(1U, wifi.sim_calls.get_rssi);
+}
+
+TEST_F(TestAppWlConnect, reports_an_association_failure)
+{
+    wifi.sim_connect_delay_ms = 50;
+    wifi.sim_connect_result = NSAPI_ERROR_AUTH_FAILURE;
+    ASSERT_EQ(CY_RSLT_SUCCESS, app_wl_connect_async(&wifi, "ssid", "bad",
+                                                    NSAPI_SECURITY_WPA2,
+                                                    test_done_cb));
+    expected_done = 1;
+    ASSERT_TRUE(test_wait_done(1));
+
+    EXPECT_EQ(CY_RSLT_TYPE_ERROR, done_info.result);
+    EXPECT_EQ(0U, wifi.sim_calls.get_ip_address);
+}
+
+TEST_F(TestAppWlConnect, reports_a_link_without_address)
+{
+    wifi.sim_ip_result = NSAPI_ERROR_DHCP_FAILURE;
+    ASSERT_EQ(CY_RSLT_SUCCESS, app_wl_connect_async(&wifi, "ssid", "pwd",
+                                                    NSAPI_SECURITY_WPA2,
+                                                    test_done_cb));
+    expected_done = 1;
+    ASSERT_TRUE(test_wait_done(1));
+
+    EXPECT_EQ(CY_RSLT_TYPE_ERROR, done_info.result);
+}
+
+TEST_F(TestAppWlConnect, rejects_a_second_request_in_progress)
+{
+    wifi.sim_connect_delay_ms = 200;
+    ASSERT_EQ(CY_RSLT_SUCCESS, app_wl_connect_async(&wifi, "ssid", "pwd",
+                                                    NSAPI_SECURITY_WPA2,
+                                                    test_done_cb));
+    expected_done = 1;
+
+    EXPECT_EQ(CY_RSLT_TYPE_ERROR, app_wl_connect_async(&wifi, "ssid", "pwd",
+                                                       NSAPI_SECURITY_WPA2,
+                                                       test_done_cb));
+    ASSERT_TRUE(test_wait_done(1));
+    EXPECT_EQ(1U, wifi.sim_calls.connect);
+}
+
+TEST_F(TestAppWlConnect, accepts_a_request_after_the_completion)
+{
+    wifi.sim_connect_result = NSAPI_ERROR_NO_SSID;
+    ASSERT_EQ(CY_RSLT_SUCCESS, app_wl_connect_async(&wifi, "ssid", "pwd",
+                                                    NSAPI_SECURITY_WPA2,
+                                                    test_done_cb));
+    ASSERT_TRUE(test_wait_done(1));
+    EXPECT_EQ(CY_RSLT_TYPE_ERROR, done_info.result);
+
+    wifi.sim_connect_result = NSAPI_ERROR_OK;
+    ASSERT_EQ(CY_RSLT_SUCCESS, app_wl_connect_async(&wifi, "ssid", "pwd",
+                                                    NSAPI_SECURITY_WPA2,
+                                                    test_done_cb));
+    expected_done = 2;
+    ASSERT_TRUE(test_wait_done(2));
+    EXPECT_EQ(CY_RSLT_SUCCESS, done_info.result);
+    EXPECT_EQ(2U, wifi.sim_calls.connect);
+}
+
+TEST_F(TestAppWlConnect, rejects_bad_arguments)
+{
+    EXPECT_EQ(CY_RSLT_TYPE_ERROR, app_wl_connect_async(NULL, "ssid", "pwd",
+                                                       NSAPI_SECURITY_WPA2,
+                                                       test_done_cb));
+    EXPECT_EQ(CY_RSLT_TYPE_ERROR, app_wl_connect_async(&wifi, NULL, "pwd",
+                                                       NSAPI_SECURITY_WPA2,
+                                                       test_done_cb));
+    EXPECT_EQ(CY_RSLT_TYPE_ERROR, app_wl_connect_async(&wifi, "ssid", NULL,
+                                                       NSAPI_SECURITY_WPA2,
+                                                       test_done_cb));
+    EXPECT_EQ(CY_RSLT_TYPE_ERROR, app_wl_connect_async(&wifi, "ssid", "pwd",
+                                                       NSAPI_SECURITY_WPA2,
+                                                       nullptr));
+    EXPECT_EQ(0U, wifi.sim_calls.connect);
+}
+
+TEST_F(TestAppWlConnect, fails_if_the_worker_does_not_start)
+{
+    rtos::Thread::host_start_failures = 1;
+    EXPECT_EQ(CY_RSLT_TYPE_ERROR, app_wl_connect_async(&wifi, "ssid", "pwd",
+                                                       NSAPI_SECURITY_WPA2,
+                                                       test_done_cb));
+    EXPECT_EQ(0U, wifi.sim_calls.connect);
+
+    /* The failed start leaves no request in progress. */
+    ASSERT_EQ(CY_RSLT_SUCCESS, app_wl_connect_async(&wifi, "ssid", "pwd",
+                                                    NSAPI_SECURITY_WPA2,
+                                                    test_done_cb));
+    expected_done = 1;
+    ASSERT_TRUE(test_wait_done(1));
+}
+
+TEST_F(TestAppWlConnect, accepts_one_of_concurrent_requests)
+{
+    std::atomic<uint32_t> started{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> callers;
+
+    wifi.sim_connect_delay_ms = 200;
+    for (uint32_t i = 0; i < TEST_CONCURRENT_CALLERS; i++)
+    {
+        callers.emplace_back([this, &started, &go] {
+            while (!go)
+            {
+            }
+            if (CY_RSLT_SUCCESS == app_wl_connect_async(&wifi, "ssid", "pwd",
+                                                        NSAPI_SECURITY_WPA2,
+                                                        test_done_cb))
+            {
+                started++;
+            }
+        });
+    }
+    go = true;
+    for (std::thread &caller : callers)
+    {
+        caller.join();
+    }
+
+    EXPECT_EQ(1U, started.load());
+    expected_done = 1;
+    ASSERT_TRUE(test_wait_done(1));
+    EXPECT_EQ(1U, wifi.sim_calls.connect);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,14 @@
+# Asynchronous connect against the simulated WLAN interface.
+
+set(unittest-sources
+    ${APP_SOURCE}/app_wl_connect.cpp
+    ${APP_SOURCE}/app_net_info.cpp
+    ${APP_STUBS}/mbed_stub.cpp
+    ${APP_STUBS}/WhdSTAInterface_stub.cpp
+    ${APP_STUBS}/app_log_stub.cpp
+    ${APP_STUBS}/app_dvfs_stub.cpp
+)
+
+set(unittest-test-sources
+    app_wl_connect/test_app_wl_connect.cpp
+)
@@ -0,0 +1,113 @@
+/******************************************************************************
+ * File Name: WhdSTAInterface.h
+ *
+ * Description:
+ *   Host simulator of the WLAN station interface. Every query can be
+ *   delayed and made to fail, and the number of queries is counted, so the
+ *   connect and network-info code can be tested without a radio.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef WHD_STA_INTERFACE_H
+#define WHD_STA_INTERFACE_H
+
+#include "mbed.h"
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+/* Calls made to the interface. */
+typedef struct
+{
+    uint32_t connect;
+    uint32_t get_mac_address;
+    uint32_t get_netmask;
+    uint32_t get_gateway;
+    uint32_t get_ip_address;
+    uint32_t get_rssi;
+} whd_sta_sim_calls_t;
+
+class WhdSTAInterface
+{
+public:
+    WhdSTAInterface() = default;
+    virtual ~WhdSTAInterface() = default;
+
+    nsapi_error_t connect(const char *ssid, const char *pass,
+                          nsapi_security_t security = NSAPI_SECURITY_NONE,
+                          uint8_t channel = 0);
+    const char *get_mac_address();
+    nsapi_error_t get_netmask(SocketAddress *address);
+    nsapi_error_t get_gateway(SocketAddress *address);
+    nsapi_error_t get_ip_address(SocketAddress *address);
+    int8_t get_rssi();
+    void add_event_listener(mbed::Callback<void(nsapi_event_t, intptr_t)> status_cb);
+
+    /* Simulator control. */
+    void sim_set_link_event(nsapi_connection_status_t status);
+
+    /* Duration of the association and of each query. */
+    uint32_t sim_connect_delay_ms = 0;
+    uint32_t sim_query_delay_ms = 0;
+
+    /* Results injected into the next calls. */
+    nsapi_error_t sim_connect_result = NSAPI_ERROR_OK;
+    nsapi_error_t sim_ip_result = NSAPI_ERROR_OK;
+
+    /* Link parameters reported after the association. */
+    const char *sim_mac = "00:a0:50:01:02:03";
+    const char *sim_ip = "192.168.1.42";
+    const char *sim_netmask = "255.255.255.0";
+    const char *sim_gateway = "192.168.1.1";
+    int8_t sim_rssi = -48;
+
+    /* Thread of the last association, and whether it was still running when
+     * the call completed.
+     */
+    std::thread::id sim_connect_thread;
+    std::atomic<bool> sim_connecting{false};
+
+    whd_sta_sim_calls_t sim_calls = {};
+
+private:
+    void sim_delay(uint32_t ms);
+
+    mbed::Callback<void(nsapi_event_t, intptr_t)> _status_cb;
+};
+
+#endif /* WHD_STA_INTERFACE_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,132 @@
+/******************************************************************************
+ * File Name: WhdSTAInterface_stub.cpp
+ *
+ * Description:
+ *   Host simulator of the WLAN station interface.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "WhdSTAInterface.h"
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+void WhdSTAInterface::sim_delay(uint32_t ms)
+{
+    if (0U != ms)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    }
+}
+
+nsapi_error_t WhdSTAInterface::connect(const char *ssid, const char *pass,
+                                       nsapi_security_t security, uint8_t channel)
+{
+    (void)ssid;
+    (void)pass;
+    (void)security;
+    (void)channel;
+
+    sim_calls.connect++;
+    sim_connect_thread = std::this_thread::get_id();
+    sim_connecting = true;
+    sim_delay(sim_connect_delay_ms);
+    sim_connecting = false;
+
+    if (NSAPI_ERROR_OK == sim_connect_result)
+    {
+        sim_set_link_event(NSAPI_STATUS_GLOBAL_UP);
+    }
+    return sim_connect_result;
+}
+
+const char *WhdSTAInterface::get_mac_address()
+{
+    sim_calls.get_mac_address++;
+    sim_delay(sim_query_delay_ms);
+    return sim_mac;
+}
+
+nsapi_error_t WhdSTAInterface::get_netmask(SocketAddress *address)
+{
+    sim_calls.get_netmask++;
+    sim_delay(sim_query_delay_ms);
+    address->set_ip_address(sim_netmask);
+    return NSAPI_ERROR_OK;
+}
+
+nsapi_error_t WhdSTAInterface::get_gateway(SocketAddress *address)
+{
+    sim_calls.get_gateway++;
+    sim_delay(sim_query_delay_ms);
+    address->set_ip_address(sim_gateway);
+    return NSAPI_ERROR_OK;
+}
+
+nsapi_error_t WhdSTAInterface::get_ip_address(SocketAddress *address)
+{
+    sim_calls.get_ip_address++;
+    sim_delay(sim_query_delay_ms);
+    if (NSAPI_ERROR_OK != sim_ip_result)
+    {
+        address->set_ip_address(nullptr);
+        return sim_ip_result;
+    }
+    address->set_ip_address(sim_ip);
+    return NSAPI_ERROR_OK;
+}
+
+int8_t WhdSTAInterface::get_rssi()
+{
+    sim_calls.get_rssi++;
+    sim_delay(sim_query_delay_ms);
+    return sim_rssi;
+}
+
+void WhdSTAInterface::add_event_listener(mbed::Callback<void(nsapi_event_t, intptr_t)> status_cb)
+{
+    _status_cb = status_cb;
+}
+
+void WhdSTAInterface::sim_set_link_event(nsapi_connection_status_t status)
+{
+    if (_status_cb)
+    {
+        _status_cb(NSAPI_EVENT_CONNECTION_STATUS_CHANGE, (intptr_t)status);
+    }
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,88 @@
+/******************************************************************************
+ * File Name: app_dvfs_stub.cpp
+ *
+ * Description:
+ *   Host replacement of source/app_dvfs.cpp, counts the boost requests.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "app_dvfs.h"
+#include "app_host_stubs.h"
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+static std::atomic<int32_t> dvfs_refs{0};
+static app_dvfs_stats_t dvfs_stats;
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+cy_rslt_t app_dvfs_init(void)
+{
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t app_dvfs_request(void)
+{
+    if (0 == dvfs_refs++)
+    {
+        dvfs_stats.boosts++;
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+void app_dvfs_release(void)
+{
+    dvfs_refs--;
+}
+
+uint32_t app_dvfs_get_hz(void)
+{
+    return (0 < dvfs_refs) ? 100000000UL : 50000000UL;
+}
+
+void app_dvfs_get_stats(app_dvfs_stats_t *stats)
+{
+    *stats = dvfs_stats;
+}
+
+int32_t app_dvfs_host_refs(void)
+{
+    return dvfs_refs;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,91 @@
+/******************************************************************************
+ * File Name: app_host_stubs.h
+ *
+ * Description:
+ *   Control functions of the host replacements of application modules.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef APP_HOST_STUBS_H
+#define APP_HOST_STUBS_H
+
+#include "mbed.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#define APP_XIP_HOST_MAX_PAGES     (256U)
+#define APP_XIP_HOST_MAX_SECTORS   (32U)
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+/* State of a program page of the flash of app_xip_stub.cpp. */
+typedef enum
+{
+    APP_XIP_HOST_BLANK = 0,   /* Erased, or never written */
+    APP_XIP_HOST_WRITTEN,     /* Programmed completely */
+    APP_XIP_HOST_TORN,        /* Program or erase cut by a power loss */
+} app_xip_host_page_t;
+
+/* Bookkeeping of the flash, shared with the child processes. */
+typedef struct
+{
+    uint32_t ops;             /* Erases and programs so far */
+    uint32_t loss_op;         /* Operation cut by a power loss, UINT32_MAX for none */
+    uint32_t loss_bytes;      /* Bytes done before the loss, modulo the length */
+    uint32_t losses;          /* Power losses so far */
+    uint32_t overwrites;      /* Programs of memory which was not blank */
+    uint32_t sector_erases[APP_XIP_HOST_MAX_SECTORS];
+    uint8_t  page_state[APP_XIP_HOST_MAX_PAGES];
+} app_xip_host_ctrl_t;
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+/* Boost requests of app_dvfs_request() not yet released. */
+int32_t app_dvfs_host_refs(void);
+
+/* Creates the blank flash of app_xip_stub.cpp. A power loss ends the
+ * process at once, with _exit(), like a reset of the kit.
+ */
+void app_xip_host_create(uint32_t mem_size, uint32_t erase_size, uint32_t program_size);
+app_xip_host_ctrl_t *app_xip_host_ctrl(void);
+const uint8_t *app_xip_host_flash(void);
+
+#endif /* APP_HOST_STUBS_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,94 @@
+/******************************************************************************
+ * File Name: app_log_stub.cpp
+ *
+ * Description:
+ *   Host replacement of source/app_log.cpp. Log lines are printed
+ *   directly, the deferred log is not used in the host build.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "app_log.h"
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+uint8_t app_log_runtime_level[APP_LOG_MODULE_COUNT] =
+{
+    APP_LOG_LEVEL_MAIN,
+    APP_LOG_LEVEL_WIFI,
+    APP_LOG_LEVEL_STATS,
+    APP_LOG_LEVEL_POWER,
+};
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+void app_log_init(void)
+{
+}
+
+void app_log_set_level(uint8_t module, uint8_t level)
+{
+    if (APP_LOG_MODULE_COUNT > module)
+    {
+        app_log_runtime_level[module] = level;
+    }
+}
+
+void app_log_kick(void)
+{
+}
+
+void app_log_flush(void)
+{
+    fflush(stdout);
+}
+
+uint32_t app_log_get_dropped(void)
+{
+    return 0;
+}
+
+void app_log_write(uint32_t id, const uint32_t *args, uint8_t nargs,
+                   uint8_t str_mask)
+{
+    (void)id;
+    (void)args;
+    (void)nargs;
+    (void)str_mask;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,209 @@
+/******************************************************************************
+ * File Name: app_xip_stub.cpp
+ *
+ * Description:
+ *   Host replacement of source/app_xip.cpp: a NOR flash in a file mapped
+ *   shared, so that it survives the child processes of a test, with power
+ *   losses injected into its erases and programs.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "app_xip.h"
+#include "app_host_stubs.h"
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+/* Flash contents and the bookkeeping of app_xip_host_ctrl_t, both in shared
+ * mappings created by app_xip_host_create().
+ */
+static uint8_t *xip_flash = NULL;
+static app_xip_host_ctrl_t *xip_ctrl = NULL;
+static cy_stc_smif_mem_device_cfg_t xip_device;
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/* Counts an erase or program and cuts the power if it is the selected one.
+ * The part of the operation done before the loss is applied first.
+ */
+static void app_xip_host_step(uint32_t offset, uint32_t length, bool erase,
+                              const uint8_t *data)
+{
+    if (xip_ctrl->ops++ != xip_ctrl->loss_op)
+    {
+        return;
+    }
+
+    uint32_t done = xip_ctrl->loss_bytes % length;
+
+    for (uint32_t i = 0; i < done; i++)
+    {
+        xip_flash[offset + i] = erase ? 0xFFU : (uint8_t)(xip_flash[offset + i] & data[i]);
+    }
+    for (uint32_t page = offset / xip_device.programSize;
+         page < (offset + length) / xip_device.programSize; page++)
+    {
+        xip_ctrl->page_state[page] = APP_XIP_HOST_TORN;
+    }
+    xip_ctrl->losses++;
+    _exit(0);
+}
+
+void app_xip_host_create(uint32_t mem_size, uint32_t erase_size, uint32_t program_size)
+{
+    FILE *file = tmpfile();
+
+    MBED_ASSERT((NULL != file) && (0 == ftruncate(fileno(file), mem_size)));
+    MBED_ASSERT((mem_size / program_size) <= APP_XIP_HOST_MAX_PAGES);
+    MBED_ASSERT((mem_size / erase_size) <= APP_XIP_HOST_MAX_SECTORS);
+    xip_flash = (uint8_t *)mmap(NULL, mem_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                                fileno(file), 0);
+    xip_ctrl = (app_xip_host_ctrl_t *)mmap(NULL, sizeof(*xip_ctrl), PROT_READ | PROT_WRITE,
+                                           MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    MBED_ASSERT((MAP_FAILED != xip_flash) && (MAP_FAILED != xip_ctrl));
+
+    /* The mapping keeps the file, which is deleted once unmapped. */
+    fclose(file);
+
+    memset(xip_flash, 0xFF, mem_size);
+    memset(xip_ctrl, 0, sizeof(*xip_ctrl));
+    xip_ctrl->loss_op = UINT32_MAX;
+
+    memset(&xip_device, 0, sizeof(xip_device));
+    xip_device.memSize = mem_size;
+    xip_device.eraseSize = erase_size;
+    xip_device.programSize = program_size;
+}
+
+app_xip_host_ctrl_t *app_xip_host_ctrl(void)
+{
+    return xip_ctrl;
+}
+
+const uint8_t *app_xip_host_flash(void)
+{
+    return xip_flash;
+}
+
+cy_rslt_t app_xip_init(void)
+{
+    return CY_RSLT_SUCCESS;
+}
+
+bool app_xip_is_mapped(void)
+{
+    return (NULL != xip_flash);
+}
+
+const cy_stc_smif_mem_device_cfg_t *app_xip_get_device(void)
+{
+    return &xip_device;
+}
+
+cy_rslt_t app_xip_read(uint32_t offset, void *data, uint32_t length)
+{
+    if ((offset > xip_device.memSize) || (length > (xip_device.memSize - offset)))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    memcpy(data, &xip_flash[offset], length);
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t app_xip_erase(uint32_t offset, uint32_t length)
+{
+    if ((0U != (offset % xip_device.eraseSize)) || (0U != (length % xip_device.eraseSize)) ||
+        ((offset + length) > xip_device.memSize))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    app_xip_host_step(offset, length, true, NULL);
+    memset(&xip_flash[offset], 0xFF, length);
+    for (uint32_t sector = offset / xip_device.eraseSize;
+         sector < (offset + length) / xip_device.eraseSize; sector++)
+    {
+        xip_ctrl->sector_erases[sector]++;
+    }
+    for (uint32_t page = offset / xip_device.programSize;
+         page < (offset + length) / xip_device.programSize; page++)
+    {
+        xip_ctrl->page_state[page] = APP_XIP_HOST_BLANK;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t app_xip_write(uint32_t offset, const void *data, uint32_t length)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+
+    if ((0U != (offset % xip_device.programSize)) || (0U != (length % xip_device.programSize)) ||
+        ((offset + length) > xip_device.memSize))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+        if (0xFFU != xip_flash[offset + i])
+        {
+            xip_ctrl->overwrites++;
+            break;
+        }
+    }
+
+    app_xip_host_step(offset, length, false, bytes);
+    for (uint32_t i = 0; i < length; i++)
+    {
+        xip_flash[offset + i] &= bytes[i];
+    }
+    for (uint32_t page = offset / xip_device.programSize;
+         page < (offset + length) / xip_device.programSize; page++)
+    {
+        xip_ctrl->page_state[page] = APP_XIP_HOST_WRITTEN;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,73 @@
+/******************************************************************************
+ * File Name: cy_OlmInterface.h
+ *
+ * Description:
+ *   Host build replacement of the offload manager of the Low Power Assistant.
+ *   It initializes the offloads of its list and moves them between their
+ *   sleep and wake configurations.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef CY_OLM_INTERFACE_H
+#define CY_OLM_INTERFACE_H
+
+#include "mbed.h"
+#include "cy_lpa_wifi_ol.h"
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+class CyOlmInterface
+{
+public:
+    CyOlmInterface(ol_desc_t *list = NULL) : _list(list) {}
+    virtual ~CyOlmInterface() = default;
+
+    virtual int init_ols(void *whd, void *ip);
+    virtual void deinit_ols(void);
+    virtual int sleep();
+    virtual int wake();
+
+private:
+    void pm(ol_pm_st_t st);
+
+    ol_desc_t *_list;
+    ol_info_t _info = {};
+};
+
+#endif /* CY_OLM_INTERFACE_H */
+
+
+/* [] END OF FILE */
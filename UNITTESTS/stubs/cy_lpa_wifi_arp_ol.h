@@ -0,0 +1,87 @@
+/******************************************************************************
+ * File Name: cy_lpa_wifi_arp_ol.h
+ *
+ * Description:
+ *   Host build replacement of the ARP offload of the Low Power Assistant,
+ *   implemented by the WLAN simulator of lpa_sim_stub.cpp.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef CY_LPA_WIFI_ARP_OL_H
+#define CY_LPA_WIFI_ARP_OL_H
+
+#include "cy_lpa_wifi_ol.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#define ARP_OL_AGENT               (0x00000001)
+#define ARP_OL_SNOOP               (0x00000002)
+#define ARP_OL_HOST_AUTO_REPLY     (0x00000004)
+#define ARP_OL_PEER_AUTO_REPLY     (0x00000008)
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+typedef struct arp_ol_cfg
+{
+    uint32_t awake_enable_mask;
+    uint32_t sleep_enable_mask;
+    uint32_t peerage;
+} arp_ol_cfg_t;
+
+typedef struct arp_ol
+{
+    const arp_ol_cfg_t *config;
+    ol_info_t *info;
+} arp_ol_t;
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+extern const ol_fns_t arp_ol_fns;
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CY_LPA_WIFI_ARP_OL_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,94 @@
+/******************************************************************************
+ * File Name: cy_lpa_wifi_ol.h
+ *
+ * Description:
+ *   Host build replacement of the offload descriptor types of the Low Power
+ *   Assistant.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef CY_LPA_WIFI_OL_H
+#define CY_LPA_WIFI_OL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+typedef enum
+{
+    OL_PM_ST_GOING_TO_SLEEP,
+    OL_PM_ST_AWAKE,
+    OL_PM_ST_MAX,
+} ol_pm_st_t;
+
+typedef struct ol_info
+{
+    void *whd;
+    void *ip;
+} ol_info_t;
+
+typedef int (*ol_init_t)(void *ol, ol_info_t *info, const void *cfg);
+typedef void (*ol_deinit_t)(void *ol);
+typedef void (*ol_pm_t)(ol_pm_st_t st, void *ol);
+
+typedef struct ol_fns
+{
+    ol_init_t   init;
+    ol_deinit_t deinit;
+    ol_pm_t     pm;
+} ol_fns_t;
+
+typedef struct ol_desc
+{
+    const char      *name;
+    const void      *cfg;
+    const ol_fns_t  *fns;
+    void            *ol;
+} ol_desc_t;
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CY_LPA_WIFI_OL_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,123 @@
+/******************************************************************************
+ * File Name: cy_lpa_wifi_pf_ol.h
+ *
+ * Description:
+ *   Host build replacement of the packet filter offload of the Low Power
+ *   Assistant, implemented by the WLAN simulator of lpa_sim_stub.cpp.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef CY_LPA_WIFI_PF_OL_H
+#define CY_LPA_WIFI_PF_OL_H
+
+#include "cy_lpa_wifi_ol.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#define CY_PF_ACTIVE_SLEEP         (1U << 0)
+#define CY_PF_ACTIVE_WAKE          (1U << 1)
+#define CY_PF_ACTION_DISCARD       (1U << 2)
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+typedef enum
+{
+    CY_PF_OL_FEAT_PORTNUM = 1,
+    CY_PF_OL_FEAT_ETHTYPE,
+    CY_PF_OL_FEAT_IPTYPE,
+    CY_PF_OL_FEAT_LAST,
+} cy_pf_feature_t;
+
+typedef enum
+{
+    PF_PN_PORT_DEST,
+    PF_PN_PORT_SOURCE,
+} cy_pn_direction_t;
+
+typedef struct
+{
+    uint16_t portnum;
+    uint16_t range;
+    cy_pn_direction_t direction;
+} cy_pf_port_cfg_t;
+
+typedef struct
+{
+    uint16_t eth_type;
+} cy_pf_eth_cfg_t;
+
+typedef struct
+{
+    uint8_t ip_type;
+} cy_pf_ip_cfg_t;
+
+typedef struct cy_pf_ol_cfg
+{
+    cy_pf_feature_t feature;
+    uint32_t bits;
+    uint8_t id;
+    union
+    {
+        cy_pf_port_cfg_t port;
+        cy_pf_eth_cfg_t eth;
+        cy_pf_ip_cfg_t ip;
+    } u;
+} cy_pf_ol_cfg_t;
+
+typedef struct pf_ol
+{
+    const cy_pf_ol_cfg_t *cfg;
+    ol_info_t *info;
+} pf_ol_t;
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+extern const ol_fns_t pf_ol_fns;
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CY_LPA_WIFI_PF_OL_H */
+
+
+/* [] END OF FILE */
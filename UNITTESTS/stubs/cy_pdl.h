@@ -0,0 +1,105 @@
+/******************************************************************************
+ * File Name: cy_pdl.h
+ *
+ * Description:
+ *   Host build replacement of the parts of the peripheral driver library
+ *   referenced by the application headers.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef CY_PDL_H
+#define CY_PDL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+/* Placement sections only matter on the target. */
+#define CY_SECTION(name)
+#define CY_UNUSED_PARAMETER(x)     ((void)(x))
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+typedef enum
+{
+    CY_SMIF_WIDTH_SINGLE = 0U,
+    CY_SMIF_WIDTH_DUAL   = 1U,
+    CY_SMIF_WIDTH_QUAD   = 2U,
+    CY_SMIF_WIDTH_OCTAL  = 3U,
+    CY_SMIF_WIDTH_NA     = 0xFFFFFFFFU,
+} cy_en_smif_txfr_width_t;
+
+typedef struct
+{
+    uint32_t command;
+    cy_en_smif_txfr_width_t cmdWidth;
+    cy_en_smif_txfr_width_t addrWidth;
+    uint32_t mode;
+    cy_en_smif_txfr_width_t modeWidth;
+    uint32_t dummyCycles;
+    cy_en_smif_txfr_width_t dataWidth;
+} cy_stc_smif_mem_cmd_t;
+
+typedef struct
+{
+    uint32_t numOfAddrBytes;
+    uint32_t memSize;
+    cy_stc_smif_mem_cmd_t *readCmd;
+    cy_stc_smif_mem_cmd_t *writeEnCmd;
+    cy_stc_smif_mem_cmd_t *writeDisCmd;
+    cy_stc_smif_mem_cmd_t *eraseCmd;
+    uint32_t eraseSize;
+    cy_stc_smif_mem_cmd_t *chipEraseCmd;
+    cy_stc_smif_mem_cmd_t *programCmd;
+    uint32_t programSize;
+    cy_stc_smif_mem_cmd_t *readStsRegWipCmd;
+    cy_stc_smif_mem_cmd_t *readStsRegQeCmd;
+    cy_stc_smif_mem_cmd_t *writeStsRegQeCmd;
+    cy_stc_smif_mem_cmd_t *readSfdpCmd;
+    uint32_t stsRegBusyMask;
+    uint32_t stsRegQuadEnableMask;
+    uint32_t eraseTime;
+    uint32_t chipEraseTime;
+    uint32_t programTime;
+} cy_stc_smif_mem_device_cfg_t;
+
+#endif /* CY_PDL_H */
+
+
+/* [] END OF FILE */
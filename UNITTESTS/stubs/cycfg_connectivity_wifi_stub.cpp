@@ -0,0 +1,69 @@
+/******************************************************************************
+ * File Name: cycfg_connectivity_wifi_stub.cpp
+ *
+ * Description:
+ *   Host replacement of the generated cycfg_connectivity_wifi.c, the offload
+ *   list of design.modus: one packet filter discarding ICMP in both profiles.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "cy_lpa_wifi_pf_ol.h"
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+static pf_ol_t pf_ol_0;
+static cy_pf_ol_cfg_t cy_pf_ol_cfg_0[2];
+static ol_desc_t ol_list_0[2];
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+extern "C" const ol_desc_t *cycfg_get_default_ol_list(void)
+{
+    cy_pf_ol_cfg_0[0].feature = CY_PF_OL_FEAT_IPTYPE;
+    cy_pf_ol_cfg_0[0].bits = CY_PF_ACTIVE_SLEEP | CY_PF_ACTIVE_WAKE | CY_PF_ACTION_DISCARD;
+    cy_pf_ol_cfg_0[0].id = 0;
+    cy_pf_ol_cfg_0[0].u.ip.ip_type = 1;
+    cy_pf_ol_cfg_0[1].feature = CY_PF_OL_FEAT_LAST;
+
+    ol_list_0[0] = { "Pkt_Filter", cy_pf_ol_cfg_0, &pf_ol_fns, &pf_ol_0 };
+    ol_list_0[1] = { NULL, NULL, NULL, NULL };
+
+    return &ol_list_0[0];
+}
+
+
+/* [] END OF FILE */
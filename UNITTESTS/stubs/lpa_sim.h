@@ -0,0 +1,138 @@
+/******************************************************************************
+ * File Name: lpa_sim.h
+ *
+ * Description:
+ *   Host simulator of the WLAN offloads: packet filters, ARP offload and TCP
+ *   keepalive offload, as configured by the offload list of the application
+ *   and switched by the offload manager. Frames are classified into dropped by
+ *   the WLAN, answered by the WLAN or passed to the host, with a latency model
+ *   of the reply. A TCP model of the host network stack and of the peer checks
+ *   the keepalives sent by the WLAN while the host is suspended.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef LPA_SIM_H
+#define LPA_SIM_H
+
+#include "mbed.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+/* Latency model of a reply, in ms. The host wake time is the arp-ping
+ * measurement of the README without the reply time of an awake host.
+ */
+#define LPA_SIM_WLAN_REPLY_MS      (2)     /* Reply of the WLAN firmware */
+#define LPA_SIM_HOST_REPLY_MS      (5)     /* SDIO transfer and network stack */
+#define LPA_SIM_HOST_WAKE_MS       (1110)  /* Deep sleep exit and resume */
+
+#define LPA_SIM_ETH_TYPE_IPV4      (0x0800U)
+#define LPA_SIM_ETH_TYPE_ARP       (0x0806U)
+#define LPA_SIM_ETH_TYPE_EAPOL     (0x888EU)
+#define LPA_SIM_IP_PROTO_ICMP      (1U)
+#define LPA_SIM_IP_PROTO_TCP       (6U)
+#define LPA_SIM_IP_PROTO_UDP       (17U)
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+typedef enum
+{
+    LPA_SIM_DROPPED,       /* Dropped by the WLAN */
+    LPA_SIM_WLAN,          /* Answered by the WLAN */
+    LPA_SIM_HOST,          /* Passed to the host */
+} lpa_sim_dest_t;
+
+/* A received frame. ARP frames carry the addresses, IP frames the
+ * protocol and the ports.
+ */
+typedef struct
+{
+    uint16_t    eth_type;
+    uint8_t     ip_proto;
+    uint16_t    sport;
+    uint16_t    dport;
+    const char *arp_sender_ip;
+    const char *arp_target_ip;
+} lpa_sim_frame_t;
+
+typedef struct
+{
+    lpa_sim_dest_t dest;
+    bool           woke_host;   /* Passed while the host was suspended */
+    uint32_t       reply_ms;    /* Latency of the reply, 0 if dropped */
+} lpa_sim_rx_t;
+
+/* A TCP connection of the host network stack and the state its peer
+ * expects.
+ */
+typedef struct
+{
+    uint16_t    local_port;
+    const char *remote_ip;
+    uint16_t    remote_port;
+    uint32_t    snd_nxt;        /* Host: next sequence number to send */
+    uint32_t    rcv_nxt;        /* Host: next sequence number expected */
+    uint32_t    peer_snd_nxt;   /* Peer: next sequence number to send */
+    uint32_t    peer_rcv_nxt;   /* Peer: next sequence number expected */
+    uint32_t    keepalives;     /* Keepalives acknowledged by the peer */
+    uint32_t    bad_segments;   /* Segments the peer rejected */
+} lpa_sim_tcp_t;
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+void lpa_sim_reset(const char *host_ip);
+void lpa_sim_set_ioctl_us(uint32_t us);
+void lpa_sim_fail_pf_ioctls(uint32_t count);
+lpa_sim_rx_t lpa_sim_rx(const lpa_sim_frame_t *frame);
+lpa_sim_frame_t lpa_sim_udp(uint16_t sport, uint16_t dport);
+lpa_sim_frame_t lpa_sim_arp_request(const char *sender_ip, const char *target_ip);
+
+bool lpa_sim_host_suspended(void);
+bool lpa_sim_pf_enabled(uint8_t id);
+bool lpa_sim_pf_consistent(void);
+uint32_t lpa_sim_host_wakes(void);
+
+void lpa_sim_tcp_open(lpa_sim_tcp_t *conn, uint32_t iss, uint32_t peer_iss);
+void lpa_sim_tcp_close(lpa_sim_tcp_t *conn);
+bool lpa_sim_tcp_send(lpa_sim_tcp_t *conn, uint32_t length);
+lpa_sim_rx_t lpa_sim_tcp_peer_send(lpa_sim_tcp_t *conn, uint32_t length);
+void lpa_sim_advance_s(uint32_t seconds);
+
+#endif /* LPA_SIM_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,618 @@
+/******************************************************************************
+ * File Name: lpa_sim_stub.cpp
+ *
+ * Description:
+ *   Host simulator of the WLAN offloads, see lpa_sim.h. Implements the
+ *   offload functions of the Low Power Assistant, the offload manager and the
+ *   packet filter calls of the WLAN host driver.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "lpa_sim.h"
+#include "cy_OlmInterface.h"
+#include "cy_lpa_wifi_pf_ol.h"
+#include "cy_lpa_wifi_arp_ol.h"
+#include "cy_lpa_wifi_tko_ol.h"
+#include "whd_emac.h"
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+/* Connection state handed to the WLAN on suspend. */
+typedef struct
+{
+    lpa_sim_tcp_t *conn;
+    uint32_t seq;
+    uint32_t ack;
+} lpa_sim_tko_conn_t;
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+static std::recursive_mutex sim_mutex;
+
+/* Duration of one filter IOCTL, during which other threads run. */
+static std::atomic<uint32_t> sim_ioctl_us{0};
+
+static std::string sim_host_ip;
+static bool sim_suspended;
+static uint32_t sim_host_wakes;
+
+static const cy_pf_ol_cfg_t *sim_pf_cfg;
+static bool sim_pf_enabled[256];
+static uint32_t sim_pf_failures;
+
+static const arp_ol_cfg_t *sim_arp_cfg;
+static uint32_t sim_arp_mask;
+static std::set<std::string> sim_arp_cache;
+
+static const cy_tko_ol_cfg_t *sim_tko_cfg;
+static std::vector<lpa_sim_tko_conn_t> sim_tko_conns;
+static uint32_t sim_tko_elapsed_s;
+
+static std::vector<lpa_sim_tcp_t *> sim_tcp;
+
+/* Handle of the simulated WLAN interface. */
+static char sim_ifp;
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+WHD_EMAC &WHD_EMAC::get_instance()
+{
+    static WHD_EMAC emac;
+    return emac;
+}
+
+static void lpa_sim_ioctl(void)
+{
+    if (0U != sim_ioctl_us)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(sim_ioctl_us));
+    }
+}
+
+static void lpa_sim_pf_apply(void)
+{
+    uint32_t profile = sim_suspended ? CY_PF_ACTIVE_SLEEP : CY_PF_ACTIVE_WAKE;
+
+    for (const cy_pf_ol_cfg_t *f = sim_pf_cfg;
+         (NULL != f) && (CY_PF_OL_FEAT_LAST != f->feature); f++)
+    {
+        sim_pf_enabled[f->id] = (0U != (f->bits & profile));
+    }
+}
+
+static bool lpa_sim_pf_matches(const cy_pf_ol_cfg_t *f, const lpa_sim_frame_t *frame)
+{
+    switch (f->feature)
+    {
+        case CY_PF_OL_FEAT_ETHTYPE:
+            return frame->eth_type == f->u.eth.eth_type;
+        case CY_PF_OL_FEAT_IPTYPE:
+            return (LPA_SIM_ETH_TYPE_IPV4 == frame->eth_type) &&
+                   (frame->ip_proto == f->u.ip.ip_type);
+        case CY_PF_OL_FEAT_PORTNUM:
+            if ((LPA_SIM_IP_PROTO_TCP != frame->ip_proto) &&
+                (LPA_SIM_IP_PROTO_UDP != frame->ip_proto))
+            {
+                return false;
+            }
+            return f->u.port.portnum == ((PF_PN_PORT_SOURCE == f->u.port.direction) ?
+                                         frame->sport : frame->dport);
+        default:
+            return false;
+    }
+}
+
+/* A frame passes when it matches an enabled keep filter or, if no keep
+ * filter is enabled, when it matches no enabled discard filter.
+ */
+static bool lpa_sim_pf_passes(const lpa_sim_frame_t *frame)
+{
+    bool keep_enabled = false;
+    bool keep_match = false;
+    bool discard_match = false;
+
+    for (const cy_pf_ol_cfg_t *f = sim_pf_cfg;
+         (NULL != f) && (CY_PF_OL_FEAT_LAST != f->feature); f++)
+    {
+        if (!sim_pf_enabled[f->id])
+        {
+            continue;
+        }
+        if (0U == (f->bits & CY_PF_ACTION_DISCARD))
+        {
+            keep_enabled = true;
+            keep_match = keep_match || lpa_sim_pf_matches(f, frame);
+        }
+        else
+        {
+            discard_match = discard_match || lpa_sim_pf_matches(f, frame);
+        }
+    }
+
+    return keep_enabled ? keep_match : !discard_match;
+}
+
+static lpa_sim_rx_t lpa_sim_to_host(bool reply)
+{
+    lpa_sim_rx_t rx = { LPA_SIM_HOST, sim_suspended, 0 };
+
+    if (sim_suspended)
+    {
+        sim_host_wakes++;
+    }
+    if (reply)
+    {
+        rx.reply_ms = LPA_SIM_HOST_REPLY_MS + (sim_suspended ? LPA_SIM_HOST_WAKE_MS : 0U);
+    }
+
+    return rx;
+}
+
+static int lpa_sim_pf_init(void *ol, ol_info_t *info, const void *cfg)
+{
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+    pf_ol_t *pf = (pf_ol_t *)ol;
+
+    pf->cfg = (const cy_pf_ol_cfg_t *)cfg;
+    pf->info = info;
+    sim_pf_cfg = pf->cfg;
+    lpa_sim_pf_apply();
+
+    return 0;
+}
+
+static void lpa_sim_pf_deinit(void *ol)
+{
+    (void)ol;
+    sim_pf_cfg = NULL;
+}
+
+/* The filters are switched by their profile bits at each transition, one
+ * IOCTL per filter.
+ */
+static void lpa_sim_pf_pm(ol_pm_st_t st, void *ol)
+{
+    uint32_t profile = (OL_PM_ST_GOING_TO_SLEEP == st) ? CY_PF_ACTIVE_SLEEP :
+                                                         CY_PF_ACTIVE_WAKE;
+    (void)ol;
+
+    for (const cy_pf_ol_cfg_t *f = sim_pf_cfg;
+         (NULL != f) && (CY_PF_OL_FEAT_LAST != f->feature); f++)
+    {
+        lpa_sim_ioctl();
+        std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+        sim_pf_enabled[f->id] = (0U != (f->bits & profile));
+    }
+}
+
+static int lpa_sim_arp_init(void *ol, ol_info_t *info, const void *cfg)
+{
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+    arp_ol_t *arp = (arp_ol_t *)ol;
+
+    arp->config = (const arp_ol_cfg_t *)cfg;
+    arp->info = info;
+    sim_arp_cfg = arp->config;
+    sim_arp_mask = sim_arp_cfg->awake_enable_mask;
+
+    return 0;
+}
+
+static void lpa_sim_arp_deinit(void *ol)
+{
+    (void)ol;
+    sim_arp_cfg = NULL;
+    sim_arp_mask = 0;
+}
+
+static void lpa_sim_arp_pm(ol_pm_st_t st, void *ol)
+{
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+    (void)ol;
+
+    sim_arp_mask = (OL_PM_ST_GOING_TO_SLEEP == st) ? sim_arp_cfg->sleep_enable_mask :
+                                                     sim_arp_cfg->awake_enable_mask;
+}
+
+static int lpa_sim_tko_init(void *ol, ol_info_t *info, const void *cfg)
+{
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+    tko_ol_t *tko = (tko_ol_t *)ol;
+
+    tko->cfg = (const cy_tko_ol_cfg_t *)cfg;
+    tko->info = info;
+    sim_tko_cfg = tko->cfg;
+
+    return 0;
+}
+
+static void lpa_sim_tko_deinit(void *ol)
+{
+    (void)ol;
+    sim_tko_cfg = NULL;
+    sim_tko_conns.clear();
+}
+
+/* On suspend the WLAN takes the sequence and acknowledgement numbers of
+ * the configured connections from the network stack.
+ */
+static void lpa_sim_tko_pm(ol_pm_st_t st, void *ol)
+{
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+    (void)ol;
+
+    sim_tko_conns.clear();
+    sim_tko_elapsed_s = 0;
+    if (OL_PM_ST_GOING_TO_SLEEP != st)
+    {
+        return;
+    }
+
+    for (const cy_tko_ol_connect_t &port : sim_tko_cfg->ports)
+    {
+        if (0U == port.local_port)
+        {
+            continue;
+        }
+        for (lpa_sim_tcp_t *conn : sim_tcp)
+        {
+            if ((conn->local_port == port.local_port) &&
+                (conn->remote_port == port.remote_port) &&
+                (0 == strcmp(conn->remote_ip, port.remote_ip)))
+            {
+                sim_tko_conns.push_back({ conn, conn->snd_nxt, conn->rcv_nxt });
+            }
+        }
+    }
+}
+
+const ol_fns_t pf_ol_fns = { lpa_sim_pf_init, lpa_sim_pf_deinit, lpa_sim_pf_pm };
+const ol_fns_t arp_ol_fns = { lpa_sim_arp_init, lpa_sim_arp_deinit, lpa_sim_arp_pm };
+const ol_fns_t tko_ol_fns = { lpa_sim_tko_init, lpa_sim_tko_deinit, lpa_sim_tko_pm };
+
+int CyOlmInterface::init_ols(void *whd, void *ip)
+{
+    _info.whd = whd;
+    _info.ip = ip;
+
+    for (ol_desc_t *ol = _list; (NULL != ol) && (NULL != ol->name); ol++)
+    {
+        if (0 != ol->fns->init(ol->ol, &_info, ol->cfg))
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+void CyOlmInterface::deinit_ols(void)
+{
+    for (ol_desc_t *ol = _list; (NULL != ol) && (NULL != ol->name); ol++)
+    {
+        ol->fns->deinit(ol->ol);
+    }
+}
+
+void CyOlmInterface::pm(ol_pm_st_t st)
+{
+    for (ol_desc_t *ol = _list; (NULL != ol) && (NULL != ol->name); ol++)
+    {
+        ol->fns->pm(st, ol->ol);
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+    sim_suspended = (OL_PM_ST_GOING_TO_SLEEP == st);
+}
+
+int CyOlmInterface::sleep()
+{
+    pm(OL_PM_ST_GOING_TO_SLEEP);
+    return 0;
+}
+
+int CyOlmInterface::wake()
+{
+    pm(OL_PM_ST_AWAKE);
+    return 0;
+}
+
+extern "C" whd_result_t whd_pf_enable_packet_filter(whd_interface_t ifp, uint8_t filter_id)
+{
+    lpa_sim_ioctl();
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+
+    if (((whd_interface_t)&sim_ifp != ifp) || (0U != sim_pf_failures))
+    {
+        sim_pf_failures -= (0U != sim_pf_failures) ? 1U : 0U;
+        return 1;
+    }
+    sim_pf_enabled[filter_id] = true;
+    return WHD_SUCCESS;
+}
+
+extern "C" whd_result_t whd_pf_disable_packet_filter(whd_interface_t ifp, uint8_t filter_id)
+{
+    lpa_sim_ioctl();
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+
+    if (((whd_interface_t)&sim_ifp != ifp) || (0U != sim_pf_failures))
+    {
+        sim_pf_failures -= (0U != sim_pf_failures) ? 1U : 0U;
+        return 1;
+    }
+    sim_pf_enabled[filter_id] = false;
+    return WHD_SUCCESS;
+}
+
+void lpa_sim_reset(const char *host_ip)
+{
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+
+    sim_ioctl_us = 0;
+    sim_host_ip = host_ip;
+    sim_suspended = false;
+    sim_host_wakes = 0;
+    sim_pf_cfg = NULL;
+    memset(sim_pf_enabled, 0, sizeof(sim_pf_enabled));
+    sim_pf_failures = 0;
+    sim_arp_cfg = NULL;
+    sim_arp_mask = 0;
+    sim_arp_cache.clear();
+    sim_tko_cfg = NULL;
+    sim_tko_conns.clear();
+    sim_tcp.clear();
+    WHD_EMAC::get_instance().ifp = (whd_interface_t)&sim_ifp;
+}
+
+void lpa_sim_set_ioctl_us(uint32_t us)
+{
+    sim_ioctl_us = us;
+}
+
+void lpa_sim_fail_pf_ioctls(uint32_t count)
+{
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+
+    sim_pf_failures = count;
+}
+
+lpa_sim_frame_t lpa_sim_udp(uint16_t sport, uint16_t dport)
+{
+    lpa_sim_frame_t frame = {};
+
+    frame.eth_type = LPA_SIM_ETH_TYPE_IPV4;
+    frame.ip_proto = LPA_SIM_IP_PROTO_UDP;
+    frame.sport = sport;
+    frame.dport = dport;
+    return frame;
+}
+
+lpa_sim_frame_t lpa_sim_arp_request(const char *sender_ip, const char *target_ip)
+{
+    lpa_sim_frame_t frame = {};
+
+    frame.eth_type = LPA_SIM_ETH_TYPE_ARP;
+    frame.arp_sender_ip = sender_ip;
+    frame.arp_target_ip = target_ip;
+    return frame;
+}
+
+/* The ARP agent sees ARP frames before the packet filters. */
+lpa_sim_rx_t lpa_sim_rx(const lpa_sim_frame_t *frame)
+{
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+    lpa_sim_rx_t dropped = { LPA_SIM_DROPPED, false, 0 };
+    lpa_sim_rx_t wlan = { LPA_SIM_WLAN, false, LPA_SIM_WLAN_REPLY_MS };
+    bool arp = (LPA_SIM_ETH_TYPE_ARP == frame->eth_type);
+
+    if (arp && (0U != (sim_arp_mask & ARP_OL_AGENT)))
+    {
+        bool for_host = (sim_host_ip == frame->arp_target_ip);
+        bool cached = (0U != sim_arp_cache.count(frame->arp_target_ip));
+
+        if (0U != (sim_arp_mask & ARP_OL_SNOOP))
+        {
+            sim_arp_cache.insert(frame->arp_sender_ip);
+        }
+        if ((for_host && (0U != (sim_arp_mask & ARP_OL_HOST_AUTO_REPLY))) ||
+            (!for_host && cached && (0U != (sim_arp_mask & ARP_OL_PEER_AUTO_REPLY))))
+        {
+            return wlan;
+        }
+    }
+
+    if (!lpa_sim_pf_passes(frame))
+    {
+        return dropped;
+    }
+
+    return lpa_sim_to_host(!arp || (sim_host_ip == frame->arp_target_ip));
+}
+
+bool lpa_sim_host_suspended(void)
+{
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+
+    return sim_suspended;
+}
+
+bool lpa_sim_pf_enabled(uint8_t id)
+{
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+
+    return sim_pf_enabled[id];
+}
+
+/* The enabled filters of the WLAN are the ones of the current profile. */
+bool lpa_sim_pf_consistent(void)
+{
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+    uint32_t profile = sim_suspended ? CY_PF_ACTIVE_SLEEP : CY_PF_ACTIVE_WAKE;
+
+    for (const cy_pf_ol_cfg_t *f = sim_pf_cfg;
+         (NULL != f) && (CY_PF_OL_FEAT_LAST != f->feature); f++)
+    {
+        if (sim_pf_enabled[f->id] != (0U != (f->bits & profile)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+uint32_t lpa_sim_host_wakes(void)
+{
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+
+    return sim_host_wakes;
+}
+
+void lpa_sim_tcp_open(lpa_sim_tcp_t *conn, uint32_t iss, uint32_t peer_iss)
+{
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+
+    conn->snd_nxt = iss;
+    conn->rcv_nxt = peer_iss;
+    conn->peer_snd_nxt = peer_iss;
+    conn->peer_rcv_nxt = iss;
+    conn->keepalives = 0;
+    conn->bad_segments = 0;
+    sim_tcp.push_back(conn);
+}
+
+void lpa_sim_tcp_close(lpa_sim_tcp_t *conn)
+{
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+
+    for (auto it = sim_tcp.begin(); it != sim_tcp.end(); it++)
+    {
+        if (*it == conn)
+        {
+            sim_tcp.erase(it);
+            break;
+        }
+    }
+}
+
+/* The host sends data, which the peer accepts only at its expected
+ * sequence number. Returns false if the host is suspended or the peer
+ * rejected the segment.
+ */
+bool lpa_sim_tcp_send(lpa_sim_tcp_t *conn, uint32_t length)
+{
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+
+    if (sim_suspended)
+    {
+        return false;
+    }
+    if (conn->snd_nxt != conn->peer_rcv_nxt)
+    {
+        conn->bad_segments++;
+        return false;
+    }
+
+    conn->snd_nxt += length;
+    conn->peer_rcv_nxt += length;
+    return true;
+}
+
+/* The peer sends data, which reaches the host if the filters pass it. */
+lpa_sim_rx_t lpa_sim_tcp_peer_send(lpa_sim_tcp_t *conn, uint32_t length)
+{
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+    lpa_sim_frame_t frame = {};
+    lpa_sim_rx_t rx;
+
+    frame.eth_type = LPA_SIM_ETH_TYPE_IPV4;
+    frame.ip_proto = LPA_SIM_IP_PROTO_TCP;
+    frame.sport = conn->remote_port;
+    frame.dport = conn->local_port;
+
+    conn->peer_snd_nxt += length;
+    rx = lpa_sim_rx(&frame);
+    if (LPA_SIM_HOST == rx.dest)
+    {
+        conn->rcv_nxt += length;
+    }
+
+    return rx;
+}
+
+/* Advances the time while the host is suspended. The WLAN sends a
+ * keepalive, one byte before the next sequence number, every interval.
+ * The peer acknowledges it if it matches the data it received and sent.
+ */
+void lpa_sim_advance_s(uint32_t seconds)
+{
+    std::lock_guard<std::recursive_mutex> lock(sim_mutex);
+
+    if (!sim_suspended || (NULL == sim_tko_cfg) || (0U == sim_tko_cfg->interval))
+    {
+        return;
+    }
+
+    for (uint32_t s = 0; s < seconds; s++)
+    {
+        if (0U != (++sim_tko_elapsed_s % sim_tko_cfg->interval))
+        {
+            continue;
+        }
+        for (lpa_sim_tko_conn_t &tko : sim_tko_conns)
+        {
+            if (((tko.seq - 1U) == (tko.conn->peer_rcv_nxt - 1U)) &&
+                (tko.ack == tko.conn->peer_snd_nxt))
+            {
+                tko.conn->keepalives++;
+            }
+            else
+            {
+                tko.conn->bad_segments++;
+            }
+        }
+    }
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,268 @@
+/******************************************************************************
+ * File Name: mbed.h
+ *
+ * Description:
+ *   Host build replacement of the subset of the Mbed OS API used by the
+ *   application sources under test. Threads, mutexes and event flags map to
+ *   the C++ standard library, the kernel clock can be advanced by the tests.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef MBED_H
+#define MBED_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <assert.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+#include "cy_result.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#define MBED_ASSERT(expr)          assert(expr)
+#define MBED_STATIC_ASSERT(expr, msg)   static_assert(expr, msg)
+#define MBED_UNUSED                __attribute__((unused))
+#define MBED_NOINLINE              __attribute__((noinline))
+#define MBED_FORCEINLINE           inline
+
+#define OS_STACK_SIZE              (4096)
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+typedef int32_t osStatus;
+#define osOK                       (0)
+#define osWaitForever              (0xFFFFFFFFU)
+#define osError                    (-1)
+
+typedef enum
+{
+    osPriorityLow = 8,
+    osPriorityBelowNormal = 16,
+    osPriorityNormal = 24,
+    osPriorityAboveNormal = 32,
+    osPriorityHigh = 40,
+    osPriorityRealtime = 48,
+} osPriority_t;
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+void core_util_critical_section_enter(void);
+void core_util_critical_section_exit(void);
+bool core_util_atomic_cas_bool(volatile bool *ptr, bool *expectedCurrentValue, bool desiredValue);
+void core_util_atomic_store_bool(volatile bool *ptr, bool desiredValue);
+uint32_t core_util_atomic_load_u32(const volatile uint32_t *valuePtr);
+void core_util_atomic_store_u32(volatile uint32_t *valuePtr, uint32_t desiredValue);
+uint32_t core_util_atomic_exchange_u32(volatile uint32_t *valuePtr, uint32_t desiredValue);
+uint32_t core_util_atomic_incr_u32(volatile uint32_t *valuePtr, uint32_t delta);
+bool core_util_atomic_cas_u32(volatile uint32_t *ptr, uint32_t *expectedCurrentValue,
+                              uint32_t desiredValue);
+
+/* Host test control: advances the kernel clock without sleeping. */
+void mbed_host_clock_advance_ms(uint32_t ms);
+
+namespace mbed
+{
+/* Callback is a thin wrapper of std::function. */
+template <typename F>
+class Callback;
+
+template <typename R, typename... Args>
+class Callback<R(Args...)>
+{
+public:
+    Callback() = default;
+    Callback(std::nullptr_t) {}
+    Callback(R (*func)(Args...))
+    {
+        if (nullptr != func)
+        {
+            _func = func;
+        }
+    }
+    template <typename T, typename U>
+    Callback(U *obj, R (T::*method)(Args...))
+        : _func([obj, method](Args... args) { return (obj->*method)(args...); }) {}
+    template <typename F, typename = typename std::enable_if<
+                  !std::is_pointer<typename std::decay<F>::type>::value &&
+                  !std::is_integral<typename std::decay<F>::type>::value &&
+                  !std::is_same<typename std::decay<F>::type, Callback>::value>::type>
+    Callback(F f) : _func(f) {}
+
+    R call(Args... args) const { return _func(args...); }
+    R operator()(Args... args) const { return _func(args...); }
+    explicit operator bool() const { return static_cast<bool>(_func); }
+
+private:
+    std::function<R(Args...)> _func;
+};
+
+template <typename R, typename... Args>
+Callback<R(Args...)> callback(R (*func)(Args...))
+{
+    return Callback<R(Args...)>(func);
+}
+
+template <typename T, typename U, typename R, typename... Args>
+Callback<R(Args...)> callback(U *obj, R (T::*method)(Args...))
+{
+    return Callback<R(Args...)>(obj, method);
+}
+
+class CriticalSectionLock
+{
+public:
+    CriticalSectionLock() { core_util_critical_section_enter(); }
+    ~CriticalSectionLock() { core_util_critical_section_exit(); }
+    static void enable() { core_util_critical_section_enter(); }
+    static void disable() { core_util_critical_section_exit(); }
+};
+} /* namespace mbed */
+
+namespace rtos
+{
+namespace Kernel
+{
+/* Kernel clock, a 1 ms tick counted from the start of the test program. */
+struct Clock
+{
+    using rep = int64_t;
+    using period = std::milli;
+    using duration = std::chrono::milliseconds;
+    using duration_u32 = std::chrono::duration<uint32_t, std::milli>;
+    using time_point = std::chrono::time_point<Clock>;
+    static constexpr bool is_steady = true;
+    static time_point now();
+};
+
+uint64_t get_ms_count(void);
+} /* namespace Kernel */
+
+namespace ThisThread
+{
+void sleep_for(Kernel::Clock::duration_u32 rel_time);
+void sleep_for(uint32_t millisec);
+void yield(void);
+} /* namespace ThisThread */
+
+class Mutex
+{
+public:
+    Mutex() = default;
+    explicit Mutex(const char *name) { (void)name; }
+    void lock(void) { _mutex.lock(); }
+    bool trylock(void) { return _mutex.try_lock(); }
+    void unlock(void) { _mutex.unlock(); }
+
+private:
+    std::recursive_mutex _mutex;
+};
+
+class EventFlags
+{
+public:
+    uint32_t set(uint32_t flags);
+    uint32_t clear(uint32_t flags = 0x7FFFFFFFUL);
+    uint32_t get(void) const;
+    uint32_t wait_any(uint32_t flags, uint32_t millisec = 0xFFFFFFFFUL,
+                      bool clear = true);
+
+private:
+    mutable std::mutex _mutex;
+    std::condition_variable _cond;
+    uint32_t _flags = 0;
+};
+
+/* Thread runs its task in a std::thread. */
+class Thread
+{
+public:
+    enum State
+    {
+        Inactive,
+        Ready,
+        Running,
+        WaitingDelay,
+        WaitingJoin,
+        Deleted = 0xFF,
+    };
+
+    Thread(osPriority_t priority = osPriorityNormal,
+           uint32_t stack_size = OS_STACK_SIZE,
+           unsigned char *stack_mem = nullptr, const char *name = nullptr);
+    ~Thread();
+
+    osStatus start(mbed::Callback<void()> task);
+    osStatus join(void);
+    State get_state(void) const;
+    const char *get_name(void) const { return _name; }
+
+    /* Host test control: number of following start() calls which fail. */
+    static std::atomic<int> host_start_failures;
+
+    /* Host test control: waits until no task of any Thread runs. */
+    static bool host_wait_idle(uint32_t millisec);
+
+private:
+    std::thread _thread;
+    std::atomic<State> _state;
+    const char *_name;
+};
+} /* namespace rtos */
+
+using namespace rtos;
+using namespace mbed;
+using namespace std::chrono_literals;
+
+#include "netsocket/nsapi_types.h"
+#include "netsocket/SocketAddress.h"
+
+#endif /* MBED_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,258 @@
+/******************************************************************************
+ * File Name: mbed_stub.cpp
+ *
+ * Description:
+ *   Host implementation of the Mbed OS stubs of mbed.h.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "mbed.h"
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+/* Critical sections of the target become one recursive lock. */
+static std::recursive_mutex critical_mutex;
+
+static const std::chrono::steady_clock::time_point clock_start =
+    std::chrono::steady_clock::now();
+static std::atomic<int64_t> clock_offset_ms{0};
+
+std::atomic<int> rtos::Thread::host_start_failures{0};
+
+/* Tasks of Thread objects which have not returned yet. */
+static std::mutex thread_mutex;
+static std::condition_variable thread_cond;
+static uint32_t thread_running = 0;
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+void core_util_critical_section_enter(void)
+{
+    critical_mutex.lock();
+}
+
+void core_util_critical_section_exit(void)
+{
+    critical_mutex.unlock();
+}
+
+bool core_util_atomic_cas_bool(volatile bool *ptr, bool *expectedCurrentValue, bool desiredValue)
+{
+    return __atomic_compare_exchange_n(ptr, expectedCurrentValue, desiredValue, false,
+                                       __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+void core_util_atomic_store_bool(volatile bool *ptr, bool desiredValue)
+{
+    __atomic_store_n(ptr, desiredValue, __ATOMIC_SEQ_CST);
+}
+
+uint32_t core_util_atomic_load_u32(const volatile uint32_t *valuePtr)
+{
+    return __atomic_load_n(valuePtr, __ATOMIC_SEQ_CST);
+}
+
+void core_util_atomic_store_u32(volatile uint32_t *valuePtr, uint32_t desiredValue)
+{
+    __atomic_store_n(valuePtr, desiredValue, __ATOMIC_SEQ_CST);
+}
+
+uint32_t core_util_atomic_exchange_u32(volatile uint32_t *valuePtr, uint32_t desiredValue)
+{
+    return __atomic_exchange_n(valuePtr, desiredValue, __ATOMIC_SEQ_CST);
+}
+
+uint32_t core_util_atomic_incr_u32(volatile uint32_t *valuePtr, uint32_t delta)
+{
+    return __atomic_add_fetch(valuePtr, delta, __ATOMIC_SEQ_CST);
+}
+
+bool core_util_atomic_cas_u32(volatile uint32_t *ptr, uint32_t *expectedCurrentValue,
+                              uint32_t desiredValue)
+{
+    return __atomic_compare_exchange_n(ptr, expectedCurrentValue, desiredValue, false,
+                                       __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+void mbed_host_clock_advance_ms(uint32_t ms)
+{
+    clock_offset_ms += ms;
+}
+
+rtos::Kernel::Clock::time_point rtos::Kernel::Clock::now()
+{
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       std::chrono::steady_clock::now() - clock_start);
+
+    return time_point(duration(elapsed.count() + clock_offset_ms.load()));
+}
+
+uint64_t rtos::Kernel::get_ms_count(void)
+{
+    return (uint64_t)Clock::now().time_since_epoch().count();
+}
+
+void rtos::ThisThread::sleep_for(Kernel::Clock::duration_u32 rel_time)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(rel_time.count()));
+}
+
+void rtos::ThisThread::sleep_for(uint32_t millisec)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(millisec));
+}
+
+void rtos::ThisThread::yield(void)
+{
+    std::this_thread::yield();
+}
+
+uint32_t rtos::EventFlags::set(uint32_t flags)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _flags |= flags;
+    _cond.notify_all();
+    return _flags;
+}
+
+uint32_t rtos::EventFlags::clear(uint32_t flags)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    uint32_t old = _flags;
+
+    _flags &= ~flags;
+    return old;
+}
+
+uint32_t rtos::EventFlags::get(void) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    return _flags;
+}
+
+uint32_t rtos::EventFlags::wait_any(uint32_t flags, uint32_t millisec, bool clear)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    auto ready = [this, flags] { return 0U != (_flags & flags); };
+    uint32_t set;
+
+    if (0xFFFFFFFFUL == millisec)
+    {
+        _cond.wait(lock, ready);
+    }
+    else if (!_cond.wait_for(lock, std::chrono::milliseconds(millisec), ready))
+    {
+        return 0;
+    }
+
+    set = _flags & flags;
+    if (clear)
+    {
+        _flags &= ~set;
+    }
+    return set;
+}
+
+rtos::Thread::Thread(osPriority_t priority, uint32_t stack_size,
+                     unsigned char *stack_mem, const char *name)
+    : _state(Inactive), _name(name)
+{
+    (void)priority;
+    (void)stack_size;
+    (void)stack_mem;
+}
+
+rtos::Thread::~Thread()
+{
+    (void)join();
+}
+
+osStatus rtos::Thread::start(mbed::Callback<void()> task)
+{
+    if (Inactive != _state)
+    {
+        return osError;
+    }
+    if (0 < host_start_failures)
+    {
+        host_start_failures--;
+        return osError;
+    }
+
+    _state = Running;
+    {
+        std::lock_guard<std::mutex> lock(thread_mutex);
+        thread_running++;
+    }
+    _thread = std::thread([this, task] {
+        task();
+        _state = Deleted;
+
+        std::lock_guard<std::mutex> lock(thread_mutex);
+        thread_running--;
+        thread_cond.notify_all();
+    });
+
+    return osOK;
+}
+
+osStatus rtos::Thread::join(void)
+{
+    if (_thread.joinable() && (std::this_thread::get_id() != _thread.get_id()))
+    {
+        _thread.join();
+    }
+    return osOK;
+}
+
+bool rtos::Thread::host_wait_idle(uint32_t millisec)
+{
+    std::unique_lock<std::mutex> lock(thread_mutex);
+
+    return thread_cond.wait_for(lock, std::chrono::milliseconds(millisec),
+                                [] { return 0U == thread_running; });
+}
+
+rtos::Thread::State rtos::Thread::get_state(void) const
+{
+    return _state;
+}
+
+
+/* [] END OF FILE */
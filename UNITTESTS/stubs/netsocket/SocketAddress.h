@@ -0,0 +1,107 @@
+/******************************************************************************
+ * File Name: SocketAddress.h
+ *
+ * Description:
+ *   Host build replacement of SocketAddress, an IP address kept as text.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef SOCKET_ADDRESS_H
+#define SOCKET_ADDRESS_H
+
+#include <stdint.h>
+#include <string.h>
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#define NSAPI_IP_SIZE              (40)
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+typedef enum
+{
+    NSAPI_UNSPEC,
+    NSAPI_IPv4,
+    NSAPI_IPv6,
+} nsapi_version_t;
+
+class SocketAddress
+{
+public:
+    SocketAddress(const char *addr = nullptr, uint16_t port = 0)
+        : _port(port)
+    {
+        set_ip_address(addr);
+    }
+
+    bool set_ip_address(const char *addr)
+    {
+        memset(_ip, 0, sizeof(_ip));
+        if (nullptr != addr)
+        {
+            strncpy(_ip, addr, sizeof(_ip) - 1);
+        }
+        return true;
+    }
+
+    const char *get_ip_address() const
+    {
+        return ('\0' != _ip[0]) ? _ip : nullptr;
+    }
+
+    nsapi_version_t get_ip_version() const
+    {
+        if ('\0' == _ip[0])
+        {
+            return NSAPI_UNSPEC;
+        }
+        return (nullptr != strchr(_ip, ':')) ? NSAPI_IPv6 : NSAPI_IPv4;
+    }
+
+    uint16_t get_port() const { return _port; }
+    void set_port(uint16_t port) { _port = port; }
+    explicit operator bool() const { return '\0' != _ip[0]; }
+
+private:
+    char _ip[NSAPI_IP_SIZE];
+    uint16_t _port;
+};
+
+#endif /* SOCKET_ADDRESS_H */
+
+
+/* [] END OF FILE */
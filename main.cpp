@@ -47,6 +47,22 @@
 #include "mbed.h"
 #include "WhdSTAInterface.h"
 #include "network_activity_handler.h"
+#include "app_log.h"
+#include "app_net_info.h"
+#include "app_wl_connect.h"
+#include "app_olm.h"
+#include "app_ol_list.h"
+#include "app_stats.h"
+#include "app_mcast.h"
+#include "app_pf_sched.h"
+#include "app_dvfs.h"
+#include "app_fast_wake.h"
+#include "app_boot_profile.h"
+#include "app_wco.h"
+#include "app_xip.h"
+#include "app_qlog.h"
+#include "app_qspi_bench.h"
+#include "app_lazy_init.h"
 
 /******************************************************************************
  *                                MACROS
@@ -66,18 +82,11 @@
  */
 #define NETWORK_INACTIVE_WINDOW_MS     (250)
 
-#define APP_INFO(x)                do { printf("Info: "); printf x; } while(0);
-#define ERR_INFO(x)                do { printf("Error: "); printf x; } while(0);
+/* Event flag set by the connect worker thread once the association completed. */
+#define APP_EVENT_WL_CONNECTED         (1UL << 0)
 
-#define PRINT_AND_ASSERT(result, msg, args...)   \
-                                   do                                 \
-                                   {                                  \
-                                       if (CY_RSLT_SUCCESS != result) \
-                                       {                              \
-                                           ERR_INFO((msg, ## args));  \
-                                           MBED_ASSERT(0);            \
-                                       }                              \
-                                   } while(0);
+/* Number of wake periods between two logs of the activity per wake reason. */
+#define APP_STATS_SUMMARY_CYCLES       (10UL)
 
 /******************************************************************************
  *                       GLOBAL VARIABLES
@@ -85,64 +94,30 @@
 /* Wi-Fi (STA) object handle. */
 WhdSTAInterface *wifi;
 
+/* Link parameters reported by the connect request. */
+static app_wl_conn_info_t conn_info;
+
+/* Events signalled to the main thread. */
+static EventFlags app_events;
+
 /******************************************************************************
  *                     FUNCTION DEFINITIONS
  *****************************************************************************/
 /******************************************************************************
- * Function Name: app_wl_connect
+ * Function Name: app_wl_connect_done
  ******************************************************************************
  * Summary:
- *   This function tries to connect the kit to the given AP (Access Point).
+ *   Completion callback of the asynchronous connect request. It stores the
+ *   link parameters and signals the main thread.
  *
  * Parameters:
- *   wifi: A pointer to WLAN interface whose emac activity is being monitored.
- *   ssid: Wi-Fi AP SSID.
- *   pwd: Wi-Fi AP Password.
- *   secutiry: Wi-Fi security type as defined in structure nsapi_security_t.
- *
- * Return:
- *   cy_rslt_t: Returns CY_RSLT_SUCCESS or CY_RSLT_TYPE_ERROR indicating
- *              whether the kit connected to the given AP successfully or not.
+ *   info: Link parameters reported by the connect request.
  *
  *****************************************************************************/
-cy_rslt_t app_wl_connect(WhdSTAInterface *wifi, const char *ssid,
-                         const char *pwd, nsapi_security_t security)
+static void app_wl_connect_done(const app_wl_conn_info_t *info)
 {
-    cy_rslt_t ret = CY_RSLT_SUCCESS;
-    SocketAddress sock_addr;
-
-    APP_INFO(("SSID: %s, Security: %d\n", ssid, security));
-
-    if ((NULL == wifi) || (NULL == ssid) || (NULL == pwd))
-    {
-        ERR_INFO(("Error: %s( %p, %p, %p) bad args\n",
-                  __func__, (void*)wifi, (void*)ssid, (void*)pwd));
-        return CY_RSLT_TYPE_ERROR;
-    }
-
-    /* Connect network */
-    APP_INFO(("Connecting to %s...\n", ssid));
-
-    ret = wifi->connect(ssid, pwd, security);
-
-    if (CY_RSLT_SUCCESS == ret)
-    {
-        APP_INFO(("MAC\t : %s\n", wifi->get_mac_address()));
-        wifi->get_netmask(&sock_addr);
-        APP_INFO(("Netmask\t : %s\n", sock_addr.get_ip_address()));
-        wifi->get_gateway(&sock_addr);
-        APP_INFO(("Gateway\t : %s\n", sock_addr.get_ip_address()));
-        APP_INFO(("RSSI\t : %d\n\n", wifi->get_rssi()));
-        wifi->get_ip_address(&sock_addr);
-        APP_INFO(("IP Addr\t : %s\n\n", sock_addr.get_ip_address()));
-    }
-    else
-    {
-        APP_INFO(("\nFailed to connect to Wi-Fi AP.\n"));
-        ret = CY_RSLT_TYPE_ERROR;
-    }
-
-    return ret;
+    conn_info = *info;
+    app_events.set(APP_EVENT_WL_CONNECTED);
 }
 
 /******************************************************************************
@@ -161,6 +136,24 @@ cy_rslt_t app_wl_connect(WhdSTAInterface *wifi, const char *ssid,
 int main(void)
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
+#if MBED_CONF_APP_STATS_PRINT_CYCLES
+    app_stats_cycle_t last_cycle;
+    uint32_t printed_cycle = 0;
+#endif /* MBED_CONF_APP_STATS_PRINT_CYCLES */
+
+#if APP_XIP_ENABLED || MBED_CONF_APP_QSPI_LOG || MBED_CONF_APP_QSPI_READ_BENCH
+    /* Map the QSPI memory before any code placed there with APP_XIP runs,
+     * including the log formatting of the drain thread. Builds which do not
+     * use the QSPI memory leave the SMIF block off.
+     */
+    result = app_xip_init();
+    PRINT_AND_ASSERT(result, "Failed to map the QSPI memory.\n");
+#endif /* APP_XIP_ENABLED || MBED_CONF_APP_QSPI_LOG || MBED_CONF_APP_QSPI_READ_BENCH */
+
+    /* Start the log drain thread. The banner below is only recorded here
+     * and printed once the drain thread is kicked.
+     */
+    app_log_init();
 
     /* \x1b[2J\x1b[;H - ANSI ESC sequence to clear screen */
     APP_INFO(("\x1b[2J\x1b[;H"));
@@ -173,18 +166,90 @@ int main(void)
               "device configurator tool. Refer to README.md document for the\n"
               "more detailed steps.\n\n"));
 
-    /* Initializes the LPA offload manager and applies the discard filter
-     * configured in the ModusToolbox device configurator tool.
+    /* Time of each stage of init_cycfg_all() run before main(). */
+    app_boot_profile_print();
+
+    /* Move CLK_LF to the WCO once the crystal is stable. Networking does
+     * not wait for it.
      */
-    wifi = new WhdSTAInterface();
+    result = app_wco_init();
+    PRINT_AND_ASSERT(result, "Failed to start the WCO poll.\n");
 
-    /* Associate to the Wi-Fi AP. */
-    result = app_wl_connect(wifi, MBED_CONF_APP_WIFI_SSID,
-                              MBED_CONF_APP_WIFI_PASSWORD,
-                             MBED_CONF_APP_WIFI_SECURITY);
-    PRINT_AND_ASSERT(result, "Failed to connect to AP. "
+#if MBED_CONF_APP_SWO_TRACE
+    /* The SWO pin is left out of init_cycfg_all(), see boards.json. */
+    result = app_lazy_claim(APP_LAZY_SWO);
+    PRINT_AND_ASSERT(result, "Failed to claim the SWO pin.\n");
+#endif /* MBED_CONF_APP_SWO_TRACE */
+
+#if MBED_CONF_APP_QSPI_READ_BENCH
+    /* Switch XIP to the fastest read command of the QSPI memory, measured
+     * on the first boot and stored in the emulated EEPROM.
+     */
+    result = app_qspi_bench_init(MBED_CONF_APP_QSPI_READ_BENCH_FORCE);
+    PRINT_AND_ASSERT(result, "Failed to select the QSPI read command.\n");
+#endif /* MBED_CONF_APP_QSPI_READ_BENCH */
+
+    /* Build the offload list: the discard filter configured in the
+     * ModusToolbox device configurator tool and the offloads enabled in
+     * mbed_app.json. It fails rather than dropping what does not fit.
+     */
+    result = (NULL != app_ol_list_get()) ? CY_RSLT_SUCCESS : CY_RSLT_TYPE_ERROR;
+    PRINT_AND_ASSERT(result, "Failed to build the offload list.\n");
+
+    /* List the packet filters, the input of tools/pf_replay.py. */
+    app_ol_list_pf_print();
+
+    /* Initializes the LPA offload manager and applies the offload list. */
+    wifi = new WhdSTAInterface(WHD_EMAC::get_instance(),
+                               OnboardNetworkStack::get_default_instance(),
+                               AppOlmInterface::get_instance());
+    app_net_info_attach(wifi);
+
+    /* Record the WLAN and bus activity of each wake period. */
+    result = app_stats_init();
+    PRINT_AND_ASSERT(result, "Failed to register the statistics hook.\n");
+
+    /* Drop frames of multicast groups never joined while suspended. */
+    result = app_mcast_init();
+    PRINT_AND_ASSERT(result, "Failed to register the multicast hook.\n");
+
+    /* Raise the CPU frequency for the bursts of each wake period. */
+    result = app_dvfs_init();
+    PRINT_AND_ASSERT(result, "Failed to register the DVFS hook.\n");
+
+#if MBED_CONF_APP_QSPI_LOG
+    /* Record the wake periods in the QSPI memory, after the statistics hook
+     * which closes them.
+     */
+    result = app_qlog_init();
+    PRINT_AND_ASSERT(result, "Failed to mount the QSPI log.\n");
+    app_qlog_dump(MBED_CONF_APP_QSPI_LOG_DUMP_PAGES);
+#endif /* MBED_CONF_APP_QSPI_LOG */
+
+    /* Associate to the Wi-Fi AP. The request returns immediately and the
+     * result is delivered to app_wl_connect_done() once the association
+     * completes.
+     */
+    result = app_wl_connect_async(wifi, MBED_CONF_APP_WIFI_SSID,
+                                  MBED_CONF_APP_WIFI_PASSWORD,
+                                  MBED_CONF_APP_WIFI_SECURITY,
+                                  app_wl_connect_done);
+    PRINT_AND_ASSERT(result, "Failed to start the connect request.\n");
+
+    /* Sockets and filters which do not depend on the link being up can be
+     * set up here while the association is in progress.
+     */
+
+    app_events.wait_any(APP_EVENT_WL_CONNECTED);
+    app_wl_print_conn_info(&conn_info);
+    app_log_kick();
+    PRINT_AND_ASSERT(conn_info.result, "Failed to connect to AP. "
                      "Check Wi-Fi credentials in mbed_app.json file.\n");
 
+    /* Switch the time scheduled filter policies once the RTC is set. */
+    result = app_pf_sched_start();
+    PRINT_AND_ASSERT(result, "Failed to start the filter schedule.\n");
+
     /* Suspend network stack forever to put the host into deep-sleep state.
      * Any WLAN packets other than ICMP type are allowed to reach the host and
      * wake from deep sleep. The ICMP packets will simply get discarded by the
@@ -196,6 +261,26 @@ int main(void)
                                   osWaitForever,
                                   NETWORK_INACTIVE_INTERVAL_MS,
                                   NETWORK_INACTIVE_WINDOW_MS);
+
+#if MBED_CONF_APP_STATS_PRINT_CYCLES
+        /* The wake period closed by the last suspend. */
+        if (app_stats_get_last_cycle(&last_cycle) &&
+            (last_cycle.cycle != printed_cycle))
+        {
+            app_stats_print_cycle(&last_cycle);
+            app_fast_wake_print();
+            if (0UL == (last_cycle.cycle % APP_STATS_SUMMARY_CYCLES))
+            {
+                app_stats_print_summary();
+            }
+            printed_cycle = last_cycle.cycle;
+        }
+#endif /* MBED_CONF_APP_STATS_PRINT_CYCLES */
+
+        /* The host is awake after the network stack resumed, drain the log
+         * records collected since the last wake.
+         */
+        app_log_kick();
     }
 
     return result;
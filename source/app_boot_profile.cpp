@@ -0,0 +1,277 @@
+/******************************************************************************
+ * File Name: app_boot_profile.cpp
+ *
+ * Description:
+ *   Link time wrappers timing the stages of init_cycfg_all(). The wrappers
+ *   are only built with APP_BOOT_PROFILE_ENABLED, see profiles/boot_profile.json,
+ *   as the __real_ symbols only exist when linking with the matching --wrap
+ *   options.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "app_boot_profile.h"
+#include "app_log.h"
+
+#if APP_BOOT_PROFILE_ENABLED
+#include "cy_sysclk.h"
+#endif /* APP_BOOT_PROFILE_ENABLED */
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+/* Written before main() only, no locking needed afterwards. */
+static app_boot_profile_t boot_profile;
+
+#if APP_BOOT_PROFILE_ENABLED
+static uint64_t boot_ns;         /* Time from the start to the last mark */
+static uint32_t boot_cycles;     /* DWT count at the last mark */
+static uint32_t boot_hz;         /* CPU clock at the last mark */
+static uint32_t boot_stage_end;  /* End of the last timed stage in us */
+static bool boot_running;        /* Inside init_cycfg_all() */
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+extern "C" {
+void __real_init_cycfg_all(void);
+void __real_init_cycfg_system(void);
+/* Weak, as the kits without peripheral clock dividers have no
+ * init_cycfg_clocks().
+ */
+void __real_init_cycfg_clocks(void) __attribute__((weak));
+void __real_init_cycfg_pins(void);
+cy_en_sysclk_status_t __real_Cy_SysClk_WcoEnable(uint32_t timeoutus);
+cy_en_sysclk_status_t __real_Cy_SysClk_FllEnable(uint32_t timeoutus);
+cy_en_sysclk_status_t __real_Cy_SysClk_FllDisable(void);
+cy_en_sysclk_status_t __real_Cy_SysClk_ClkHfSetSource(uint32_t clkHf,
+                                                      cy_en_clkhf_in_sources_t source);
+cy_en_sysclk_status_t __real_Cy_SysClk_ClkHfSetDivider(uint32_t clkHf,
+                                                       cy_en_clkhf_dividers_t divider);
+}
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/******************************************************************************
+ * Function Name: app_boot_profile_mark
+ ******************************************************************************
+ * Summary:
+ *   Returns the time since the start of init_cycfg_all(). The cycles since
+ *   the last mark convert with the CPU clock read at that mark. Every call
+ *   which changes the CPU clock is wrapped with a mark on each side, the
+ *   CLK_HF0 source and divider and the FLL enable and disable, so the clock
+ *   is constant between two marks. Only the cycles of those calls convert
+ *   with the clock before the change, a few us in total. The CLK_FAST
+ *   divider, 0 in the kit designs, is set by an inline function and not
+ *   tracked.
+ *
+ * Return:
+ *   uint32_t: Time in us.
+ *
+ *****************************************************************************/
+static uint32_t app_boot_profile_mark(void)
+{
+    uint32_t cycles = DWT->CYCCNT;
+
+    boot_ns += ((uint64_t)(cycles - boot_cycles) * 1000000000ULL) / boot_hz;
+    boot_cycles = cycles;
+    boot_hz = Cy_SysClk_ClkHfGetFrequency(0UL) / (Cy_SysClk_ClkFastGetDivider() + 1UL);
+
+    return (uint32_t)(boot_ns / 1000ULL);
+}
+
+/* Marks a change of the CPU clock during init_cycfg_all(). The DVFS and fast
+ * wake switches after the boot are not marked.
+ */
+static void app_boot_profile_clock_mark(void)
+{
+    if (boot_running)
+    {
+        (void)app_boot_profile_mark();
+    }
+}
+
+extern "C" {
+
+void __wrap_init_cycfg_all(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    boot_cycles = DWT->CYCCNT;
+    boot_hz = Cy_SysClk_ClkHfGetFrequency(0UL) / (Cy_SysClk_ClkFastGetDivider() + 1UL);
+
+    boot_running = true;
+    __real_init_cycfg_all();
+    boot_running = false;
+
+    boot_profile.total_us = app_boot_profile_mark();
+}
+
+void __wrap_init_cycfg_system(void)
+{
+    uint32_t start = app_boot_profile_mark();
+
+    __real_init_cycfg_system();
+
+    boot_stage_end = app_boot_profile_mark();
+    boot_profile.stage_us[APP_BOOT_STAGE_SYSTEM] = boot_stage_end - start;
+}
+
+void __wrap_init_cycfg_clocks(void)
+{
+    uint32_t start = app_boot_profile_mark();
+
+    if (NULL != &__real_init_cycfg_clocks)
+    {
+        __real_init_cycfg_clocks();
+    }
+
+    boot_stage_end = app_boot_profile_mark();
+    boot_profile.stage_us[APP_BOOT_STAGE_CLOCKS] = boot_stage_end - start;
+}
+
+/* init_cycfg_routing() is an inline function of the generated header and
+ * cannot be wrapped. It runs between the previous stage and the pins, so
+ * that gap is reported as its time.
+ */
+void __wrap_init_cycfg_pins(void)
+{
+    uint32_t start = app_boot_profile_mark();
+
+    boot_profile.stage_us[APP_BOOT_STAGE_ROUTING] = start - boot_stage_end;
+    __real_init_cycfg_pins();
+
+    boot_stage_end = app_boot_profile_mark();
+    boot_profile.stage_us[APP_BOOT_STAGE_PINS] = boot_stage_end - start;
+}
+
+cy_en_sysclk_status_t __wrap_Cy_SysClk_WcoEnable(uint32_t timeoutus)
+{
+    uint32_t start = app_boot_profile_mark();
+    cy_en_sysclk_status_t status = __real_Cy_SysClk_WcoEnable(timeoutus);
+
+    boot_profile.wait_us[APP_BOOT_WAIT_WCO] += app_boot_profile_mark() - start;
+
+    return status;
+}
+
+cy_en_sysclk_status_t __wrap_Cy_SysClk_FllEnable(uint32_t timeoutus)
+{
+    uint32_t start = app_boot_profile_mark();
+    cy_en_sysclk_status_t status = __real_Cy_SysClk_FllEnable(timeoutus);
+
+    boot_profile.wait_us[APP_BOOT_WAIT_FLL] += app_boot_profile_mark() - start;
+
+    return status;
+}
+
+/* The calls below change the CPU clock. The marks around them restart the
+ * conversion with the new clock.
+ */
+cy_en_sysclk_status_t __wrap_Cy_SysClk_FllDisable(void)
+{
+    app_boot_profile_clock_mark();
+    cy_en_sysclk_status_t status = __real_Cy_SysClk_FllDisable();
+    app_boot_profile_clock_mark();
+
+    return status;
+}
+
+cy_en_sysclk_status_t __wrap_Cy_SysClk_ClkHfSetSource(uint32_t clkHf,
+                                                      cy_en_clkhf_in_sources_t source)
+{
+    app_boot_profile_clock_mark();
+    cy_en_sysclk_status_t status = __real_Cy_SysClk_ClkHfSetSource(clkHf, source);
+    app_boot_profile_clock_mark();
+
+    return status;
+}
+
+cy_en_sysclk_status_t __wrap_Cy_SysClk_ClkHfSetDivider(uint32_t clkHf,
+                                                       cy_en_clkhf_dividers_t divider)
+{
+    app_boot_profile_clock_mark();
+    cy_en_sysclk_status_t status = __real_Cy_SysClk_ClkHfSetDivider(clkHf, divider);
+    app_boot_profile_clock_mark();
+
+    return status;
+}
+
+} /* extern "C" */
+#endif /* APP_BOOT_PROFILE_ENABLED */
+
+/******************************************************************************
+ * Function Name: app_boot_profile_get
+ ******************************************************************************
+ * Summary:
+ *   Returns the boot initialization profile.
+ *
+ * Parameters:
+ *   profile: Boot profile, all zero without APP_BOOT_PROFILE_ENABLED.
+ *
+ *****************************************************************************/
+void app_boot_profile_get(app_boot_profile_t *profile)
+{
+    *profile = boot_profile;
+}
+
+/******************************************************************************
+ * Function Name: app_boot_profile_print
+ ******************************************************************************
+ * Summary:
+ *   Logs the boot initialization profile in the format parsed by
+ *   tools/boot_profile.py.
+ *
+ *****************************************************************************/
+void app_boot_profile_print(void)
+{
+    if (!APP_BOOT_PROFILE_ENABLED)
+    {
+        return;
+    }
+
+    APP_INFO(("Boot profile: init_cycfg_all %lu us\n", boot_profile.total_us));
+    APP_INFO(("Boot profile: system %lu us, WCO wait %lu us, FLL wait %lu us\n",
+              boot_profile.stage_us[APP_BOOT_STAGE_SYSTEM],
+              boot_profile.wait_us[APP_BOOT_WAIT_WCO],
+              boot_profile.wait_us[APP_BOOT_WAIT_FLL]));
+    APP_INFO(("Boot profile: clocks %lu us, routing %lu us, pins %lu us\n",
+              boot_profile.stage_us[APP_BOOT_STAGE_CLOCKS],
+              boot_profile.stage_us[APP_BOOT_STAGE_ROUTING],
+              boot_profile.stage_us[APP_BOOT_STAGE_PINS]));
+}
+
+
+/* [] END OF FILE */
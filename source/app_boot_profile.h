@@ -0,0 +1,95 @@
+/******************************************************************************
+ * File Name: app_boot_profile.h
+ *
+ * Description:
+ *   Boot initialization profiler. Built with profiles/boot_profile.json, the
+ *   stages of init_cycfg_all() called by cybsp_init() before main() and the
+ *   busy-waits for the WCO startup and the FLL lock inside init_cycfg_system()
+ *   are wrapped at link time and timed with the DWT cycle counter. The result
+ *   is printed once the console is up and can be replayed by
+ *   tools/boot_profile.py, which also estimates the stages on the host.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef APP_BOOT_PROFILE_H
+#define APP_BOOT_PROFILE_H
+
+#include "mbed.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#ifndef APP_BOOT_PROFILE_ENABLED
+#define APP_BOOT_PROFILE_ENABLED   (0)
+#endif
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+/* Stages of init_cycfg_all(), in call order. */
+typedef enum
+{
+    APP_BOOT_STAGE_SYSTEM = 0,
+    APP_BOOT_STAGE_CLOCKS,
+    APP_BOOT_STAGE_ROUTING,
+    APP_BOOT_STAGE_PINS,
+    APP_BOOT_STAGE_COUNT
+} app_boot_stage_t;
+
+/* Busy-waits inside init_cycfg_system(). */
+typedef enum
+{
+    APP_BOOT_WAIT_WCO = 0,
+    APP_BOOT_WAIT_FLL,
+    APP_BOOT_WAIT_COUNT
+} app_boot_wait_t;
+
+typedef struct
+{
+    uint32_t total_us;                        /* Whole init_cycfg_all() */
+    uint32_t stage_us[APP_BOOT_STAGE_COUNT];  /* Time of each stage */
+    uint32_t wait_us[APP_BOOT_WAIT_COUNT];    /* Time of each busy-wait */
+} app_boot_profile_t;
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+void app_boot_profile_get(app_boot_profile_t *profile);
+void app_boot_profile_print(void);
+
+#endif /* APP_BOOT_PROFILE_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,306 @@
+/******************************************************************************
+ * File Name: app_dvfs.cpp
+ *
+ * Description:
+ *   Dynamic CPU frequency scaling between the IMO and FLL clock paths.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "app_dvfs.h"
+#include "app_olm.h"
+#include "cycfg.h"
+#include "cy_syslib.h"
+#include "cy_sysclk.h"
+#include "cy_syspm.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+/* Scaling is possible if CLKHF0 runs from path 1 and the FLL is enabled. */
+#if (1UL == CY_CFG_SYSCLK_CLKHF0_CLKPATH_NUM) && defined(srss_0_clock_0_fll_0_ENABLED)
+#define APP_DVFS_SUPPORTED         (1)
+#else
+#define APP_DVFS_SUPPORTED         (0)
+#endif
+
+/* CLKHF0 paths of the design. */
+#define APP_DVFS_LOW_PATH          (CY_SYSCLK_CLKHF_IN_CLKPATH1)
+#define APP_DVFS_HIGH_PATH         (CY_SYSCLK_CLKHF_IN_CLKPATH0)
+#define APP_DVFS_HIGH_PATH_NUM     (0UL)
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+#if APP_DVFS_SUPPORTED
+static uint32_t dvfs_refs = 0;
+static bool dvfs_high = false;
+static Timer dvfs_high_timer;
+static uint32_t dvfs_low_peri_div;
+static Timeout dvfs_hold;
+#if MBED_CONF_APP_DVFS_BOOST_ON_WAKE
+static bool dvfs_wake_held = false;
+#endif
+#endif /* APP_DVFS_SUPPORTED */
+
+static app_dvfs_stats_t dvfs_stats;
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+#if APP_DVFS_SUPPORTED
+/******************************************************************************
+ * Function Name: app_dvfs_set_high
+ ******************************************************************************
+ * Summary:
+ *   Switches CLKHF0 between the IMO and the FLL path. The flash wait states
+ *   are raised before the frequency goes up and lowered after it went down.
+ *   The CLK_PERI divider is scaled with CLKHF0, so CLK_PERI and the
+ *   peripheral clock dividers computed at init, such as the UART baud rate
+ *   and the us ticker, remain valid at both frequencies. The frequencies
+ *   are read from the clock tree, so the LP and ULP designs are handled.
+ *   Deep sleep is locked while at the high frequency, so the FLL stays
+ *   locked. The time at the high frequency is measured with a Timer, which
+ *   can be read from the hold timer ISR. Must be called with interrupts
+ *   disabled.
+ *
+ * Parameters:
+ *   high: true to switch to the FLL path.
+ *
+ * Return:
+ *   bool: false if the FLL is not locked, or if the FLL frequency is not a
+ *   multiple of CLK_PERI that the CLK_PERI divider can reach. The clocks
+ *   are then unchanged. tools/ulp_design.py --check rejects such designs.
+ *
+ *****************************************************************************/
+static bool app_dvfs_set_high(bool high)
+{
+    if (high == dvfs_high)
+    {
+        return true;
+    }
+
+    bool ulp = Cy_SysPm_IsSystemUlp();
+
+    if (high)
+    {
+        uint32_t high_hz = Cy_SysClk_ClkPathGetFrequency(APP_DVFS_HIGH_PATH_NUM);
+        uint32_t peri_hz = Cy_SysClk_ClkPeriGetFrequency();
+
+        /* CLK_PERI must keep its frequency exactly, a truncated divider
+         * would detune the UART and the us ticker.
+         */
+        if (!Cy_SysClk_FllLocked() || (0UL == peri_hz) ||
+            (0UL != (high_hz % peri_hz)) || ((high_hz / peri_hz) > 256UL))
+        {
+            return false;
+        }
+
+        dvfs_low_peri_div = Cy_SysClk_ClkPeriGetDivider();
+
+        sleep_manager_lock_deep_sleep();
+        Cy_SysLib_SetWaitStates(ulp, high_hz / 1000000UL);
+        Cy_SysClk_ClkPeriSetDivider((uint8_t)((high_hz / peri_hz) - 1UL));
+        Cy_SysClk_ClkHfSetSource(0U, APP_DVFS_HIGH_PATH);
+        SystemCoreClockUpdate();
+
+        dvfs_high_timer.reset();
+        dvfs_high_timer.start();
+        dvfs_stats.boosts++;
+    }
+    else
+    {
+        Cy_SysClk_ClkHfSetSource(0U, APP_DVFS_LOW_PATH);
+        Cy_SysClk_ClkPeriSetDivider((uint8_t)dvfs_low_peri_div);
+        SystemCoreClockUpdate();
+        Cy_SysLib_SetWaitStates(ulp, SystemCoreClock / 1000000UL);
+        sleep_manager_unlock_deep_sleep();
+
+        dvfs_high_timer.stop();
+        dvfs_stats.high_ms += (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+                                  dvfs_high_timer.elapsed_time()).count();
+    }
+
+    dvfs_high = high;
+    return true;
+}
+
+/* Hold timer expiry, drops to the low frequency if no request came in. */
+static void app_dvfs_hold_expired(void)
+{
+    core_util_critical_section_enter();
+    if (0 == dvfs_refs)
+    {
+        app_dvfs_set_high(false);
+    }
+    core_util_critical_section_exit();
+}
+
+#if MBED_CONF_APP_DVFS_BOOST_ON_WAKE
+/* Holds the high frequency from the resume to the suspend of the network
+ * stack, so the bursts of a wake period run at the high frequency.
+ */
+static void app_dvfs_olm_hook(bool suspended)
+{
+    if (suspended && dvfs_wake_held)
+    {
+        dvfs_wake_held = false;
+        app_dvfs_release();
+    }
+    else if (!suspended && !dvfs_wake_held)
+    {
+        dvfs_wake_held = true;
+        (void)app_dvfs_request();
+    }
+}
+#endif /* MBED_CONF_APP_DVFS_BOOST_ON_WAKE */
+#endif /* APP_DVFS_SUPPORTED */
+
+/******************************************************************************
+ * Function Name: app_dvfs_init
+ ******************************************************************************
+ * Summary:
+ *   Registers the suspend/resume hook holding the high frequency while the
+ *   network stack is resumed, if the dvfs-boost-on-wake option is enabled.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if the hook could not
+ *   be registered.
+ *
+ *****************************************************************************/
+cy_rslt_t app_dvfs_init(void)
+{
+#if APP_DVFS_SUPPORTED && MBED_CONF_APP_DVFS_BOOST_ON_WAKE
+    return app_olm_add_hook(app_dvfs_olm_hook);
+#else
+    return CY_RSLT_SUCCESS;
+#endif /* APP_DVFS_SUPPORTED && MBED_CONF_APP_DVFS_BOOST_ON_WAKE */
+}
+
+/******************************************************************************
+ * Function Name: app_dvfs_request
+ ******************************************************************************
+ * Summary:
+ *   Requests the high CPU frequency for a burst of work, such as a TLS
+ *   handshake or a bulk receive. Each request must be paired with
+ *   app_dvfs_release(). The switch takes a few clock cycles as the FLL is
+ *   already running.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if the FLL is not
+ *   locked or CLK_PERI cannot be kept at its frequency. The request is
+ *   counted in both cases.
+ *
+ *****************************************************************************/
+cy_rslt_t app_dvfs_request(void)
+{
+#if APP_DVFS_SUPPORTED
+    bool switched;
+
+    core_util_critical_section_enter();
+    dvfs_refs++;
+    switched = app_dvfs_set_high(true);
+    core_util_critical_section_exit();
+
+    dvfs_hold.detach();
+
+    return switched ? CY_RSLT_SUCCESS : CY_RSLT_TYPE_ERROR;
+#else
+    return CY_RSLT_SUCCESS;
+#endif /* APP_DVFS_SUPPORTED */
+}
+
+/******************************************************************************
+ * Function Name: app_dvfs_release
+ ******************************************************************************
+ * Summary:
+ *   Releases a request of app_dvfs_request(). The frequency drops once no
+ *   request is pending for dvfs-hold-ms, which avoids switching back and
+ *   forth between the bursts of one transaction.
+ *
+ *****************************************************************************/
+void app_dvfs_release(void)
+{
+#if APP_DVFS_SUPPORTED
+    bool idle;
+
+    core_util_critical_section_enter();
+    MBED_ASSERT(0 != dvfs_refs);
+    dvfs_refs--;
+    idle = (0 == dvfs_refs);
+    core_util_critical_section_exit();
+
+    if (idle)
+    {
+        dvfs_hold.attach(app_dvfs_hold_expired,
+                         std::chrono::milliseconds(MBED_CONF_APP_DVFS_HOLD_MS));
+    }
+#endif /* APP_DVFS_SUPPORTED */
+}
+
+/******************************************************************************
+ * Function Name: app_dvfs_get_hz
+ ******************************************************************************
+ * Summary:
+ *   Returns the current CPU frequency.
+ *
+ * Return:
+ *   uint32_t: Frequency in Hz.
+ *
+ *****************************************************************************/
+uint32_t app_dvfs_get_hz(void)
+{
+    return SystemCoreClock;
+}
+
+/******************************************************************************
+ * Function Name: app_dvfs_get_stats
+ ******************************************************************************
+ * Summary:
+ *   Returns the number of switches to the high frequency and the time spent
+ *   there, to relate the energy measured on the kit to the workload.
+ *
+ * Parameters:
+ *   stats: Scaling statistics.
+ *
+ *****************************************************************************/
+void app_dvfs_get_stats(app_dvfs_stats_t *stats)
+{
+    core_util_critical_section_enter();
+    *stats = dvfs_stats;
+    core_util_critical_section_exit();
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,72 @@
+/******************************************************************************
+ * File Name: app_dvfs.h
+ *
+ * Description:
+ *   Dynamic CPU frequency scaling. On designs which clock CLKHF0 from the IMO
+ *   through path 1 while the FLL on path 0 is running for other clocks, as on
+ *   CY8CKIT-062S2-43012 (8 MHz IMO, 100 MHz FLL), CLKHF0 is switched to the FLL
+ *   while at least one burst request is pending and back to the IMO once the
+ *   last one was released for the hold time. On the other designs CLKHF0 already
+ *   runs from the FLL and the requests have no effect.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef APP_DVFS_H
+#define APP_DVFS_H
+
+#include "mbed.h"
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+typedef struct
+{
+    uint32_t boosts;     /* Switches to the high frequency */
+    uint32_t high_ms;    /* Time spent at the high frequency */
+} app_dvfs_stats_t;
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+cy_rslt_t app_dvfs_init(void);
+cy_rslt_t app_dvfs_request(void);
+void app_dvfs_release(void);
+uint32_t app_dvfs_get_hz(void);
+void app_dvfs_get_stats(app_dvfs_stats_t *stats);
+
+#endif /* APP_DVFS_H */
+
+
+/* [] END OF FILE */
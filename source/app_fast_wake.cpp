@@ -0,0 +1,349 @@
+/******************************************************************************
+ * File Name: app_fast_wake.cpp
+ *
+ * Description:
+ *   Fast deep sleep exit with FLL relock measurement.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#define APP_LOG_MODULE APP_LOG_MODULE_POWER
+
+#include "app_fast_wake.h"
+#include "app_log.h"
+#include "app_xip.h"
+
+#if APP_FAST_WAKE_ENABLED
+#include "cybsp.h"
+#include "cy_sysclk.h"
+#include "cy_syspm.h"
+#endif /* APP_FAST_WAKE_ENABLED */
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+/* Path of the FLL and the path which feeds the IMO through directly. */
+#define APP_FAST_WAKE_FLL_PATH     (0UL)
+#define APP_FAST_WAKE_IMO_PATH     (1UL)
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+static app_fast_wake_stats_t wake_stats;
+
+/* Set when CLK_PERI cannot keep its frequency on the IMO and the standard
+ * deep sleep callback is registered instead. Its FLL lock wait is then
+ * recorded in wake_stats.
+ */
+static bool wake_fallback = false;
+
+#if APP_FAST_WAKE_ENABLED
+/* Clocks moved from the FLL to the IMO, one bit per CLK_HF. */
+static uint32_t wake_moved_mask = 0;
+static uint32_t wake_start_cycles;
+/* CLK_PERI divider of the FLL, restored before CLK_HF0 moves back. */
+static uint32_t wake_peri_div;
+/* CLK_PERI divider which keeps the frequency with CLK_HF0 on the IMO. */
+static uint32_t wake_imo_peri_div;
+static Timeout wake_poll;
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/******************************************************************************
+ * Function Name: app_fast_wake_record
+ ******************************************************************************
+ * Summary:
+ *   Records the time from a wake to the full clock.
+ *
+ * Parameters:
+ *   cycles: DWT cycles counted on the IMO.
+ *
+ *****************************************************************************/
+APP_HOT static void app_fast_wake_record(uint32_t cycles)
+{
+    uint32_t us = cycles / (CY_SYSCLK_IMO_FREQ / 1000000UL);
+
+    wake_stats.wakes++;
+    wake_stats.last_us = us;
+    wake_stats.total_us += us;
+    if (us > wake_stats.max_us)
+    {
+        wake_stats.max_us = us;
+    }
+}
+
+/******************************************************************************
+ * Function Name: app_fast_wake_poll
+ ******************************************************************************
+ * Summary:
+ *   Switches the clocks moved to the IMO back to the FLL once it is locked,
+ *   and records the time from the wake to the full clock. The CPU ran from
+ *   the IMO over the whole interval, so the DWT cycle count converts with
+ *   the IMO frequency. The CLK_PERI divider is restored before CLK_HF0 moves
+ *   back, in the order of app_dvfs_set_high(), so CLK_PERI never exceeds its
+ *   frequency.
+ *
+ *****************************************************************************/
+APP_HOT static void app_fast_wake_poll(void)
+{
+    uint32_t cycles;
+
+    if (!Cy_SysClk_FllLocked())
+    {
+        wake_poll.attach(app_fast_wake_poll,
+                         std::chrono::microseconds(MBED_CONF_APP_FAST_WAKE_POLL_US));
+        return;
+    }
+
+    cycles = DWT->CYCCNT - wake_start_cycles;
+
+    if (0UL != (wake_moved_mask & 1UL))
+    {
+        Cy_SysClk_ClkPeriSetDivider((uint8_t)wake_peri_div);
+    }
+    for (uint32_t hf = 0; hf < CY_SRSS_NUM_HFROOT; hf++)
+    {
+        if (0UL != (wake_moved_mask & (1UL << hf)))
+        {
+            Cy_SysClk_ClkHfSetSource(hf, CY_SYSCLK_CLKHF_IN_CLKPATH0);
+        }
+    }
+    wake_moved_mask = 0;
+
+    SystemCoreClockUpdate();
+    app_fast_wake_record(cycles);
+}
+
+/******************************************************************************
+ * Function Name: app_fast_wake_callback
+ ******************************************************************************
+ * Summary:
+ *   Deep sleep callback replacing Cy_SysClk_DeepSleepCallback(). Before deep
+ *   sleep, the clocks sourced from the FLL are moved to the path feeding the
+ *   IMO through, and the CLK_PERI divider is lowered so that the peripheral
+ *   clocks, the us ticker among them, keep their frequency. The flash wait
+ *   states are left as they are, which is safe at the lower frequency. After
+ *   the wake, the FLL relocks in the background and app_fast_wake_poll()
+ *   moves the clocks back.
+ *
+ * Parameters:
+ *   params: Callback parameters, unused.
+ *   mode: Deep sleep transition step.
+ *
+ * Return:
+ *   cy_en_syspm_status_t: CY_SYSPM_SUCCESS.
+ *
+ *****************************************************************************/
+APP_HOT static cy_en_syspm_status_t app_fast_wake_callback(cy_stc_syspm_callback_params_t *params,
+                                                            cy_en_syspm_callback_mode_t mode)
+{
+    (void)params;
+
+    if (CY_SYSPM_BEFORE_TRANSITION == mode)
+    {
+        /* A wake which did not reach the full clock yet. */
+        wake_poll.detach();
+
+        if (Cy_SysClk_FllIsEnabled() &&
+            (CY_SYSCLK_CLKPATH_IN_IMO == Cy_SysClk_ClkPathGetSource(APP_FAST_WAKE_IMO_PATH)))
+        {
+            wake_peri_div = Cy_SysClk_ClkPeriGetDivider();
+            for (uint32_t hf = 0; hf < CY_SRSS_NUM_HFROOT; hf++)
+            {
+                if (CY_SYSCLK_CLKHF_IN_CLKPATH0 == Cy_SysClk_ClkHfGetSource(hf))
+                {
+                    Cy_SysClk_ClkHfSetSource(hf, CY_SYSCLK_CLKHF_IN_CLKPATH1);
+                    wake_moved_mask |= (1UL << hf);
+                }
+            }
+            if (0UL != (wake_moved_mask & 1UL))
+            {
+                Cy_SysClk_ClkPeriSetDivider((uint8_t)wake_imo_peri_div);
+            }
+            SystemCoreClockUpdate();
+        }
+    }
+    else if ((CY_SYSPM_AFTER_TRANSITION == mode) && (0UL != wake_moved_mask))
+    {
+        wake_start_cycles = DWT->CYCCNT;
+        app_fast_wake_poll();
+    }
+
+    return CY_SYSPM_SUCCESS;
+}
+
+/******************************************************************************
+ * Function Name: app_fast_wake_std_callback
+ ******************************************************************************
+ * Summary:
+ *   Runs Cy_SysClk_DeepSleepCallback() when the fast wake does not apply, and
+ *   times its wait for the FLL lock after the wake. The CPU waits on the IMO
+ *   while the FLL locks, so the cycles convert with the IMO frequency, which
+ *   underestimates only the few cycles after the switch to the FLL. This is
+ *   the baseline the fast wake removes from the wake path.
+ *
+ * Parameters:
+ *   params: Callback parameters, passed on.
+ *   mode: Deep sleep transition step.
+ *
+ * Return:
+ *   cy_en_syspm_status_t: Result of Cy_SysClk_DeepSleepCallback().
+ *
+ *****************************************************************************/
+APP_HOT static cy_en_syspm_status_t app_fast_wake_std_callback(cy_stc_syspm_callback_params_t *params,
+                                                                cy_en_syspm_callback_mode_t mode)
+{
+    bool relock = (CY_SYSPM_AFTER_TRANSITION == mode) && Cy_SysClk_FllIsEnabled();
+    uint32_t start = DWT->CYCCNT;
+    cy_en_syspm_status_t status = Cy_SysClk_DeepSleepCallback(params, mode);
+
+    if (relock)
+    {
+        app_fast_wake_record(DWT->CYCCNT - start);
+    }
+
+    return status;
+}
+
+/******************************************************************************
+ * Function Name: cybsp_register_custom_sysclk_pm_callback
+ ******************************************************************************
+ * Summary:
+ *   Called by cybsp_init() instead of registering Cy_SysClk_DeepSleepCallback()
+ *   when CYBSP_CUSTOM_SYSCLK_PM_CALLBACK is defined. Registers the fast wake
+ *   callback at the same position and starts the DWT cycle counter. When
+ *   CLK_HF0 runs from the FLL and no CLK_PERI divider of the IMO gives the
+ *   CLK_PERI frequency of the design, Cy_SysClk_DeepSleepCallback() runs
+ *   after all, with its FLL lock wait timed.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if the callback could
+ *   not be registered.
+ *
+ *****************************************************************************/
+cy_rslt_t cybsp_register_custom_sysclk_pm_callback(void)
+{
+    static cy_stc_syspm_callback_params_t wake_cb_params = { NULL, NULL };
+    static cy_stc_syspm_callback_t wake_cb =
+    {
+        .callback = &Cy_SysClk_DeepSleepCallback,
+        .type = CY_SYSPM_DEEPSLEEP,
+        .skipMode = 0UL,
+        .callbackParams = &wake_cb_params,
+        .prevItm = NULL,
+        .nextItm = NULL,
+        .order = 255U,
+    };
+
+    uint32_t peri_hz = Cy_SysClk_ClkPeriGetFrequency();
+
+    if (CY_SYSCLK_CLKHF_IN_CLKPATH0 != Cy_SysClk_ClkHfGetSource(0U))
+    {
+        wake_cb.callback = &app_fast_wake_callback;
+    }
+    else if ((0UL != peri_hz) && (peri_hz <= CY_SYSCLK_IMO_FREQ) &&
+             (0UL == (CY_SYSCLK_IMO_FREQ % peri_hz)))
+    {
+        wake_imo_peri_div = (CY_SYSCLK_IMO_FREQ / peri_hz) - 1UL;
+        wake_cb.callback = &app_fast_wake_callback;
+    }
+    else
+    {
+        wake_cb.callback = &app_fast_wake_std_callback;
+        wake_fallback = true;
+    }
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0UL;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    return Cy_SysPm_RegisterCallback(&wake_cb) ? CY_RSLT_SUCCESS : CY_RSLT_TYPE_ERROR;
+}
+#endif /* APP_FAST_WAKE_ENABLED */
+
+/******************************************************************************
+ * Function Name: app_fast_wake_get_stats
+ ******************************************************************************
+ * Summary:
+ *   Returns the time to full clock statistics of the deep sleep exits.
+ *
+ * Parameters:
+ *   stats: Fast wake statistics, all zero without APP_FAST_WAKE_ENABLED.
+ *
+ *****************************************************************************/
+void app_fast_wake_get_stats(app_fast_wake_stats_t *stats)
+{
+    core_util_critical_section_enter();
+    *stats = wake_stats;
+    core_util_critical_section_exit();
+}
+
+/******************************************************************************
+ * Function Name: app_fast_wake_print
+ ******************************************************************************
+ * Summary:
+ *   Logs the time to full clock of the last deep sleep exit, the maximum and
+ *   the average.
+ *
+ *****************************************************************************/
+void app_fast_wake_print(void)
+{
+    app_fast_wake_stats_t stats;
+
+    if (!APP_FAST_WAKE_ENABLED)
+    {
+        return;
+    }
+
+    app_fast_wake_get_stats(&stats);
+
+    if (wake_fallback)
+    {
+        APP_INFO(("Fast wake: CLK_PERI %lu Hz not reachable from the IMO\n",
+                  (unsigned long)Cy_SysClk_ClkPeriGetFrequency()));
+    }
+
+    if (0 != stats.wakes)
+    {
+        APP_INFO(("Fast wake: %lu wakes, %s %lu us (max %lu, avg %lu)\n",
+                  (unsigned long)stats.wakes,
+                  wake_fallback ? "FLL lock wait" : "full clock after",
+                  (unsigned long)stats.last_us, (unsigned long)stats.max_us,
+                  (unsigned long)(stats.total_us / stats.wakes)));
+    }
+}
+
+
+/* [] END OF FILE */
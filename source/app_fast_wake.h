@@ -0,0 +1,83 @@
+/******************************************************************************
+ * File Name: app_fast_wake.h
+ *
+ * Description:
+ *   Fast deep sleep exit. The BSP normally registers Cy_SysClk_DeepSleepCallback(),
+ *   which waits for the FLL to lock again after each deep sleep before any code
+ *   runs at full speed. Built with profiles/fast_wake.json, which defines
+ *   APP_FAST_WAKE_ENABLED and CYBSP_CUSTOM_SYSCLK_PM_CALLBACK, the application
+ *   registers its own callback instead. The clocks sourced from the FLL run
+ *   from the IMO across deep sleep and the wake path continues on the IMO,
+ *   while a us ticker poll switches them back as soon as the FLL is locked.
+ *   The time from the wake to the full clock is measured with the DWT cycle
+ *   counter. Designs whose CLK_PERI the IMO cannot reach keep the standard
+ *   callback, and its FLL lock wait is measured instead.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef APP_FAST_WAKE_H
+#define APP_FAST_WAKE_H
+
+#include "mbed.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#ifndef APP_FAST_WAKE_ENABLED
+#define APP_FAST_WAKE_ENABLED      (0)
+#endif
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+/* With the standard callback, the times are those of its FLL lock wait. */
+typedef struct
+{
+    uint32_t wakes;        /* Deep sleep exits with the FLL relocking */
+    uint32_t last_us;      /* Time to full clock of the last wake */
+    uint32_t max_us;       /* Longest time to full clock */
+    uint32_t total_us;     /* Sum of the times to full clock */
+} app_fast_wake_stats_t;
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+void app_fast_wake_get_stats(app_fast_wake_stats_t *stats);
+void app_fast_wake_print(void);
+
+#endif /* APP_FAST_WAKE_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,171 @@
+/******************************************************************************
+ * File Name: app_lazy_init.cpp
+ *
+ * Description:
+ *   Configures the peripheral blocks left out of init_cycfg_all() on their
+ *   first claim.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "app_lazy_init.h"
+#include "cycfg.h"
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+/* Blocks configured so far, one bit per app_lazy_block_t. */
+static uint32_t lazy_configured_mask = 0;
+
+/* The CSD divider of a CapSense claim whose pins failed stays configured. */
+static bool lazy_capsense_clocks = false;
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/******************************************************************************
+ * Function Name: app_lazy_configure
+ ******************************************************************************
+ * Summary:
+ *   Runs the generated init functions of a block. Functions which do not
+ *   exist on the current kit were either not moved out of init_cycfg_all()
+ *   or the kit has no such pin, nothing is left to do for them. Each
+ *   generated function reserves its HAL resources before it writes a
+ *   register, so a function which fails leaves its hardware untouched.
+ *
+ * Parameters:
+ *   block: Block to configure.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or the error of cyhal_hwmgr_reserve() if a
+ *   resource of the block is in use.
+ *
+ *****************************************************************************/
+static cy_rslt_t app_lazy_configure(app_lazy_block_t block)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    switch (block)
+    {
+        case APP_LAZY_CAPSENSE:
+#if defined(CYCFG_CLOCKS_CAPSENSE_LAZY)
+            if (!lazy_capsense_clocks)
+            {
+                result = init_cycfg_clocks_capsense();
+                lazy_capsense_clocks = (CY_RSLT_SUCCESS == result);
+            }
+#endif
+#if defined(CYCFG_PINS_CAPSENSE_LAZY)
+            if (CY_RSLT_SUCCESS == result)
+            {
+                result = init_cycfg_pins_capsense();
+            }
+#endif
+            break;
+
+        case APP_LAZY_SWO:
+#if defined(CYCFG_PINS_SWO_LAZY)
+            result = init_cycfg_pins_swo();
+#endif
+            break;
+
+        default:
+            break;
+    }
+
+    return result;
+}
+
+/******************************************************************************
+ * Function Name: app_lazy_claim
+ ******************************************************************************
+ * Summary:
+ *   Configures the pins and clocks of a block on its first claim. Must be
+ *   called by the driver of the block before it is opened, later calls
+ *   return immediately. A claim which fails because a resource of the block
+ *   is reserved by another driver leaves the block unconfigured and can be
+ *   repeated. Safe to call from any thread.
+ *
+ * Parameters:
+ *   block: Block claimed by the caller.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or the error of cyhal_hwmgr_reserve().
+ *
+ *****************************************************************************/
+cy_rslt_t app_lazy_claim(app_lazy_block_t block)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    MBED_ASSERT(block < APP_LAZY_COUNT);
+
+    /* The generated functions only write a few registers, so they run in
+     * the critical section rather than behind a mutex.
+     */
+    CriticalSectionLock lock;
+
+    if (0 == (lazy_configured_mask & (1UL << block)))
+    {
+        result = app_lazy_configure(block);
+        if (CY_RSLT_SUCCESS == result)
+        {
+            lazy_configured_mask |= (1UL << block);
+        }
+    }
+
+    return result;
+}
+
+/******************************************************************************
+ * Function Name: app_lazy_is_configured
+ ******************************************************************************
+ * Summary:
+ *   Checks whether a block has been claimed.
+ *
+ * Parameters:
+ *   block: Block to check.
+ *
+ * Return:
+ *   bool: true if app_lazy_claim() succeeded for the block.
+ *
+ *****************************************************************************/
+bool app_lazy_is_configured(app_lazy_block_t block)
+{
+    MBED_ASSERT(block < APP_LAZY_COUNT);
+
+    return (0 != (core_util_atomic_load_u32(&lazy_configured_mask) & (1UL << block)));
+}
+
+
+/* [] END OF FILE */
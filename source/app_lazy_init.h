@@ -0,0 +1,70 @@
+/******************************************************************************
+ * File Name: app_lazy_init.h
+ *
+ * Description:
+ *   Lazy initialization of peripheral blocks. tools/cycfg_gen.py moves the
+ *   pins and clock dividers of the blocks listed under "lazy" in
+ *   COMPONENT_CUSTOM_DESIGN_MODUS/boards.json out of init_cycfg_all() into
+ *   init_cycfg_<pins|clocks>_<block>() functions, so the blocks stay in their
+ *   reset state until a driver claims them with app_lazy_claim(). Blocks not
+ *   moved on the current kit are configured at boot as before.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef APP_LAZY_INIT_H
+#define APP_LAZY_INIT_H
+
+#include "mbed.h"
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+typedef enum
+{
+    APP_LAZY_CAPSENSE = 0,    /* CSD pins, CMOD, CINA/CINB and the CSD divider */
+    APP_LAZY_SWO,             /* Serial wire output trace pin */
+    APP_LAZY_COUNT
+} app_lazy_block_t;
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+cy_rslt_t app_lazy_claim(app_lazy_block_t block);
+bool app_lazy_is_configured(app_lazy_block_t block);
+
+#endif /* APP_LAZY_INIT_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,345 @@
+/******************************************************************************
+ * File Name: app_log.cpp
+ *
+ * Description:
+ *   Deferred log ring buffer. Producers only copy the format string pointer
+ *   and the raw argument words into a fixed size record, the formatting and
+ *   the UART transfer happen in a low priority drain thread which runs when
+ *   app_log_kick() is called from a point where the system is awake anyway,
+ *   or when the ring is filling up. Records which do not fit are counted and
+ *   reported on the next drain.
+ *
+ *   The producers never mask interrupts. A producer reserves its record by
+ *   advancing the head index with a compare and swap, and publishes it by
+ *   writing the sequence number of the record once it is complete. The
+ *   drain stops at the first record which is reserved but not yet complete.
+ *
+ *   With MBED_CONF_APP_LOG_BINARY_OUTPUT enabled the drain thread does not
+ *   format the records. It prints them as '#L:' lines holding the format
+ *   string address and the raw arguments, which tools/log_decode.py turns
+ *   back into text using the application ELF file.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "app_log.h"
+#include "app_xip.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+/* Number of records of the ring buffer, must be a power of two. */
+#define APP_LOG_RING_SIZE          (MBED_CONF_APP_LOG_RING_SIZE)
+#define APP_LOG_RING_MASK          (APP_LOG_RING_SIZE - 1U)
+
+/* Ring level at which the producer wakes the drain thread on its own. */
+#define APP_LOG_HIGH_WATERMARK     ((APP_LOG_RING_SIZE * 3U) / 4U)
+
+#define APP_LOG_THREAD_STACK_SIZE  (2048)
+#define APP_LOG_FLAG_DRAIN         (1UL << 0)
+
+#if (0 != (APP_LOG_RING_SIZE & APP_LOG_RING_MASK))
+#error "log-ring-size must be a power of two"
+#endif
+
+/******************************************************************************
+ *                          TYPE DEFINITIONS
+ *****************************************************************************/
+typedef struct
+{
+    uint32_t    seq;          /* Ring index + 1 once the record is complete */
+    uint32_t    id;
+    uint8_t     nargs;
+    uint8_t     str_mask;
+    uint32_t    args[APP_LOG_MAX_ARGS];
+} app_log_rec_t;
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+/* Indexed by APP_LOG_MODULE_*, starts at the compile time levels. */
+uint8_t app_log_runtime_level[APP_LOG_MODULE_COUNT] =
+{
+    APP_LOG_LEVEL_MAIN,
+    APP_LOG_LEVEL_WIFI,
+    APP_LOG_LEVEL_STATS,
+    APP_LOG_LEVEL_POWER,
+};
+
+static app_log_rec_t log_ring[APP_LOG_RING_SIZE];
+
+/* Free running indices. log_head counts the records reserved by the
+ * producers, log_tail is only written by the drain side.
+ */
+static volatile uint32_t log_head = 0;
+static volatile uint32_t log_tail = 0;
+
+/* Records dropped because the ring was full, since the last drain and in
+ * total.
+ */
+static volatile uint32_t log_dropped = 0;
+static uint32_t log_dropped_total = 0;
+
+static EventFlags log_flags;
+static Mutex log_drain_mutex;
+static Thread log_thread(osPriorityLow, APP_LOG_THREAD_STACK_SIZE, NULL,
+                         "app_log");
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/******************************************************************************
+ * Function Name: app_log_print_rec
+ ******************************************************************************
+ * Summary:
+ *   Prints one record either formatted or as a '#L:' line for the host
+ *   decoder.
+ *
+ * Parameters:
+ *   rec: Record to be printed.
+ *
+ *****************************************************************************/
+APP_XIP static void app_log_print_rec(const app_log_rec_t *rec)
+{
+#if MBED_CONF_APP_LOG_BINARY_OUTPUT
+    printf("#L:%08lx", (unsigned long)rec->id);
+
+    for (uint8_t i = 0; i < rec->nargs; i++)
+    {
+        if (0U != (rec->str_mask & (1U << i)))
+        {
+            /* The decoder has no access to the RAM, so strings are sent
+             * inline as hex encoded bytes.
+             */
+            printf(":s");
+            for (const char *p = (const char *)(uintptr_t)rec->args[i]; '\0' != *p; p++)
+            {
+                printf("%02x", (uint8_t)*p);
+            }
+        }
+        else
+        {
+            printf(":%08lx", (unsigned long)rec->args[i]);
+        }
+    }
+    printf("\n");
+#else
+    const uint32_t *a = rec->args;
+
+    printf("Info: ");
+    printf((const char *)(uintptr_t)rec->id, a[0], a[1], a[2], a[3], a[4], a[5]);
+#endif /* MBED_CONF_APP_LOG_BINARY_OUTPUT */
+}
+
+/******************************************************************************
+ * Function Name: app_log_drain
+ ******************************************************************************
+ * Summary:
+ *   Prints all pending records in the calling context and reports the
+ *   records dropped since the last drain.
+ *
+ *****************************************************************************/
+static void app_log_drain(void)
+{
+    uint32_t dropped;
+
+    app_log_rec_t *rec;
+
+    log_drain_mutex.lock();
+
+    /* A record is complete once its producer wrote its sequence number. */
+    rec = &log_ring[log_tail & APP_LOG_RING_MASK];
+    while ((log_tail + 1U) == core_util_atomic_load_u32(&rec->seq))
+    {
+        app_log_print_rec(rec);
+        core_util_atomic_store_u32(&log_tail, log_tail + 1U);
+        rec = &log_ring[log_tail & APP_LOG_RING_MASK];
+    }
+
+    dropped = core_util_atomic_exchange_u32(&log_dropped, 0U);
+    if (0U != dropped)
+    {
+        log_dropped_total += dropped;
+        printf("Info: %lu log records dropped (%lu total)\n",
+               (unsigned long)dropped, (unsigned long)log_dropped_total);
+    }
+
+    log_drain_mutex.unlock();
+}
+
+/******************************************************************************
+ * Function Name: app_log_thread_main
+ ******************************************************************************
+ * Summary:
+ *   Entry function of the drain thread.
+ *
+ *****************************************************************************/
+static void app_log_thread_main(void)
+{
+    while (true)
+    {
+        log_flags.wait_any(APP_LOG_FLAG_DRAIN);
+        app_log_drain();
+    }
+}
+
+/******************************************************************************
+ * Function Name: app_log_init
+ ******************************************************************************
+ * Summary:
+ *   Starts the drain thread. Records written before are kept in the ring
+ *   and printed on the first drain.
+ *
+ *****************************************************************************/
+void app_log_init(void)
+{
+#if MBED_CONF_APP_LOG_DEFERRED
+    log_thread.start(mbed::callback(app_log_thread_main));
+#endif /* MBED_CONF_APP_LOG_DEFERRED */
+}
+
+/******************************************************************************
+ * Function Name: app_log_set_level
+ ******************************************************************************
+ * Summary:
+ *   Sets the runtime level of a module. Lines above the compile time level
+ *   of the module are not part of the image, so raising the level beyond it
+ *   has no effect.
+ *
+ * Parameters:
+ *   module: One of the APP_LOG_MODULE_* values.
+ *   level: One of the APP_LOG_LEVEL_* values.
+ *
+ *****************************************************************************/
+void app_log_set_level(uint8_t module, uint8_t level)
+{
+    if (module < APP_LOG_MODULE_COUNT)
+    {
+        app_log_runtime_level[module] = level;
+    }
+}
+
+/******************************************************************************
+ * Function Name: app_log_kick
+ ******************************************************************************
+ * Summary:
+ *   Wakes the drain thread. To be called from points where the system is
+ *   awake anyway, e.g. after the network stack resumed. Callable from
+ *   interrupt context.
+ *
+ *****************************************************************************/
+void app_log_kick(void)
+{
+    log_flags.set(APP_LOG_FLAG_DRAIN);
+}
+
+/******************************************************************************
+ * Function Name: app_log_flush
+ ******************************************************************************
+ * Summary:
+ *   Prints all pending records synchronously, e.g. before an error message
+ *   or an assert. Must be called from thread context.
+ *
+ *****************************************************************************/
+void app_log_flush(void)
+{
+#if MBED_CONF_APP_LOG_DEFERRED
+    app_log_drain();
+#endif /* MBED_CONF_APP_LOG_DEFERRED */
+}
+
+/******************************************************************************
+ * Function Name: app_log_get_dropped
+ ******************************************************************************
+ * Summary:
+ *   Returns the number of records dropped because the ring was full.
+ *
+ *****************************************************************************/
+uint32_t app_log_get_dropped(void)
+{
+    return log_dropped_total + core_util_atomic_load_u32(&log_dropped);
+}
+
+/******************************************************************************
+ * Function Name: app_log_write
+ ******************************************************************************
+ * Summary:
+ *   Copies one record into the ring buffer. Never blocks and never masks
+ *   interrupts, a record which does not fit is dropped and counted. Callable
+ *   from any thread and from interrupt context. Use APP_INFO() instead of
+ *   calling this function directly.
+ *
+ * Parameters:
+ *   id: Address of the format string, or its token in tokenized builds.
+ *   args: Raw argument words.
+ *   nargs: Number of argument words.
+ *   str_mask: Bit n is set if argument n is a string.
+ *
+ *****************************************************************************/
+void app_log_write(uint32_t id, const uint32_t *args, uint8_t nargs,
+                   uint8_t str_mask)
+{
+    app_log_rec_t *rec;
+    uint32_t tail;
+    uint32_t head;
+    uint32_t level;
+
+    /* The tail is read first, so it never passes the head read after it. */
+    do
+    {
+        tail = core_util_atomic_load_u32(&log_tail);
+        head = core_util_atomic_load_u32(&log_head);
+        level = head - tail;
+        if (level >= APP_LOG_RING_SIZE)
+        {
+            core_util_atomic_incr_u32(&log_dropped, 1U);
+            return;
+        }
+    } while (!core_util_atomic_cas_u32(&log_head, &head, head + 1U));
+
+    rec = &log_ring[head & APP_LOG_RING_MASK];
+    rec->id = id;
+    rec->nargs = nargs;
+    rec->str_mask = str_mask;
+    memcpy(rec->args, args, nargs * sizeof(uint32_t));
+    core_util_atomic_store_u32(&rec->seq, head + 1U);
+
+    if ((level + 1U) >= APP_LOG_HIGH_WATERMARK)
+    {
+        app_log_kick();
+    }
+}
+
+
+/* [] END OF FILE */
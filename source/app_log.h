@@ -0,0 +1,304 @@
+/******************************************************************************
+ * File Name: app_log.h
+ *
+ * Description:
+ *   Console logging macros shared by the application modules.
+ *   Each source file selects its log module by defining APP_LOG_MODULE before
+ *   including this header. The level of each module is fixed at compile time
+ *   through the log-level* options of mbed_app.json, lines above that level
+ *   compile to nothing including the evaluation of their arguments. Below it,
+ *   app_log_set_level() lowers the level at runtime at the cost of a single
+ *   branch per line.
+ *   With MBED_CONF_APP_LOG_DEFERRED enabled APP_INFO() does not format or
+ *   print in the caller context. It only records the format string and the
+ *   raw arguments into a ring buffer which is drained later by a low
+ *   priority thread, see app_log.cpp. ERR_INFO() always prints synchronously
+ *   after flushing the pending records.
+ *   With MBED_CONF_APP_LOG_TOKENIZED enabled as well, the format string of
+ *   APP_INFO() is replaced at compile time by its 32-bit FNV-1a hash, so the
+ *   string itself is not stored in the image. tools/log_tokens.py builds the
+ *   matching token database from the sources.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef APP_LOG_H
+#define APP_LOG_H
+
+#include "mbed.h"
+#include <type_traits>
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+/* Maximum number of arguments of a deferred log record. */
+#define APP_LOG_MAX_ARGS           (6)
+
+/* Log levels. */
+#define APP_LOG_LEVEL_NONE         (0)
+#define APP_LOG_LEVEL_ERR          (1)
+#define APP_LOG_LEVEL_INFO         (2)
+
+/* Log modules. */
+#define APP_LOG_MODULE_MAIN        (0)
+#define APP_LOG_MODULE_WIFI        (1)
+#define APP_LOG_MODULE_STATS       (2)
+#define APP_LOG_MODULE_POWER       (3)
+#define APP_LOG_MODULE_COUNT       (4)
+
+#ifndef APP_LOG_MODULE
+#define APP_LOG_MODULE             APP_LOG_MODULE_MAIN
+#endif
+
+/* Compile time level of each module. Modules without their own option use
+ * the log-level option.
+ */
+#ifdef MBED_CONF_APP_LOG_LEVEL_MAIN
+#define APP_LOG_LEVEL_MAIN         MBED_CONF_APP_LOG_LEVEL_MAIN
+#else
+#define APP_LOG_LEVEL_MAIN         MBED_CONF_APP_LOG_LEVEL
+#endif
+
+#ifdef MBED_CONF_APP_LOG_LEVEL_WIFI
+#define APP_LOG_LEVEL_WIFI         MBED_CONF_APP_LOG_LEVEL_WIFI
+#else
+#define APP_LOG_LEVEL_WIFI         MBED_CONF_APP_LOG_LEVEL
+#endif
+
+#ifdef MBED_CONF_APP_LOG_LEVEL_STATS
+#define APP_LOG_LEVEL_STATS        MBED_CONF_APP_LOG_LEVEL_STATS
+#else
+#define APP_LOG_LEVEL_STATS        MBED_CONF_APP_LOG_LEVEL
+#endif
+
+#ifdef MBED_CONF_APP_LOG_LEVEL_POWER
+#define APP_LOG_LEVEL_POWER        MBED_CONF_APP_LOG_LEVEL_POWER
+#else
+#define APP_LOG_LEVEL_POWER        MBED_CONF_APP_LOG_LEVEL
+#endif
+
+/* True if lines of the given level of the current module are printed. The
+ * first operand is a compile time constant, so the line is removed when it
+ * is false. Otherwise only the runtime level is compared.
+ */
+#define APP_LOG_ENABLED(level)                                              \
+            (app_log_compiled<APP_LOG_MODULE, (level)>::value &&            \
+             (app_log_runtime_level[APP_LOG_MODULE] >= (level)))
+
+#if MBED_CONF_APP_LOG_TOKENIZED
+#if !(MBED_CONF_APP_LOG_DEFERRED && MBED_CONF_APP_LOG_BINARY_OUTPUT)
+#error "log-tokenized requires log-deferred and log-binary-output"
+#endif
+#define APP_INFO_EMIT_(x)          APP_LOG_TOKENIZE_ x
+#elif MBED_CONF_APP_LOG_DEFERRED
+#define APP_INFO_EMIT_(x)          app_log_defer x
+#else
+#define APP_INFO_EMIT_(x)          do { printf("Info: "); printf x; } while(0)
+#endif /* MBED_CONF_APP_LOG_TOKENIZED */
+
+#define APP_INFO(x)                do { if (APP_LOG_ENABLED(APP_LOG_LEVEL_INFO)) { APP_INFO_EMIT_(x); } } while(0);
+#define ERR_INFO(x)                do { if (APP_LOG_ENABLED(APP_LOG_LEVEL_ERR)) { app_log_flush(); printf("Error: "); printf x; } } while(0);
+
+/* Records a log line under the compile time token of its format string. The
+ * integral_constant forces the evaluation at compile time, so the literal is
+ * not emitted into the image.
+ */
+#define APP_LOG_TOKENIZE_(fmt, args...)                                  \
+            app_log_defer_id(std::integral_constant<uint32_t,             \
+                                 app_log_token(fmt)>::value, ## args)
+
+#define PRINT_AND_ASSERT(result, msg, args...)   \
+                                   do                                 \
+                                   {                                  \
+                                       if (CY_RSLT_SUCCESS != result) \
+                                       {                              \
+                                           ERR_INFO((msg, ## args));  \
+                                           MBED_ASSERT(0);            \
+                                       }                              \
+                                   } while(0);
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+void app_log_init(void);
+void app_log_set_level(uint8_t module, uint8_t level);
+void app_log_kick(void);
+void app_log_flush(void);
+uint32_t app_log_get_dropped(void);
+void app_log_write(uint32_t id, const uint32_t *args, uint8_t nargs,
+                   uint8_t str_mask);
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+/* Runtime level of each module, see app_log_set_level(). */
+extern uint8_t app_log_runtime_level[APP_LOG_MODULE_COUNT];
+
+/******************************************************************************
+ *                      INLINE FUNCTION DEFINITIONS
+ *****************************************************************************/
+/* Compile time level of a module. */
+constexpr uint8_t app_log_compiled_level(uint8_t module)
+{
+    return (APP_LOG_MODULE_MAIN == module) ? APP_LOG_LEVEL_MAIN :
+           (APP_LOG_MODULE_WIFI == module) ? APP_LOG_LEVEL_WIFI :
+           (APP_LOG_MODULE_STATS == module) ? APP_LOG_LEVEL_STATS :
+           (APP_LOG_MODULE_POWER == module) ? APP_LOG_LEVEL_POWER :
+                                             APP_LOG_LEVEL_NONE;
+}
+
+template <uint8_t Module, uint8_t Level>
+struct app_log_compiled :
+    std::integral_constant<bool, (Level <= app_log_compiled_level(Module))> {};
+
+namespace app_log_detail
+{
+    /* Arguments are recorded as raw 32-bit words. Strings are recorded by
+     * reference, so they must remain valid until the record is drained.
+     */
+    template <typename T>
+    inline uint32_t arg_word(T value)
+    {
+        static_assert(std::is_integral<T>::value || std::is_enum<T>::value,
+                      "deferred log arguments must be integers or pointers");
+        static_assert(sizeof(T) <= sizeof(uint32_t),
+                      "deferred log arguments must fit in 32 bits");
+        return (uint32_t)value;
+    }
+
+    template <typename T>
+    inline uint32_t arg_word(T *value)
+    {
+        return (uint32_t)(uintptr_t)value;
+    }
+
+    template <typename T>
+    struct is_str : std::integral_constant<bool,
+        std::is_same<typename std::decay<T>::type, const char *>::value ||
+        std::is_same<typename std::decay<T>::type, char *>::value> {};
+
+    /* Bit n is set if argument n is a string. */
+    template <typename... Args>
+    struct str_mask;
+
+    template <>
+    struct str_mask<>
+    {
+        static constexpr uint8_t value = 0;
+    };
+
+    template <typename T, typename... Rest>
+    struct str_mask<T, Rest...>
+    {
+        static constexpr uint8_t value = (is_str<T>::value ? 1U : 0U) |
+                                         (str_mask<Rest...>::value << 1);
+    };
+}
+
+/******************************************************************************
+ * Function Name: app_log_token
+ ******************************************************************************
+ * Summary:
+ *   Computes the 32-bit FNV-1a hash of a format string. Must stay in sync
+ *   with fnv1a_32() in tools/log_tokens.py.
+ *
+ * Parameters:
+ *   fmt: Format string.
+ *
+ * Return:
+ *   uint32_t: Token of the format string.
+ *
+ *****************************************************************************/
+constexpr uint32_t app_log_token(const char *fmt)
+{
+    uint32_t hash = 2166136261UL;
+
+    while ('\0' != *fmt)
+    {
+        hash = (uint32_t)((hash ^ (uint8_t)*fmt) * 16777619UL);
+        fmt++;
+    }
+
+    return hash;
+}
+
+/******************************************************************************
+ * Function Name: app_log_defer_id
+ ******************************************************************************
+ * Summary:
+ *   Records a log line into the deferred log ring buffer. Only integer,
+ *   enum and pointer arguments of at most 32 bits are supported.
+ *
+ * Parameters:
+ *   id: Address of the format string, or its token in tokenized builds.
+ *   args: Arguments of the format string.
+ *
+ *****************************************************************************/
+template <typename... Args>
+inline void app_log_defer_id(uint32_t id, Args... args)
+{
+    static_assert(sizeof...(Args) <= APP_LOG_MAX_ARGS,
+                  "too many deferred log arguments");
+
+    const uint32_t words[sizeof...(Args) + 1] =
+    {
+        app_log_detail::arg_word(args)..., 0
+    };
+
+    app_log_write(id, words, sizeof...(Args),
+                  app_log_detail::str_mask<Args...>::value);
+}
+
+/******************************************************************************
+ * Function Name: app_log_defer
+ ******************************************************************************
+ * Summary:
+ *   Records a log line into the deferred log ring buffer by the address of
+ *   its format string.
+ *
+ * Parameters:
+ *   fmt: printf style format string. Must have static storage duration.
+ *   args: Arguments of the format string.
+ *
+ *****************************************************************************/
+template <typename... Args>
+inline void app_log_defer(const char *fmt, Args... args)
+{
+    app_log_defer_id((uint32_t)(uintptr_t)fmt, args...);
+}
+
+#endif /* APP_LOG_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,113 @@
+/******************************************************************************
+ * File Name: app_mcast.cpp
+ *
+ * Description:
+ *   Enforcement of the multicast group membership of the IP stack in the
+ *   WLAN while the network stack is suspended.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "app_mcast.h"
+#include "app_olm.h"
+#include "app_xip.h"
+#include "whd_emac.h"
+#include "whd_wifi_api.h"
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+/* All-multicast mode of the WLAN while the network stack runs, read once on
+ * the first suspend. The application does not change the mode afterwards.
+ */
+static uint32_t mcast_allmulti = 0;
+static bool mcast_allmulti_known = false;
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/******************************************************************************
+ * Function Name: app_mcast_olm_hook
+ ******************************************************************************
+ * Summary:
+ *   Offload manager hook. Turns the all-multicast mode of the WLAN off while
+ *   the network stack is suspended, so only the groups joined by the IP
+ *   stack pass, and restores it on resume. The mode is read on the first
+ *   suspend only, so each transition costs at most one set IOCTL, and none
+ *   when the mode is off.
+ *
+ * Parameters:
+ *   suspended: true on suspend, false on resume.
+ *
+ *****************************************************************************/
+APP_HOT static void app_mcast_olm_hook(bool suspended)
+{
+    whd_interface_t ifp = WHD_EMAC::get_instance().ifp;
+
+    if (NULL == ifp)
+    {
+        return;
+    }
+
+    if (suspended && !mcast_allmulti_known)
+    {
+        mcast_allmulti_known =
+            (WHD_SUCCESS == whd_wifi_get_iovar_value(ifp, "allmulti",
+                                                     &mcast_allmulti));
+    }
+
+    /* Nothing to switch, and no bus transaction, with the mode off. */
+    if (mcast_allmulti_known && (0 != mcast_allmulti))
+    {
+        (void)whd_wifi_set_iovar_value(ifp, "allmulti", suspended ? 0 : mcast_allmulti);
+    }
+}
+
+/******************************************************************************
+ * Function Name: app_mcast_init
+ ******************************************************************************
+ * Summary:
+ *   Starts enforcing the multicast group membership while the network stack
+ *   is suspended.
+ *
+ * Return:
+ *   cy_rslt_t: Result of the hook registration.
+ *
+ *****************************************************************************/
+cy_rslt_t app_mcast_init(void)
+{
+    return app_olm_add_hook(app_mcast_olm_hook);
+}
+
+/* [] END OF FILE */
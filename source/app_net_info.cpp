@@ -0,0 +1,176 @@
+/******************************************************************************
+ * File Name: app_net_info.cpp
+ *
+ * Description:
+ *   Cached snapshot of the link parameters of the WLAN interface.
+ *   MAC, netmask, gateway and IP address do not change while the link is
+ *   up, so they are gathered in a single pass and kept until the next link
+ *   event. The RSSI query goes through the WHD IOCTL path and is refreshed
+ *   only when the cached value is older than
+ *   MBED_CONF_APP_NET_INFO_RSSI_MAX_AGE_MS.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "app_net_info.h"
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+/* Serializes access to the cached snapshot. */
+static Mutex net_info_mutex;
+
+/* Cached snapshot and its state. */
+static app_net_info_t net_info_cache;
+static bool net_info_stable_valid = false;
+static bool net_info_rssi_valid = false;
+static Kernel::Clock::time_point net_info_rssi_time;
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/******************************************************************************
+ * Function Name: app_net_info_link_event
+ ******************************************************************************
+ * Summary:
+ *   Network interface event listener. Any connection status change may
+ *   change the link parameters, so the cached snapshot is invalidated.
+ *
+ * Parameters:
+ *   event: Network interface event.
+ *   status: Event specific value, unused.
+ *
+ *****************************************************************************/
+static void app_net_info_link_event(nsapi_event_t event, intptr_t status)
+{
+    (void)status;
+
+    if (NSAPI_EVENT_CONNECTION_STATUS_CHANGE == event)
+    {
+        app_net_info_invalidate();
+    }
+}
+
+/******************************************************************************
+ * Function Name: app_net_info_attach
+ ******************************************************************************
+ * Summary:
+ *   Registers the link event listener which invalidates the snapshot. To be
+ *   called once after the interface is created.
+ *
+ * Parameters:
+ *   wifi: A pointer to WLAN interface.
+ *
+ *****************************************************************************/
+void app_net_info_attach(WhdSTAInterface *wifi)
+{
+    wifi->add_event_listener(mbed::callback(app_net_info_link_event));
+}
+
+/******************************************************************************
+ * Function Name: app_net_info_invalidate
+ ******************************************************************************
+ * Summary:
+ *   Drops the cached snapshot. The next app_net_info_get() call queries all
+ *   link parameters again.
+ *
+ *****************************************************************************/
+void app_net_info_invalidate(void)
+{
+    net_info_mutex.lock();
+    net_info_stable_valid = false;
+    net_info_rssi_valid = false;
+    net_info_mutex.unlock();
+}
+
+/******************************************************************************
+ * Function Name: app_net_info_get
+ ******************************************************************************
+ * Summary:
+ *   Returns a snapshot of the link parameters. The stable parameters are
+ *   queried from the interface only if the cache was invalidated and the
+ *   RSSI only if the cached value is older than the configured maximum age.
+ *
+ * Parameters:
+ *   wifi: A pointer to WLAN interface.
+ *   info: Snapshot to be filled.
+ *
+ * Return:
+ *   cy_rslt_t: Returns CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if the
+ *              interface has no IP address.
+ *
+ *****************************************************************************/
+cy_rslt_t app_net_info_get(WhdSTAInterface *wifi, app_net_info_t *info)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    Kernel::Clock::time_point now = Kernel::Clock::now();
+
+    net_info_mutex.lock();
+
+    if (!net_info_stable_valid)
+    {
+        memset(net_info_cache.mac, 0, sizeof(net_info_cache.mac));
+        strncpy(net_info_cache.mac, wifi->get_mac_address(),
+                sizeof(net_info_cache.mac) - 1);
+        wifi->get_netmask(&net_info_cache.netmask);
+        wifi->get_gateway(&net_info_cache.gateway);
+
+        if (NSAPI_ERROR_OK == wifi->get_ip_address(&net_info_cache.ip))
+        {
+            net_info_stable_valid = true;
+        }
+        else
+        {
+            result = CY_RSLT_TYPE_ERROR;
+        }
+    }
+
+    if ((!net_info_rssi_valid) ||
+        ((now - net_info_rssi_time) >=
+         std::chrono::milliseconds(MBED_CONF_APP_NET_INFO_RSSI_MAX_AGE_MS)))
+    {
+        net_info_cache.rssi = wifi->get_rssi();
+        net_info_rssi_time = now;
+        net_info_rssi_valid = true;
+    }
+
+    *info = net_info_cache;
+
+    net_info_mutex.unlock();
+
+    return result;
+}
+
+
+/* [] END OF FILE */
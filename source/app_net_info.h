@@ -0,0 +1,78 @@
+/******************************************************************************
+ * File Name: app_net_info.h
+ *
+ * Description:
+ *   Cached snapshot of the link parameters of the WLAN interface. The
+ *   stable parameters are queried once per link and invalidated on link
+ *   events, the RSSI is refreshed only once it is older than a maximum age.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef APP_NET_INFO_H
+#define APP_NET_INFO_H
+
+#include "mbed.h"
+#include "WhdSTAInterface.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+/* Length of the MAC address string "xx:xx:xx:xx:xx:xx" including the NUL. */
+#define APP_NET_INFO_MAC_STR_LEN       (18)
+
+/******************************************************************************
+ *                          TYPE DEFINITIONS
+ *****************************************************************************/
+/* Link parameters of the WLAN interface. */
+typedef struct
+{
+    char          mac[APP_NET_INFO_MAC_STR_LEN];  /* WLAN MAC address.     */
+    SocketAddress netmask;                        /* Network mask.         */
+    SocketAddress gateway;                        /* Default gateway.      */
+    SocketAddress ip;                             /* IP address.           */
+    int8_t        rssi;                           /* Last RSSI in dBm.     */
+} app_net_info_t;
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+void app_net_info_attach(WhdSTAInterface *wifi);
+cy_rslt_t app_net_info_get(WhdSTAInterface *wifi, app_net_info_t *info);
+void app_net_info_invalidate(void);
+
+#endif /* APP_NET_INFO_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,701 @@
+/******************************************************************************
+ * File Name: app_ol_list.cpp
+ *
+ * Description:
+ *   Offload list combining the generated offloads with the ones enabled in
+ *   mbed_app.json.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "app_ol_list.h"
+#include "app_olm.h"
+#include "app_log.h"
+#include "app_xip.h"
+#include "whd_emac.h"
+#include "whd_wifi_api.h"
+#include "cy_lpa_wifi_arp_ol.h"
+#include "cy_lpa_wifi_tko_ol.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#define ETH_TYPE_ARP               (0x0806U)
+#define ETH_TYPE_EAPOL             (0x888EU)
+#define PORT_DNS                   (53U)
+#define PORT_DHCP_CLIENT           (68U)
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+typedef struct
+{
+    uint32_t preset;
+    uint16_t port;
+} app_pf_preset_port_t;
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+/* Destination ports of the discard presets. */
+static const app_pf_preset_port_t pf_preset_ports[] =
+{
+    { APP_PF_PRESET_SSDP,    1900 },
+    { APP_PF_PRESET_MDNS,    5353 },
+    { APP_PF_PRESET_LLMNR,   5355 },
+    { APP_PF_PRESET_NETBIOS, 137  },
+    { APP_PF_PRESET_NETBIOS, 138  },
+    { APP_PF_PRESET_WSD,     3702 },
+};
+
+#if MBED_CONF_APP_ARP_OFFLOAD
+/* Answers ARP requests for the host address, and with the peer auto reply
+ * for the peers in the snooped cache, while the host is suspended.
+ */
+static arp_ol_t arp_ol;
+static const arp_ol_cfg_t arp_ol_cfg =
+{
+    .awake_enable_mask = 0,
+    .sleep_enable_mask = ARP_OL_AGENT | ARP_OL_HOST_AUTO_REPLY
+#if MBED_CONF_APP_ARP_OFFLOAD_SNOOP
+                         | ARP_OL_SNOOP
+#endif
+#if MBED_CONF_APP_ARP_OFFLOAD_PEER_AUTO_REPLY
+                         | ARP_OL_PEER_AUTO_REPLY
+#endif
+                         ,
+    .peerage = MBED_CONF_APP_ARP_OFFLOAD_PEERAGE,
+};
+#endif /* MBED_CONF_APP_ARP_OFFLOAD */
+
+#if MBED_CONF_APP_TKO_OFFLOAD
+/* Sends the keepalives of the listed TCP connections while the host is
+ * suspended. The offload reads the connections when the network stack is
+ * suspended, so the list is writable and filled in at runtime.
+ */
+static tko_ol_t tko_ol;
+static cy_tko_ol_cfg_t tko_ol_cfg =
+{
+    .interval = MBED_CONF_APP_TKO_OFFLOAD_INTERVAL,
+    .retry_interval = MBED_CONF_APP_TKO_OFFLOAD_RETRY_INTERVAL,
+    .retry_count = MBED_CONF_APP_TKO_OFFLOAD_RETRY_COUNT,
+    .ports = {},    /* Filled in by app_ol_list_tko_set() */
+};
+#endif /* MBED_CONF_APP_TKO_OFFLOAD */
+
+/* Packet filters of the list, terminated by CY_PF_OL_FEAT_LAST. They are
+ * applied with the context of the generated packet filter offload, or with
+ * pf_ol if the generated list has none.
+ */
+static pf_ol_t pf_ol;
+static cy_pf_ol_cfg_t pf_cfg[APP_OL_PF_MAX + 1];
+static uint8_t pf_count = 0;
+
+/* Group of each filter and the profile it has while its group is active. */
+static uint8_t pf_group[APP_OL_PF_MAX];
+static uint32_t pf_group_profile[APP_OL_PF_MAX];
+
+/* Filters added by app_ol_list_pf_add() before the list is built. */
+static cy_pf_ol_cfg_t pf_extra[APP_OL_PF_MAX];
+static uint8_t pf_extra_count = 0;
+
+/* Room for the NULL terminated list. */
+static ol_desc_t ol_list[APP_OL_LIST_MAX + 1];
+static uint8_t ol_count = 0;
+static bool ol_list_built = false;
+
+/* Set when an offload or a packet filter did not fit, the list is then
+ * not applied at all.
+ */
+static bool ol_list_full = false;
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+extern "C" const ol_desc_t *cycfg_get_default_ol_list(void);
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/******************************************************************************
+ * Function Name: app_ol_list_add
+ ******************************************************************************
+ * Summary:
+ *   Appends an offload to the list.
+ *
+ * Parameters:
+ *   name: Name of the offload, used by the offload manager lookups.
+ *   cfg: Configuration of the offload.
+ *   fns: Functions of the offload type.
+ *   ol: Context of the offload.
+ *
+ *****************************************************************************/
+static void app_ol_list_add(const char *name, const void *cfg,
+                            const ol_fns_t *fns, void *ol)
+{
+    if (APP_OL_LIST_MAX <= ol_count)
+    {
+        ERR_INFO(("Offload %s does not fit, increase APP_OL_LIST_MAX.\n", name));
+        ol_list_full = true;
+        return;
+    }
+
+    ol_list[ol_count].name = name;
+    ol_list[ol_count].cfg = cfg;
+    ol_list[ol_count].fns = fns;
+    ol_list[ol_count].ol = ol;
+    ol_count++;
+}
+
+/******************************************************************************
+ * Function Name: app_ol_pf_add
+ ******************************************************************************
+ * Summary:
+ *   Appends a packet filter.
+ *
+ * Parameters:
+ *   filter: Filter to append.
+ *
+ * Return:
+ *   cy_pf_ol_cfg_t *: Appended filter, or NULL if the list is full.
+ *
+ *****************************************************************************/
+static cy_pf_ol_cfg_t *app_ol_pf_add(const cy_pf_ol_cfg_t *filter)
+{
+    if (APP_OL_PF_MAX <= pf_count)
+    {
+        ERR_INFO(("Packet filter does not fit, increase APP_OL_PF_MAX.\n"));
+        ol_list_full = true;
+        return NULL;
+    }
+
+    pf_cfg[pf_count] = *filter;
+    return &pf_cfg[pf_count++];
+}
+
+/******************************************************************************
+ * Function Name: app_ol_pf_next_id
+ ******************************************************************************
+ * Summary:
+ *   Returns a filter id not used by any packet filter of the list.
+ *
+ * Return:
+ *   uint8_t: Filter id.
+ *
+ *****************************************************************************/
+static uint8_t app_ol_pf_next_id(void)
+{
+    uint8_t id = 0;
+
+    for (uint8_t i = 0; i < pf_count; i++)
+    {
+        if (pf_cfg[i].id >= id)
+        {
+            id = pf_cfg[i].id + 1;
+        }
+    }
+
+    return id;
+}
+
+#if (APP_PF_POLICY_ALLOW == MBED_CONF_APP_PF_POLICY) || \
+    MBED_CONF_APP_PF_QUIET_ENABLE
+/******************************************************************************
+ * Function Name: app_ol_pf_keep
+ ******************************************************************************
+ * Summary:
+ *   Appends a keep filter of the sleep profile.
+ *
+ * Parameters:
+ *   filter: Filter with its feature and value set.
+ *
+ *****************************************************************************/
+static void app_ol_pf_keep(cy_pf_ol_cfg_t *filter)
+{
+    filter->bits = APP_PF_PROFILE_SLEEP;
+    filter->id = app_ol_pf_next_id();
+    app_ol_pf_add(filter);
+}
+
+/******************************************************************************
+ * Function Name: app_ol_pf_keep_port
+ ******************************************************************************
+ * Summary:
+ *   Appends a keep filter of the sleep profile for a port.
+ *
+ * Parameters:
+ *   port: Port number, 0 is ignored.
+ *   source: Match the source port instead of the destination port.
+ *
+ *****************************************************************************/
+static void app_ol_pf_keep_port(uint16_t port, bool source)
+{
+    cy_pf_ol_cfg_t filter = {};
+
+    if (0 == port)
+    {
+        return;
+    }
+
+    filter.feature = CY_PF_OL_FEAT_PORTNUM;
+    filter.u.port.portnum = port;
+    filter.u.port.range = 0;
+    filter.u.port.direction = source ? PF_PN_PORT_SOURCE : PF_PN_PORT_DEST;
+    app_ol_pf_keep(&filter);
+}
+#endif /* APP_PF_POLICY_ALLOW || MBED_CONF_APP_PF_QUIET_ENABLE */
+
+/******************************************************************************
+ * Function Name: app_ol_pf_apply_allowlist
+ ******************************************************************************
+ * Summary:
+ *   With the APP_PF_POLICY_ALLOW policy, replaces the filters by keep
+ *   filters of the sleep profile. As soon as one keep filter is active the
+ *   WLAN drops every packet not matching a keep filter, which makes the
+ *   default-drop catch-all. The discard filters, generated or selected by
+ *   pf-presets, are then redundant and dropped to free their slots. Kept
+ *   are ARP, EAPOL, DHCP client, DNS responses and the application ports.
+ *   ARP requests for other addresses still pass unless the ARP offload
+ *   answers them. A keep filter that does not fit fails the list, see
+ *   app_ol_list_get(): without it the default-drop would also drop the
+ *   traffic it keeps.
+ *
+ *****************************************************************************/
+APP_XIP static void app_ol_pf_apply_allowlist(void)
+{
+#if (APP_PF_POLICY_ALLOW == MBED_CONF_APP_PF_POLICY)
+    static const uint16_t local_ports[] = MBED_CONF_APP_PF_KEEP_LOCAL_PORTS;
+    static const uint16_t remote_ports[] = MBED_CONF_APP_PF_KEEP_REMOTE_PORTS;
+    cy_pf_ol_cfg_t filter = {};
+
+    pf_count = 0;
+
+    filter.feature = CY_PF_OL_FEAT_ETHTYPE;
+    filter.u.eth.eth_type = ETH_TYPE_ARP;
+    app_ol_pf_keep(&filter);
+
+    filter.u.eth.eth_type = ETH_TYPE_EAPOL;
+    app_ol_pf_keep(&filter);
+
+    app_ol_pf_keep_port(PORT_DHCP_CLIENT, false);
+    app_ol_pf_keep_port(PORT_DNS, true);
+
+    for (size_t i = 0; i < sizeof(local_ports) / sizeof(local_ports[0]); i++)
+    {
+        app_ol_pf_keep_port(local_ports[i], false);
+    }
+
+    for (size_t i = 0; i < sizeof(remote_ports) / sizeof(remote_ports[0]); i++)
+    {
+        app_ol_pf_keep_port(remote_ports[i], true);
+    }
+#endif /* APP_PF_POLICY_ALLOW */
+}
+
+/******************************************************************************
+ * Function Name: app_ol_pf_apply_quiet
+ ******************************************************************************
+ * Summary:
+ *   Appends the quiet hours allowlist: keep filters of the sleep profile for
+ *   ARP, EAPOL, DHCP, DNS responses and the pf-quiet-keep-ports. They form
+ *   the APP_PF_GROUP_QUIET group, inactive until app_pf_sched switches it
+ *   on. While they are active the WLAN drops all other traffic.
+ *
+ *****************************************************************************/
+APP_XIP static void app_ol_pf_apply_quiet(void)
+{
+#if MBED_CONF_APP_PF_QUIET_ENABLE
+    static const uint16_t quiet_ports[] = MBED_CONF_APP_PF_QUIET_KEEP_PORTS;
+    uint8_t first = pf_count;
+    cy_pf_ol_cfg_t filter = {};
+
+    filter.feature = CY_PF_OL_FEAT_ETHTYPE;
+    filter.u.eth.eth_type = ETH_TYPE_ARP;
+    app_ol_pf_keep(&filter);
+
+    filter.u.eth.eth_type = ETH_TYPE_EAPOL;
+    app_ol_pf_keep(&filter);
+
+    app_ol_pf_keep_port(PORT_DHCP_CLIENT, false);
+    app_ol_pf_keep_port(PORT_DNS, true);
+
+    for (size_t i = 0; i < sizeof(quiet_ports) / sizeof(quiet_ports[0]); i++)
+    {
+        app_ol_pf_keep_port(quiet_ports[i], false);
+    }
+
+    for (uint8_t i = first; i < pf_count; i++)
+    {
+        pf_group[i] = APP_PF_GROUP_QUIET;
+        pf_group_profile[i] = pf_cfg[i].bits & APP_PF_PROFILE_ALWAYS;
+        pf_cfg[i].bits &= ~APP_PF_PROFILE_ALWAYS;
+    }
+#endif /* MBED_CONF_APP_PF_QUIET_ENABLE */
+}
+
+/******************************************************************************
+ * Function Name: app_ol_pf_apply_presets
+ ******************************************************************************
+ * Summary:
+ *   Appends the discard presets selected by the pf-presets option. They only
+ *   belong to the sleep profile, so the discovery protocols keep working
+ *   while the host is awake.
+ *
+ *****************************************************************************/
+APP_XIP static void app_ol_pf_apply_presets(void)
+{
+    for (size_t i = 0; i < sizeof(pf_preset_ports) / sizeof(pf_preset_ports[0]); i++)
+    {
+        cy_pf_ol_cfg_t filter = {};
+
+        if (0 == (MBED_CONF_APP_PF_PRESETS & pf_preset_ports[i].preset))
+        {
+            continue;
+        }
+
+        filter.feature = CY_PF_OL_FEAT_PORTNUM;
+        filter.bits = APP_PF_PROFILE_SLEEP | CY_PF_ACTION_DISCARD;
+        filter.id = app_ol_pf_next_id();
+        filter.u.port.portnum = pf_preset_ports[i].port;
+        filter.u.port.range = 0;
+        filter.u.port.direction = PF_PN_PORT_DEST;
+        app_ol_pf_add(&filter);
+    }
+}
+
+/******************************************************************************
+ * Function Name: app_ol_pf_apply_profiles
+ ******************************************************************************
+ * Summary:
+ *   With the pf-permissive-wake option, moves the discard filters of the
+ *   design and the presets to the sleep profile, so the host receives all
+ *   traffic while it is awake. Then appends the filters added by
+ *   app_ol_list_pf_add(), which keep the profile they were added to.
+ *
+ *****************************************************************************/
+APP_XIP static void app_ol_pf_apply_profiles(void)
+{
+#if MBED_CONF_APP_PF_PERMISSIVE_WAKE
+    for (uint8_t i = 0; i < pf_count; i++)
+    {
+        if (0 != (pf_cfg[i].bits & CY_PF_ACTION_DISCARD))
+        {
+            pf_cfg[i].bits &= ~CY_PF_ACTIVE_WAKE;
+        }
+    }
+#endif /* MBED_CONF_APP_PF_PERMISSIVE_WAKE */
+
+    for (uint8_t i = 0; i < pf_extra_count; i++)
+    {
+        cy_pf_ol_cfg_t *filter = app_ol_pf_add(&pf_extra[i]);
+
+        if (NULL != filter)
+        {
+            filter->id = app_ol_pf_next_id();
+        }
+    }
+}
+
+/******************************************************************************
+ * Function Name: app_ol_list_pf_add
+ ******************************************************************************
+ * Summary:
+ *   Adds a packet filter to a profile. The filter id is assigned when the
+ *   list is built. Must be called before the WLAN interface is created.
+ *
+ * Parameters:
+ *   filter: Filter to add, its CY_PF_ACTIVE_* bits are ignored.
+ *   profile: APP_PF_PROFILE_SLEEP, APP_PF_PROFILE_WAKE or
+ *            APP_PF_PROFILE_ALWAYS.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if the list is already
+ *   built or full.
+ *
+ *****************************************************************************/
+cy_rslt_t app_ol_list_pf_add(const cy_pf_ol_cfg_t *filter, uint32_t profile)
+{
+    if (ol_list_built || (APP_OL_PF_MAX <= pf_extra_count))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    pf_extra[pf_extra_count] = *filter;
+    pf_extra[pf_extra_count].bits = (filter->bits & ~APP_PF_PROFILE_ALWAYS) |
+                                    (profile & APP_PF_PROFILE_ALWAYS);
+    pf_extra_count++;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/******************************************************************************
+ * Function Name: app_ol_list_pf_print
+ ******************************************************************************
+ * Summary:
+ *   Logs the packet filters of the list with their profiles (S for sleep,
+ *   W for wake) and action.
+ *
+ *****************************************************************************/
+APP_XIP void app_ol_list_pf_print(void)
+{
+    static const char *const profile_name[] = { "--", "S-", "-W", "SW" };
+
+    for (uint8_t i = 0; i < pf_count; i++)
+    {
+        const cy_pf_ol_cfg_t *f = &pf_cfg[i];
+        bool port = (CY_PF_OL_FEAT_PORTNUM == f->feature);
+        bool eth = (CY_PF_OL_FEAT_ETHTYPE == f->feature);
+        uint32_t value = port ? f->u.port.portnum :
+                         eth  ? f->u.eth.eth_type : f->u.ip.ip_type;
+
+        /* Parsed by tools/pf_replay.py. */
+        APP_INFO(("Filter %u: %s %lu%s %s %s\n", f->id,
+                  port ? "port" : (eth ? "ethtype" : "iptype"),
+                  (unsigned long)value,
+                  !port ? "" :
+                  ((PF_PN_PORT_SOURCE == f->u.port.direction) ? "/src" : "/dst"),
+                  profile_name[(f->bits & APP_PF_PROFILE_ALWAYS) ==
+                               APP_PF_PROFILE_ALWAYS ? 3 :
+                               (0 != (f->bits & CY_PF_ACTIVE_WAKE)) ? 2 :
+                               (0 != (f->bits & CY_PF_ACTIVE_SLEEP)) ? 1 : 0],
+                  (0 != (f->bits & CY_PF_ACTION_DISCARD)) ? "discard" : "keep"));
+    }
+}
+
+/******************************************************************************
+ * Function Name: app_ol_list_pf_set_group
+ ******************************************************************************
+ * Summary:
+ *   Switches all filters of a group on or off. The profiles are updated
+ *   for the next suspend and resume. While the network stack is suspended
+ *   the filters of the sleep profile are also switched in the WLAN right
+ *   away. The whole group is switched with the offload manager locked, so
+ *   a suspend or resume sees either none or all of its filters switched.
+ *
+ * Parameters:
+ *   group: APP_PF_GROUP_* group.
+ *   active: true to switch the group on.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if the WLAN rejected
+ *   a filter.
+ *
+ *****************************************************************************/
+APP_HOT cy_rslt_t app_ol_list_pf_set_group(uint8_t group, bool active)
+{
+    whd_interface_t ifp = WHD_EMAC::get_instance().ifp;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if (APP_PF_GROUP_NONE == group)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    app_olm_lock();
+
+    for (uint8_t i = 0; i < pf_count; i++)
+    {
+        if (group == pf_group[i])
+        {
+            pf_cfg[i].bits = (pf_cfg[i].bits & ~APP_PF_PROFILE_ALWAYS) |
+                             (active ? pf_group_profile[i] : 0);
+        }
+    }
+
+    for (uint8_t i = 0; (NULL != ifp) && app_olm_is_suspended() && (i < pf_count); i++)
+    {
+        if (group != pf_group[i])
+        {
+            continue;
+        }
+
+        if (0 != (pf_cfg[i].bits & APP_PF_PROFILE_SLEEP))
+        {
+            result |= whd_pf_enable_packet_filter(ifp, pf_cfg[i].id);
+        }
+        else
+        {
+            result |= whd_pf_disable_packet_filter(ifp, pf_cfg[i].id);
+        }
+    }
+
+    app_olm_unlock();
+
+    return (CY_RSLT_SUCCESS == result) ? CY_RSLT_SUCCESS : CY_RSLT_TYPE_ERROR;
+}
+
+/******************************************************************************
+ * Function Name: app_ol_list_get
+ ******************************************************************************
+ * Summary:
+ *   Builds the offload list on the first call and returns it. Must be
+ *   called before the WLAN interface is initialized.
+ *
+ * Return:
+ *   ol_desc_t *: NULL terminated offload list, or NULL if the offloads or
+ *   the packet filters exceed APP_OL_LIST_MAX or APP_OL_PF_MAX.
+ *
+ *****************************************************************************/
+APP_XIP ol_desc_t *app_ol_list_get(void)
+{
+    if (ol_list_built)
+    {
+        return ol_list_full ? NULL : ol_list;
+    }
+
+    void *pf_ctx = &pf_ol;
+
+    for (const ol_desc_t *ol = cycfg_get_default_ol_list();
+         (NULL != ol) && (NULL != ol->name); ol++)
+    {
+        if (&pf_ol_fns != ol->fns)
+        {
+            app_ol_list_add(ol->name, ol->cfg, ol->fns, ol->ol);
+            continue;
+        }
+
+        /* Copied and added once all filters are known. */
+        for (const cy_pf_ol_cfg_t *filter = (const cy_pf_ol_cfg_t *)ol->cfg;
+             CY_PF_OL_FEAT_LAST != filter->feature; filter++)
+        {
+            app_ol_pf_add(filter);
+        }
+
+        pf_ctx = ol->ol;
+    }
+
+    app_ol_pf_apply_presets();
+    app_ol_pf_apply_allowlist();
+    app_ol_pf_apply_quiet();
+    app_ol_pf_apply_profiles();
+
+    if (0 != pf_count)
+    {
+        pf_cfg[pf_count].feature = CY_PF_OL_FEAT_LAST;
+        app_ol_list_add("Pkt_Filter", pf_cfg, &pf_ol_fns, pf_ctx);
+    }
+
+#if MBED_CONF_APP_ARP_OFFLOAD
+    app_ol_list_add("ARP", &arp_ol_cfg, &arp_ol_fns, &arp_ol);
+#endif /* MBED_CONF_APP_ARP_OFFLOAD */
+
+#if MBED_CONF_APP_TKO_OFFLOAD
+    app_ol_list_add("TKO", &tko_ol_cfg, &tko_ol_fns, &tko_ol);
+#endif /* MBED_CONF_APP_TKO_OFFLOAD */
+
+    ol_list_built = true;
+    return ol_list_full ? NULL : ol_list;
+}
+
+/******************************************************************************
+ * Function Name: app_ol_list_tko_set
+ ******************************************************************************
+ * Summary:
+ *   Adds a connected TCP socket to the connections kept alive by the WLAN
+ *   while the network stack is suspended. The offload takes the sequence
+ *   and acknowledgement numbers from the TCP stack on suspend. Keepalives
+ *   reuse the last acknowledged sequence number, so the TCP stack resumes
+ *   the connection with consistent numbers. Data received on the connection
+ *   wakes the host. Must not be called while the network stack is
+ *   suspended.
+ *
+ * Parameters:
+ *   index: Slot of the connection.
+ *   remote: IPv4 address and port of the peer.
+ *   local_port: Local port of the socket, see TCPSocket::bind().
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if the offload is
+ *   disabled, the slot does not exist or the peer is not IPv4.
+ *
+ *****************************************************************************/
+cy_rslt_t app_ol_list_tko_set(uint8_t index, const SocketAddress &remote,
+                              uint16_t local_port)
+{
+#if MBED_CONF_APP_TKO_OFFLOAD
+    if ((index >= (sizeof(tko_ol_cfg.ports) / sizeof(tko_ol_cfg.ports[0]))) ||
+        (NSAPI_IPv4 != remote.get_ip_version()))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    strncpy(tko_ol_cfg.ports[index].remote_ip, remote.get_ip_address(),
+            sizeof(tko_ol_cfg.ports[index].remote_ip) - 1);
+    tko_ol_cfg.ports[index].remote_port = remote.get_port();
+    tko_ol_cfg.ports[index].local_port = local_port;
+
+    return CY_RSLT_SUCCESS;
+#else
+    (void)index;
+    (void)remote;
+    (void)local_port;
+    return CY_RSLT_TYPE_ERROR;
+#endif /* MBED_CONF_APP_TKO_OFFLOAD */
+}
+
+/******************************************************************************
+ * Function Name: app_ol_list_tko_clear
+ ******************************************************************************
+ * Summary:
+ *   Removes a connection from the TCP keepalive offload, for example before
+ *   the socket is closed. Must not be called while the network stack is
+ *   suspended.
+ *
+ * Parameters:
+ *   index: Slot of the connection.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if the offload is
+ *   disabled or the slot does not exist.
+ *
+ *****************************************************************************/
+cy_rslt_t app_ol_list_tko_clear(uint8_t index)
+{
+#if MBED_CONF_APP_TKO_OFFLOAD
+    if (index >= (sizeof(tko_ol_cfg.ports) / sizeof(tko_ol_cfg.ports[0])))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    memset(&tko_ol_cfg.ports[index], 0, sizeof(tko_ol_cfg.ports[index]));
+
+    return CY_RSLT_SUCCESS;
+#else
+    (void)index;
+    return CY_RSLT_TYPE_ERROR;
+#endif /* MBED_CONF_APP_TKO_OFFLOAD */
+}
+
+
+/* [] END OF FILE */
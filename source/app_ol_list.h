@@ -0,0 +1,111 @@
+/******************************************************************************
+ * File Name: app_ol_list.h
+ *
+ * Description:
+ *   Offload list applied by the LPA offload manager. The list starts with the
+ *   offloads generated by the device configurator (cycfg_get_default_ol_list())
+ *   and appends the offloads enabled in mbed_app.json, so they do not require a
+ *   change of the generated sources.
+ *   The packet filters of the generated list are copied, so more filters
+ *   can be added.
+ *   Each filter belongs to the sleep profile, the wake profile or both.
+ *   Discard presets for discovery protocols are selected per target with the
+ *   pf-presets option. The pf-policy option turns the list into an
+ *   allowlist of keep filters. Filters of a group, such as the quiet hours
+ *   allowlist, are switched on and off at runtime.
+ *   The connections kept alive by the TCP keepalive offload are only known
+ *   at runtime and are set with app_ol_list_tko_set().
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef APP_OL_LIST_H
+#define APP_OL_LIST_H
+
+#include "mbed.h"
+#include "cy_lpa_wifi_ol.h"
+#include "cy_lpa_wifi_pf_ol.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+/* Maximum number of offloads of the list, the generated ones included. */
+#define APP_OL_LIST_MAX            (8)
+
+/* Maximum number of packet filters, the generated ones included. */
+#define APP_OL_PF_MAX              (8)
+
+/* Filter groups switched at runtime with app_ol_list_pf_set_group(). */
+#define APP_PF_GROUP_NONE          (0)  /* Never switched */
+#define APP_PF_GROUP_QUIET         (1)  /* Quiet hours allowlist */
+
+/* Filter policies, see the pf-policy option of mbed_app.json. */
+#define APP_PF_POLICY_DENY         (0)  /* Discard listed, pass the rest */
+#define APP_PF_POLICY_ALLOW        (1)  /* Keep listed, drop the rest */
+
+/* Filter profiles. The offload manager enables the filters of the sleep
+ * profile when the network stack is suspended and the ones of the wake
+ * profile when it resumes.
+ */
+#define APP_PF_PROFILE_SLEEP       (CY_PF_ACTIVE_SLEEP)
+#define APP_PF_PROFILE_WAKE        (CY_PF_ACTIVE_WAKE)
+#define APP_PF_PROFILE_ALWAYS      (CY_PF_ACTIVE_SLEEP | CY_PF_ACTIVE_WAKE)
+
+/* Discard presets for well-known discovery chatter, see the pf-presets
+ * option of mbed_app.json. Each port costs one filter slot.
+ */
+#define APP_PF_PRESET_SSDP         (1UL << 0)  /* UDP 1900 */
+#define APP_PF_PRESET_MDNS         (1UL << 1)  /* UDP 5353 */
+#define APP_PF_PRESET_LLMNR        (1UL << 2)  /* UDP 5355 */
+#define APP_PF_PRESET_NETBIOS      (1UL << 3)  /* UDP 137, 138 */
+#define APP_PF_PRESET_WSD          (1UL << 4)  /* UDP 3702 */
+#define APP_PF_PRESET_CHATTER      (APP_PF_PRESET_SSDP | APP_PF_PRESET_MDNS |  \
+                                    APP_PF_PRESET_LLMNR | APP_PF_PRESET_NETBIOS | \
+                                    APP_PF_PRESET_WSD)
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+ol_desc_t *app_ol_list_get(void);
+cy_rslt_t app_ol_list_pf_add(const cy_pf_ol_cfg_t *filter, uint32_t profile);
+void app_ol_list_pf_print(void);
+cy_rslt_t app_ol_list_pf_set_group(uint8_t group, bool active);
+cy_rslt_t app_ol_list_tko_set(uint8_t index, const SocketAddress &remote,
+                              uint16_t local_port);
+cy_rslt_t app_ol_list_tko_clear(uint8_t index);
+
+#endif /* APP_OL_LIST_H */
+
+
+/* [] END OF FILE */
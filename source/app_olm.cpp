@@ -0,0 +1,207 @@
+/******************************************************************************
+ * File Name: app_olm.cpp
+ *
+ * Description:
+ *   Offload manager of the Wi-Fi interface with suspend/resume hooks.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "app_olm.h"
+#include "app_ol_list.h"
+#include "app_xip.h"
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+static app_olm_hook_t olm_hooks[APP_OLM_MAX_HOOKS];
+static uint8_t olm_hook_count = 0;
+
+/* True while the offloads are in their sleep configuration. */
+static volatile bool olm_suspended = false;
+
+/* Serializes the transitions of the offload manager with the runtime
+ * changes of the offload configurations.
+ */
+static rtos::Mutex olm_mutex;
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+AppOlmInterface::AppOlmInterface(ol_desc_t *list) : CyOlmInterface(list)
+{
+}
+
+/******************************************************************************
+ * Function Name: AppOlmInterface::sleep
+ ******************************************************************************
+ * Summary:
+ *   Puts the offloads into their sleep configuration and then calls the
+ *   hooks. Called by the WLAN interface when the network stack is suspended.
+ *
+ * Return:
+ *   int: Result of the offload manager.
+ *
+ *****************************************************************************/
+APP_HOT int AppOlmInterface::sleep()
+{
+    olm_mutex.lock();
+    int ret = CyOlmInterface::sleep();
+    olm_suspended = true;
+    olm_mutex.unlock();
+
+    for (uint8_t i = 0; i < olm_hook_count; i++)
+    {
+        olm_hooks[i](true);
+    }
+
+    return ret;
+}
+
+/******************************************************************************
+ * Function Name: AppOlmInterface::wake
+ ******************************************************************************
+ * Summary:
+ *   Calls the hooks and then puts the offloads back into their wake
+ *   configuration. Called by the WLAN interface when the network stack
+ *   resumes.
+ *
+ * Return:
+ *   int: Result of the offload manager.
+ *
+ *****************************************************************************/
+APP_HOT int AppOlmInterface::wake()
+{
+    for (uint8_t i = 0; i < olm_hook_count; i++)
+    {
+        olm_hooks[i](false);
+    }
+
+    olm_mutex.lock();
+    olm_suspended = false;
+    int ret = CyOlmInterface::wake();
+    olm_mutex.unlock();
+
+    return ret;
+}
+
+/******************************************************************************
+ * Function Name: AppOlmInterface::get_instance
+ ******************************************************************************
+ * Summary:
+ *   Returns the offload manager to pass to the WLAN interface constructor.
+ *   It applies the offload list generated by the device configurator
+ *   extended by the offloads enabled in mbed_app.json.
+ *
+ * Return:
+ *   AppOlmInterface &: Offload manager instance.
+ *
+ *****************************************************************************/
+AppOlmInterface &AppOlmInterface::get_instance()
+{
+    static AppOlmInterface olm(app_ol_list_get());
+    return olm;
+}
+
+/******************************************************************************
+ * Function Name: app_olm_add_hook
+ ******************************************************************************
+ * Summary:
+ *   Registers a function called on every suspend and resume of the network
+ *   stack. Hooks must be registered before the first suspend.
+ *
+ * Parameters:
+ *   hook: Function to call.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if the hook table is
+ *   full.
+ *
+ *****************************************************************************/
+cy_rslt_t app_olm_add_hook(app_olm_hook_t hook)
+{
+    if (APP_OLM_MAX_HOOKS <= olm_hook_count)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    olm_hooks[olm_hook_count++] = hook;
+    return CY_RSLT_SUCCESS;
+}
+
+/******************************************************************************
+ * Function Name: app_olm_lock
+ ******************************************************************************
+ * Summary:
+ *   Blocks the suspend and resume of the offloads until app_olm_unlock().
+ *   Held while an offload configuration is changed at runtime, so the
+ *   change is applied as a whole before or after a transition. Must not be
+ *   called from an olm hook or an ISR.
+ *
+ *****************************************************************************/
+void app_olm_lock(void)
+{
+    olm_mutex.lock();
+}
+
+/******************************************************************************
+ * Function Name: app_olm_unlock
+ ******************************************************************************
+ * Summary:
+ *   Releases the lock taken by app_olm_lock().
+ *
+ *****************************************************************************/
+void app_olm_unlock(void)
+{
+    olm_mutex.unlock();
+}
+
+/******************************************************************************
+ * Function Name: app_olm_is_suspended
+ ******************************************************************************
+ * Summary:
+ *   Tells whether the offloads are in their sleep configuration, i.e. the
+ *   network stack is suspended.
+ *
+ * Return:
+ *   bool: true while suspended.
+ *
+ *****************************************************************************/
+bool app_olm_is_suspended(void)
+{
+    return olm_suspended;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,86 @@
+/******************************************************************************
+ * File Name: app_olm.h
+ *
+ * Description:
+ *   Offload manager used by the Wi-Fi interface of this application. It is the
+ *   LPA offload manager with hooks called when the network stack is suspended
+ *   and resumed, so application modules can act on each suspend cycle.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef APP_OLM_H
+#define APP_OLM_H
+
+#include "mbed.h"
+#include "cy_OlmInterface.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+/* Maximum number of registered suspend/resume hooks. */
+#define APP_OLM_MAX_HOOKS          (6)
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+/* Hook called with true right after the offloads entered their sleep
+ * configuration and with false right before they are woken up. Runs in the
+ * context of the thread calling wait_net_suspend().
+ */
+typedef void (*app_olm_hook_t)(bool suspended);
+
+class AppOlmInterface : public CyOlmInterface
+{
+public:
+    AppOlmInterface(ol_desc_t *list = NULL);
+
+    virtual int sleep();
+    virtual int wake();
+
+    static AppOlmInterface &get_instance();
+};
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+cy_rslt_t app_olm_add_hook(app_olm_hook_t hook);
+void app_olm_lock(void);
+void app_olm_unlock(void);
+bool app_olm_is_suspended(void);
+
+#endif /* APP_OLM_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,277 @@
+/******************************************************************************
+ * File Name: app_pf_sched.cpp
+ *
+ * Description:
+ *   Time scheduled packet filter policies.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "app_pf_sched.h"
+#include "app_ol_list.h"
+#include "app_log.h"
+#include "app_wco.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#define SECONDS_PER_DAY            (24UL * 60UL * 60UL)
+
+/* The RTC is not set before this date (2020-01-01). */
+#define APP_PF_SCHED_MIN_TIME      (1577836800L)
+
+/* Recheck period while the RTC is not set, and after a failed switch. */
+#define APP_PF_SCHED_RETRY_S       (60UL)
+
+/* Longest sleep of the schedule thread. The next boundary is recomputed on
+ * each wake, so a later change of the RTC, e.g. by NTP, is followed within
+ * this period.
+ */
+#define APP_PF_SCHED_MAX_WAIT_S    (3600UL)
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+static const app_pf_sched_entry_t pf_sched[] =
+{
+#if MBED_CONF_APP_PF_QUIET_ENABLE
+    {
+        MBED_CONF_APP_PF_QUIET_START_MIN,
+        MBED_CONF_APP_PF_QUIET_END_MIN,
+        APP_PF_GROUP_QUIET
+    },
+#endif /* MBED_CONF_APP_PF_QUIET_ENABLE */
+    { 0, 0, APP_PF_GROUP_NONE }
+};
+
+static app_pf_sched_clock_t pf_sched_clock = NULL;
+static rtos::Thread *pf_sched_thread = NULL;
+
+/* Bit i set while the group of entry i is switched on. */
+static uint8_t pf_sched_active = 0;
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/******************************************************************************
+ * Function Name: app_pf_sched_now
+ ******************************************************************************
+ * Summary:
+ *   Returns the local time of the schedule.
+ *
+ * Return:
+ *   time_t: Local time in seconds since the epoch.
+ *
+ *****************************************************************************/
+static time_t app_pf_sched_now(void)
+{
+    time_t now = (NULL != pf_sched_clock) ? pf_sched_clock() : time(NULL);
+
+    return now + (MBED_CONF_APP_PF_SCHED_UTC_OFFSET_MIN * 60L);
+}
+
+/******************************************************************************
+ * Function Name: app_pf_sched_is_active
+ ******************************************************************************
+ * Summary:
+ *   Tells whether a schedule entry is in its window.
+ *
+ * Parameters:
+ *   entry: Schedule entry.
+ *   now: Local time in seconds since the epoch.
+ *
+ * Return:
+ *   bool: true inside the window.
+ *
+ *****************************************************************************/
+bool app_pf_sched_is_active(const app_pf_sched_entry_t *entry, time_t now)
+{
+    uint32_t min = (uint32_t)((now % SECONDS_PER_DAY) / 60);
+
+    if (entry->start_min <= entry->end_min)
+    {
+        return (min >= entry->start_min) && (min < entry->end_min);
+    }
+
+    return (min >= entry->start_min) || (min < entry->end_min);
+}
+
+/******************************************************************************
+ * Function Name: app_pf_sched_next_s
+ ******************************************************************************
+ * Summary:
+ *   Returns the time until the next boundary of the window of an entry.
+ *
+ * Parameters:
+ *   entry: Schedule entry.
+ *   now: Local time in seconds since the epoch.
+ *
+ * Return:
+ *   uint32_t: Seconds until the next start or end of the window, at least 1.
+ *
+ *****************************************************************************/
+uint32_t app_pf_sched_next_s(const app_pf_sched_entry_t *entry, time_t now)
+{
+    uint32_t sec = (uint32_t)(now % SECONDS_PER_DAY);
+    uint32_t to_start = (entry->start_min * 60UL + SECONDS_PER_DAY - sec) % SECONDS_PER_DAY;
+    uint32_t to_end = (entry->end_min * 60UL + SECONDS_PER_DAY - sec) % SECONDS_PER_DAY;
+
+    to_start = (0 == to_start) ? SECONDS_PER_DAY : to_start;
+    to_end = (0 == to_end) ? SECONDS_PER_DAY : to_end;
+
+    return (to_start < to_end) ? to_start : to_end;
+}
+
+/******************************************************************************
+ * Function Name: app_pf_sched_step
+ ******************************************************************************
+ * Summary:
+ *   Switches the filter groups whose window started or ended. All entries
+ *   are evaluated against the same time, so the groups switched at an
+ *   instant change together. Called by the schedule thread, and by tests
+ *   with a fake clock, see app_pf_sched_set_clock().
+ *
+ * Return:
+ *   uint32_t: Seconds until the next window boundary, at most
+ *   APP_PF_SCHED_MAX_WAIT_S, or until the next check if the RTC is not set
+ *   or a group failed to switch.
+ *
+ *****************************************************************************/
+uint32_t app_pf_sched_step(void)
+{
+    time_t now = app_pf_sched_now();
+    uint32_t wait_s = SECONDS_PER_DAY;
+
+    if (now < APP_PF_SCHED_MIN_TIME)
+    {
+        return APP_PF_SCHED_RETRY_S;
+    }
+
+    for (size_t i = 0; APP_PF_GROUP_NONE != pf_sched[i].group; i++)
+    {
+        bool on = app_pf_sched_is_active(&pf_sched[i], now);
+        uint32_t next_s = app_pf_sched_next_s(&pf_sched[i], now);
+
+        if (on != (0 != (pf_sched_active & (1U << i))))
+        {
+            if (CY_RSLT_SUCCESS != app_ol_list_pf_set_group(pf_sched[i].group, on))
+            {
+                /* Left as it was, so the next step switches it again. */
+                ERR_INFO(("Failed to switch filter group %u.\n",
+                          pf_sched[i].group));
+                next_s = APP_PF_SCHED_RETRY_S;
+            }
+            else
+            {
+                pf_sched_active ^= (1U << i);
+                APP_INFO(("Filter group %u %s\n", pf_sched[i].group,
+                          on ? "on" : "off"));
+            }
+        }
+
+        wait_s = (next_s < wait_s) ? next_s : wait_s;
+    }
+
+    return (wait_s < APP_PF_SCHED_MAX_WAIT_S) ? wait_s : APP_PF_SCHED_MAX_WAIT_S;
+}
+
+/******************************************************************************
+ * Function Name: app_pf_sched_task
+ ******************************************************************************
+ * Summary:
+ *   Switches the filter groups of the schedule at the window boundaries.
+ *
+ *****************************************************************************/
+static void app_pf_sched_task(void)
+{
+    /* The RTC is clocked from the WCO, which may still be starting. */
+    if (!app_wco_wait_ready(osWaitForever))
+    {
+        ERR_INFO(("WCO startup failed, the RTC may not run.\n"));
+    }
+
+    while (true)
+    {
+        ThisThread::sleep_for(std::chrono::seconds(app_pf_sched_step()));
+    }
+}
+
+/******************************************************************************
+ * Function Name: app_pf_sched_start
+ ******************************************************************************
+ * Summary:
+ *   Starts the schedule thread if the schedule has any entry.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if the thread could
+ *   not be started.
+ *
+ *****************************************************************************/
+cy_rslt_t app_pf_sched_start(void)
+{
+    if ((APP_PF_GROUP_NONE == pf_sched[0].group) || (NULL != pf_sched_thread))
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    pf_sched_thread = new rtos::Thread(osPriorityBelowNormal, 2048, NULL,
+                                       "pf_sched");
+
+    if (osOK != pf_sched_thread->start(app_pf_sched_task))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/******************************************************************************
+ * Function Name: app_pf_sched_set_clock
+ ******************************************************************************
+ * Summary:
+ *   Replaces the RTC as the time source of the schedule, for testing
+ *   schedules with a fake clock. The schedule thread uses the new clock
+ *   from its next wake on, at most APP_PF_SCHED_MAX_WAIT_S later.
+ *
+ * Parameters:
+ *   clock: Function returning UTC seconds since the epoch, NULL for the RTC.
+ *
+ *****************************************************************************/
+void app_pf_sched_set_clock(app_pf_sched_clock_t clock)
+{
+    pf_sched_clock = clock;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,80 @@
+/******************************************************************************
+ * File Name: app_pf_sched.h
+ *
+ * Description:
+ *   Time scheduled packet filter policies. Each schedule entry switches a
+ *   filter group on during a daily window of local time, for example the quiet
+ *   hours allowlist from 22:00 to 06:00. A low priority thread sleeps until the
+ *   next window boundary, at most one hour, and switches the groups there, so
+ *   the switch does not depend on the network activity. A group that fails to
+ *   switch is retried a minute later. The time comes from the RTC, set for
+ *   example with set_time() after an NTP query. app_pf_sched_set_clock()
+ *   replaces the clock, which allows testing schedules with a fake clock.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef APP_PF_SCHED_H
+#define APP_PF_SCHED_H
+
+#include "mbed.h"
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+/* Daily window of local time, in minutes since midnight. The window wraps
+ * around midnight if end_min is lower than start_min.
+ */
+typedef struct
+{
+    uint16_t start_min;
+    uint16_t end_min;
+    uint8_t  group;
+} app_pf_sched_entry_t;
+
+typedef time_t (*app_pf_sched_clock_t)(void);
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+cy_rslt_t app_pf_sched_start(void);
+uint32_t app_pf_sched_step(void);
+void app_pf_sched_set_clock(app_pf_sched_clock_t clock);
+bool app_pf_sched_is_active(const app_pf_sched_entry_t *entry, time_t now);
+uint32_t app_pf_sched_next_s(const app_pf_sched_entry_t *entry, time_t now);
+
+#endif /* APP_PF_SCHED_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,684 @@
+/******************************************************************************
+ * File Name: app_qlog.cpp
+ *
+ * Description:
+ *   Wear-leveled append-only log of the wake periods in the QSPI memory.
+ *   Records are collected in a page buffer in RAM and a full page is written by
+ *   a low priority thread after the next resume of the network stack, so the
+ *   memory is only programmed while the system is awake anyway.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "app_qlog.h"
+#include "app_olm.h"
+#include "app_stats.h"
+#include "app_log.h"
+#include "app_xip.h"
+#include "cy_syslib.h"
+
+/* The memory cannot be read while a sector erases, which takes up to seconds
+ * per 256 KB sector. app_xip_erase() therefore locks the kernel in XIP
+ * builds, and code placed in the QSPI memory would stall every thread for
+ * the whole erase.
+ */
+#if MBED_CONF_APP_QSPI_LOG && APP_XIP_ENABLED
+#error "qspi-log cannot be combined with the profiles/xip.json profile"
+#endif /* MBED_CONF_APP_QSPI_LOG && APP_XIP_ENABLED */
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#define APP_QLOG_THREAD_STACK_SIZE (1024)
+
+#define APP_QLOG_FLAG_WRITE        (1UL << 0)
+#define APP_QLOG_FLAG_DONE         (1UL << 1)
+
+/* Size of the page header, and of the part of it covered by the CRC. */
+#define APP_QLOG_HEADER_SIZE       (16U)
+#define APP_QLOG_CRC_HEADER_SIZE   (12U)
+
+/* Bytes read from the memory at once while checking a page. */
+#define APP_QLOG_CHUNK_SIZE        (64U)
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+/* A log page. Pages are written once, in the order of their sequence number,
+ * to the position seq % pages of the log region. The sector of a position is
+ * erased before its first page is written, so the erases rotate over the
+ * whole region. The CRC covers the first 12 bytes of the header and the
+ * records, and detects a page torn by a reset during its program.
+ */
+typedef struct
+{
+    uint32_t        magic;
+    uint32_t        seq;
+    uint16_t        count;
+    uint16_t        rec_size;
+    uint32_t        crc;
+    app_qlog_rec_t  recs[APP_QLOG_RECS_PER_PAGE];
+} app_qlog_page_t;
+
+static_assert(sizeof(app_qlog_page_t) == APP_QLOG_PAGE_SIZE,
+              "a log page must fill one program page");
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+/* Records are added to qlog_buf[qlog_fill]. The other buffer holds a page
+ * waiting for the writer while qlog_full is set.
+ */
+static app_qlog_page_t qlog_buf[2];
+static uint8_t qlog_fill = 0;
+static volatile bool qlog_full = false;
+
+/* Log region at the end of the memory. */
+static uint32_t qlog_base;
+static uint32_t qlog_sector_size;
+static uint32_t qlog_pages_per_sector;
+
+static app_qlog_stats_t qlog_stats;
+static cy_rslt_t qlog_last_result = CY_RSLT_SUCCESS;
+static uint32_t qlog_last_cycle = 0;
+static bool qlog_ready = false;
+
+static EventFlags qlog_flags;
+static Mutex qlog_flush_mutex;
+static Thread qlog_thread(osPriorityLow, APP_QLOG_THREAD_STACK_SIZE, NULL,
+                          "app_qlog");
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/******************************************************************************
+ * Function Name: app_qlog_crc_update
+ ******************************************************************************
+ * Summary:
+ *   Updates a CRC-32 (IEEE 802.3, as zlib.crc32() of tools/qlog.py) with a
+ *   block of data.
+ *
+ * Parameters:
+ *   crc: CRC of the previous data, 0xFFFFFFFF for the first block.
+ *   data: Data.
+ *   length: Number of bytes.
+ *
+ * Return:
+ *   uint32_t: Updated CRC, to be inverted after the last block.
+ *
+ *****************************************************************************/
+static uint32_t app_qlog_crc_update(uint32_t crc, const void *data, uint32_t length)
+{
+    const uint8_t *p = (const uint8_t *)data;
+
+    while (0U != length--)
+    {
+        crc ^= *p++;
+        for (uint8_t bit = 0; bit < 8U; bit++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1UL)));
+        }
+    }
+
+    return crc;
+}
+
+/******************************************************************************
+ * Function Name: app_qlog_offset
+ ******************************************************************************
+ * Summary:
+ *   Returns the offset in the memory of the page with a sequence number.
+ *
+ * Parameters:
+ *   seq: Sequence number, or position in the log region.
+ *
+ * Return:
+ *   uint32_t: Offset of the page.
+ *
+ *****************************************************************************/
+static uint32_t app_qlog_offset(uint32_t seq)
+{
+    return qlog_base + ((seq % qlog_stats.pages) * APP_QLOG_PAGE_SIZE);
+}
+
+/******************************************************************************
+ * Function Name: app_qlog_read_header
+ ******************************************************************************
+ * Summary:
+ *   Reads the header of the page at a position and checks that it belongs
+ *   to the position.
+ *
+ * Parameters:
+ *   pos: Position of the page in the log region.
+ *   page: Page whose header is filled.
+ *
+ * Return:
+ *   bool: true if the header has the magic number, a sequence number of this
+ *   position and a valid record count.
+ *
+ *****************************************************************************/
+static bool app_qlog_read_header(uint32_t pos, app_qlog_page_t *page)
+{
+    if (CY_RSLT_SUCCESS != app_xip_read(app_qlog_offset(pos), page,
+                                        APP_QLOG_HEADER_SIZE))
+    {
+        return false;
+    }
+
+    return (APP_QLOG_MAGIC == page->magic) &&
+           (pos == (page->seq % qlog_stats.pages)) &&
+           (0U != page->count) && (APP_QLOG_RECS_PER_PAGE >= page->count) &&
+           (sizeof(app_qlog_rec_t) == page->rec_size);
+}
+
+/******************************************************************************
+ * Function Name: app_qlog_page_valid
+ ******************************************************************************
+ * Summary:
+ *   Checks that the page of a sequence number was completely written.
+ *
+ * Parameters:
+ *   seq: Sequence number.
+ *   page: Page whose header is filled.
+ *
+ * Return:
+ *   bool: true if the header and the CRC of the records are valid.
+ *
+ *****************************************************************************/
+static bool app_qlog_page_valid(uint32_t seq, app_qlog_page_t *page)
+{
+    uint8_t chunk[APP_QLOG_CHUNK_SIZE];
+    uint32_t offset = app_qlog_offset(seq) + APP_QLOG_HEADER_SIZE;
+    uint32_t left;
+    uint32_t crc;
+
+    if (!app_qlog_read_header(seq % qlog_stats.pages, page) || (seq != page->seq))
+    {
+        return false;
+    }
+
+    crc = app_qlog_crc_update(0xFFFFFFFFUL, page, APP_QLOG_CRC_HEADER_SIZE);
+    left = page->count * sizeof(app_qlog_rec_t);
+    while (0U != left)
+    {
+        uint32_t n = (left < sizeof(chunk)) ? left : sizeof(chunk);
+
+        if (CY_RSLT_SUCCESS != app_xip_read(offset, chunk, n))
+        {
+            return false;
+        }
+        crc = app_qlog_crc_update(crc, chunk, n);
+        offset += n;
+        left -= n;
+    }
+
+    return (page->crc == ~crc);
+}
+
+/******************************************************************************
+ * Function Name: app_qlog_page_blank
+ ******************************************************************************
+ * Summary:
+ *   Checks that the page at a position is erased.
+ *
+ * Parameters:
+ *   pos: Position of the page in the log region.
+ *
+ * Return:
+ *   bool: true if all bytes of the page read 0xFF.
+ *
+ *****************************************************************************/
+static bool app_qlog_page_blank(uint32_t pos)
+{
+    uint32_t chunk[APP_QLOG_CHUNK_SIZE / sizeof(uint32_t)];
+
+    for (uint32_t offset = 0; offset < APP_QLOG_PAGE_SIZE; offset += sizeof(chunk))
+    {
+        if (CY_RSLT_SUCCESS != app_xip_read(app_qlog_offset(pos) + offset,
+                                            chunk, sizeof(chunk)))
+        {
+            return false;
+        }
+        for (uint32_t i = 0; i < (sizeof(chunk) / sizeof(uint32_t)); i++)
+        {
+            if (0xFFFFFFFFUL != chunk[i])
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/******************************************************************************
+ * Function Name: app_qlog_mount
+ ******************************************************************************
+ * Summary:
+ *   Finds the next sequence number from the pages in the memory. The newest
+ *   page is the one with the highest sequence number of its position. Pages
+ *   torn by a reset fail the CRC check and are skipped, both here and by
+ *   app_qlog_write_page(), which never programs over a page which is not
+ *   blank.
+ *
+ *****************************************************************************/
+APP_XIP static void app_qlog_mount(void)
+{
+    app_qlog_page_t *page = &qlog_buf[1];
+    uint32_t newest = 0;
+    bool found = false;
+
+    for (uint32_t pos = 0; pos < qlog_stats.pages; pos++)
+    {
+        if (app_qlog_read_header(pos, page) && (!found || (page->seq > newest)))
+        {
+            newest = page->seq;
+            found = true;
+        }
+    }
+
+    for (uint32_t steps = 0; found && !app_qlog_page_valid(newest, page); steps++)
+    {
+        if ((0U == newest) || (steps == qlog_stats.pages))
+        {
+            found = false;
+        }
+        newest--;
+    }
+
+    qlog_stats.next_seq = found ? (newest + 1U) : 0U;
+    page->count = 0;
+}
+
+/******************************************************************************
+ * Function Name: app_qlog_write_page
+ ******************************************************************************
+ * Summary:
+ *   Writes a page at the next position of the log region. The sector is
+ *   erased when the position is its first page, positions left over by a
+ *   torn page are skipped.
+ *
+ * Parameters:
+ *   page: Page with its records, the header is filled here.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or the error of the erase or program.
+ *
+ *****************************************************************************/
+static cy_rslt_t app_qlog_write_page(app_qlog_page_t *page)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t seq = qlog_stats.next_seq;
+
+    for (uint32_t skipped = 0; ; skipped++)
+    {
+        uint32_t pos = seq % qlog_stats.pages;
+
+        if (skipped == qlog_stats.pages)
+        {
+            return CY_RSLT_TYPE_ERROR;
+        }
+        if (0U == (pos % qlog_pages_per_sector))
+        {
+            result = app_xip_erase(app_qlog_offset(seq), qlog_sector_size);
+            if (CY_RSLT_SUCCESS != result)
+            {
+                return result;
+            }
+            qlog_stats.erases++;
+            break;
+        }
+        if (app_qlog_page_blank(pos))
+        {
+            break;
+        }
+        seq++;
+    }
+
+    page->magic = APP_QLOG_MAGIC;
+    page->seq = seq;
+    page->rec_size = sizeof(app_qlog_rec_t);
+    page->crc = ~app_qlog_crc_update(
+                    app_qlog_crc_update(0xFFFFFFFFUL, page, APP_QLOG_CRC_HEADER_SIZE),
+                    page->recs, page->count * sizeof(app_qlog_rec_t));
+
+    /* The position is used up even if the program failed. */
+    result = app_xip_write(app_qlog_offset(seq), page, APP_QLOG_PAGE_SIZE);
+    qlog_stats.next_seq = seq + 1U;
+    if (CY_RSLT_SUCCESS == result)
+    {
+        qlog_stats.pages_written++;
+    }
+
+    return result;
+}
+
+/******************************************************************************
+ * Function Name: app_qlog_thread_main
+ ******************************************************************************
+ * Summary:
+ *   Entry function of the writer thread. Writes the full page, and the page
+ *   filled in the meantime if any, then signals app_qlog_flush().
+ *
+ *****************************************************************************/
+static void app_qlog_thread_main(void)
+{
+    while (true)
+    {
+        qlog_flags.wait_any(APP_QLOG_FLAG_WRITE);
+
+        while (qlog_full)
+        {
+            app_qlog_page_t *page = &qlog_buf[qlog_fill ^ 1U];
+
+            qlog_last_result = app_qlog_write_page(page);
+            if (CY_RSLT_SUCCESS != qlog_last_result)
+            {
+                ERR_INFO(("QSPI log: writing page %lu failed, %u records lost.\n",
+                          (unsigned long)qlog_stats.next_seq,
+                          (unsigned int)page->count));
+            }
+
+            core_util_critical_section_enter();
+            page->count = 0;
+            qlog_full = false;
+            if (APP_QLOG_RECS_PER_PAGE == qlog_buf[qlog_fill].count)
+            {
+                qlog_fill ^= 1U;
+                qlog_full = true;
+            }
+            core_util_critical_section_exit();
+        }
+
+        qlog_flags.set(APP_QLOG_FLAG_DONE);
+    }
+}
+
+/******************************************************************************
+ * Function Name: app_qlog_olm_hook
+ ******************************************************************************
+ * Summary:
+ *   Offload manager hook. On suspend it records the wake period closed by
+ *   the statistics hook, which is registered before. On resume a full page
+ *   is handed to the writer, since the system is awake anyway.
+ *
+ * Parameters:
+ *   suspended: true on suspend, false on resume.
+ *
+ *****************************************************************************/
+APP_HOT static void app_qlog_olm_hook(bool suspended)
+{
+    app_stats_cycle_t cycle;
+    app_qlog_rec_t rec;
+    uint32_t packets;
+
+    if (!suspended)
+    {
+        if (qlog_full)
+        {
+            qlog_flags.set(APP_QLOG_FLAG_WRITE);
+        }
+        return;
+    }
+
+    if (!app_stats_get_last_cycle(&cycle) || (cycle.cycle == qlog_last_cycle))
+    {
+        return;
+    }
+    qlog_last_cycle = cycle.cycle;
+
+    packets = cycle.delta.whd.tx_total + cycle.delta.whd.rx_total;
+    rec.time_s = (uint32_t)time(NULL);
+    rec.sleep_ms = cycle.sleep_ms;
+    rec.awake_ms = cycle.delta.time_ms;
+    rec.type = APP_QLOG_REC_WAKE;
+    rec.reason = (uint8_t)cycle.reason;
+    rec.packets = (packets > UINT16_MAX) ? UINT16_MAX : (uint16_t)packets;
+    app_qlog_append(&rec);
+}
+
+/******************************************************************************
+ * Function Name: app_qlog_init
+ ******************************************************************************
+ * Summary:
+ *   Places the log region in the last qspi-log-sectors erase sectors of the
+ *   memory, finds the newest page, starts the writer thread and records the
+ *   reset. Must be called after app_xip_init() and app_stats_init().
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if the memory is not
+ *   mapped, the region does not fit or the thread could not be started.
+ *
+ *****************************************************************************/
+APP_XIP cy_rslt_t app_qlog_init(void)
+{
+    const cy_stc_smif_mem_device_cfg_t *dev = app_xip_get_device();
+    uint32_t size = MBED_CONF_APP_QSPI_LOG_SECTORS * dev->eraseSize;
+    app_qlog_rec_t rec = { 0 };
+    cy_rslt_t result;
+
+    if (!app_xip_is_mapped() || (0U != (dev->eraseSize % APP_QLOG_PAGE_SIZE)) ||
+        (0U == size) || (size > dev->memSize))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    qlog_base = dev->memSize - size;
+    qlog_sector_size = dev->eraseSize;
+    qlog_pages_per_sector = dev->eraseSize / APP_QLOG_PAGE_SIZE;
+    qlog_stats.pages = size / APP_QLOG_PAGE_SIZE;
+    app_qlog_mount();
+
+    result = app_olm_add_hook(app_qlog_olm_hook);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+    if (osOK != qlog_thread.start(mbed::callback(app_qlog_thread_main)))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+    qlog_ready = true;
+
+    rec.time_s = (uint32_t)time(NULL);
+    rec.awake_ms = Cy_SysLib_GetResetReason();
+    rec.type = APP_QLOG_REC_BOOT;
+    app_qlog_append(&rec);
+
+    APP_INFO(("QSPI log: %lu pages at 0x%08lx, next page %lu\n",
+              (unsigned long)qlog_stats.pages, (unsigned long)qlog_base,
+              (unsigned long)qlog_stats.next_seq));
+
+    return CY_RSLT_SUCCESS;
+}
+
+/******************************************************************************
+ * Function Name: app_qlog_append
+ ******************************************************************************
+ * Summary:
+ *   Adds a record to the page buffer. A full page is only handed to the
+ *   writer on the next resume or app_qlog_flush(). While both buffers are
+ *   full the record is dropped.
+ *
+ * Parameters:
+ *   rec: Record to be added.
+ *
+ *****************************************************************************/
+void app_qlog_append(const app_qlog_rec_t *rec)
+{
+    app_qlog_page_t *page;
+
+    if (!qlog_ready)
+    {
+        return;
+    }
+
+    core_util_critical_section_enter();
+    page = &qlog_buf[qlog_fill];
+    if (APP_QLOG_RECS_PER_PAGE == page->count)
+    {
+        qlog_stats.dropped++;
+    }
+    else
+    {
+        page->recs[page->count++] = *rec;
+        if ((APP_QLOG_RECS_PER_PAGE == page->count) && !qlog_full)
+        {
+            qlog_fill ^= 1U;
+            qlog_full = true;
+        }
+    }
+    core_util_critical_section_exit();
+}
+
+/******************************************************************************
+ * Function Name: app_qlog_flush
+ ******************************************************************************
+ * Summary:
+ *   Writes the buffered records, also those of a partial page, and waits
+ *   until they are in the memory. A partial page uses up a whole page of
+ *   the region, so this is meant for a planned reset or shutdown. Must not
+ *   be called from interrupt context.
+ *
+ * Return:
+ *   cy_rslt_t: Result of the last page write.
+ *
+ *****************************************************************************/
+cy_rslt_t app_qlog_flush(void)
+{
+    if (!qlog_ready)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    qlog_flush_mutex.lock();
+
+    core_util_critical_section_enter();
+    if (!qlog_full && (0U != qlog_buf[qlog_fill].count))
+    {
+        qlog_fill ^= 1U;
+        qlog_full = true;
+    }
+    core_util_critical_section_exit();
+
+    while (qlog_full)
+    {
+        qlog_flags.clear(APP_QLOG_FLAG_DONE);
+        qlog_flags.set(APP_QLOG_FLAG_WRITE);
+        qlog_flags.wait_any(APP_QLOG_FLAG_DONE);
+    }
+
+    qlog_flush_mutex.unlock();
+
+    return qlog_last_result;
+}
+
+/******************************************************************************
+ * Function Name: app_qlog_dump
+ ******************************************************************************
+ * Summary:
+ *   Prints the newest valid pages, oldest first, as '#Q:' lines with the
+ *   hex encoded header and records, to be decoded with tools/qlog.py.
+ *
+ * Parameters:
+ *   pages: Maximum number of pages.
+ *
+ *****************************************************************************/
+APP_XIP void app_qlog_dump(uint32_t pages)
+{
+    app_qlog_page_t header;
+    uint8_t chunk[APP_QLOG_CHUNK_SIZE];
+    uint32_t seq;
+
+    if (!qlog_ready)
+    {
+        return;
+    }
+    if (pages > qlog_stats.pages)
+    {
+        pages = qlog_stats.pages;
+    }
+    if (pages > qlog_stats.next_seq)
+    {
+        pages = qlog_stats.next_seq;
+    }
+
+    app_log_flush();
+    for (seq = qlog_stats.next_seq - pages; seq != qlog_stats.next_seq; seq++)
+    {
+        uint32_t offset = app_qlog_offset(seq);
+        uint32_t left;
+
+        if (!app_qlog_page_valid(seq, &header))
+        {
+            continue;
+        }
+
+        printf("#Q:");
+        left = APP_QLOG_HEADER_SIZE + (header.count * sizeof(app_qlog_rec_t));
+        while (0U != left)
+        {
+            uint32_t n = (left < sizeof(chunk)) ? left : sizeof(chunk);
+
+            (void)app_xip_read(offset, chunk, n);
+            for (uint32_t i = 0; i < n; i++)
+            {
+                printf("%02x", chunk[i]);
+            }
+            offset += n;
+            left -= n;
+        }
+        printf("\n");
+    }
+}
+
+/******************************************************************************
+ * Function Name: app_qlog_get_stats
+ ******************************************************************************
+ * Summary:
+ *   Returns the position and the write statistics of the log.
+ *
+ * Parameters:
+ *   stats: Log statistics.
+ *
+ *****************************************************************************/
+void app_qlog_get_stats(app_qlog_stats_t *stats)
+{
+    core_util_critical_section_enter();
+    *stats = qlog_stats;
+    core_util_critical_section_exit();
+}
+
+
+/* [] END OF FILE */
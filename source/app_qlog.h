@@ -0,0 +1,98 @@
+/******************************************************************************
+ * File Name: app_qlog.h
+ *
+ * Description:
+ *   Wear-leveled append-only log of the wake periods in the QSPI memory.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef APP_QLOG_H
+#define APP_QLOG_H
+
+#include "mbed.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+/* Size of a log page, one program page of the memory. The layout must stay
+ * in sync with tools/qlog.py.
+ */
+#define APP_QLOG_PAGE_SIZE         (512U)
+#define APP_QLOG_MAGIC             (0x474F4C51UL)  /* "QLOG" */
+#define APP_QLOG_RECS_PER_PAGE     ((APP_QLOG_PAGE_SIZE - 16U) / sizeof(app_qlog_rec_t))
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+typedef enum
+{
+    APP_QLOG_REC_BOOT = 1,    /* Reset, awake_ms holds the reset reason */
+    APP_QLOG_REC_WAKE,        /* Wake period of the network stack */
+} app_qlog_rec_type_t;
+
+/* One record, 16 bytes. */
+typedef struct
+{
+    uint32_t time_s;          /* RTC time, seconds since the epoch */
+    uint32_t sleep_ms;        /* Time suspended before the wake */
+    uint32_t awake_ms;        /* Time from the resume to the next suspend */
+    uint8_t  type;            /* app_qlog_rec_type_t */
+    uint8_t  reason;          /* app_wake_reason_t */
+    uint16_t packets;         /* Packets sent and received, saturated */
+} app_qlog_rec_t;
+
+/* Log statistics. */
+typedef struct
+{
+    uint32_t next_seq;        /* Sequence number of the next page */
+    uint32_t pages;           /* Pages of the log region */
+    uint32_t pages_written;   /* Pages written since boot */
+    uint32_t erases;          /* Sectors erased since boot */
+    uint32_t dropped;         /* Records dropped because both buffers were full */
+} app_qlog_stats_t;
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+cy_rslt_t app_qlog_init(void);
+void app_qlog_append(const app_qlog_rec_t *rec);
+cy_rslt_t app_qlog_flush(void);
+void app_qlog_dump(uint32_t pages);
+void app_qlog_get_stats(app_qlog_stats_t *stats);
+
+#endif /* APP_QLOG_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,457 @@
+/******************************************************************************
+ * File Name: app_qspi_bench.cpp
+ *
+ * Description:
+ *   Benchmark of the read commands of the QSPI memory and selection of the
+ *   read command of the XIP mode. The code stays in the internal flash, so that
+ *   its own fetches do not disturb the measurements.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "app_qspi_bench.h"
+#include "app_log.h"
+#include "app_xip.h"
+#include "cyhal.h"
+#include "cy_flash.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+/* Test pattern at the start of the benchmark sector. */
+#define APP_QSPI_BENCH_PATTERN_SIZE  (256U)
+
+/* Words copied by one DMA transfer. */
+#define APP_QSPI_BENCH_DMA_WORDS     (256UL)
+
+/* Stored selection. */
+#define APP_QSPI_BENCH_MAGIC         (0x42525351UL)  /* "QSRB" */
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+/* Selection stored in the emulated EEPROM row. */
+typedef struct
+{
+    uint32_t  magic;
+    uint8_t   index;
+    uint8_t   command;
+    uint8_t   dummy_cycles;
+    uint8_t   check;          /* Inverse of index */
+} app_qspi_bench_sel_t;
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+/* Read commands of the S25FL512S with 4-byte addresses, with the dummy
+ * cycles of the default latency code. Entry 0 is the command of the
+ * generated memory slot, the entry which repeats it is not measured again.
+ * The part also has DDR reads, which the SMIF block of these devices does
+ * not support.
+ */
+static app_qspi_read_mode_t bench_modes[] =
+{
+    { "generated", { 0U, CY_SMIF_WIDTH_SINGLE, CY_SMIF_WIDTH_SINGLE, APP_QSPI_NO_MODE,
+                     CY_SMIF_WIDTH_SINGLE, 0U, CY_SMIF_WIDTH_SINGLE } },
+    { "read 1-1-1", { 0x13U, CY_SMIF_WIDTH_SINGLE, CY_SMIF_WIDTH_SINGLE, APP_QSPI_NO_MODE,
+                      CY_SMIF_WIDTH_SINGLE, 0U, CY_SMIF_WIDTH_SINGLE } },
+    { "fast 1-1-1", { 0x0CU, CY_SMIF_WIDTH_SINGLE, CY_SMIF_WIDTH_SINGLE, APP_QSPI_NO_MODE,
+                      CY_SMIF_WIDTH_SINGLE, 8U, CY_SMIF_WIDTH_SINGLE } },
+    { "dual 1-1-2", { 0x3CU, CY_SMIF_WIDTH_SINGLE, CY_SMIF_WIDTH_SINGLE, APP_QSPI_NO_MODE,
+                      CY_SMIF_WIDTH_SINGLE, 8U, CY_SMIF_WIDTH_DUAL } },
+    { "dual 1-2-2", { 0xBCU, CY_SMIF_WIDTH_SINGLE, CY_SMIF_WIDTH_DUAL, 0x01U,
+                      CY_SMIF_WIDTH_DUAL, 0U, CY_SMIF_WIDTH_DUAL } },
+    { "quad 1-1-4", { 0x6CU, CY_SMIF_WIDTH_SINGLE, CY_SMIF_WIDTH_SINGLE, APP_QSPI_NO_MODE,
+                      CY_SMIF_WIDTH_SINGLE, 8U, CY_SMIF_WIDTH_QUAD } },
+    { "quad 1-4-4", { 0xECU, CY_SMIF_WIDTH_SINGLE, CY_SMIF_WIDTH_QUAD, 0x01U,
+                      CY_SMIF_WIDTH_QUAD, 4U, CY_SMIF_WIDTH_QUAD } },
+};
+
+#define APP_QSPI_BENCH_MODES       (sizeof(bench_modes) / sizeof(bench_modes[0]))
+
+/* Row of the emulated EEPROM region holding the selection. Volatile, as it
+ * is changed by the flash driver behind the compiler's back.
+ */
+CY_SECTION(".cy_em_eeprom") CY_ALIGN(CY_FLASH_SIZEOF_ROW)
+static const volatile uint8_t bench_row[CY_FLASH_SIZEOF_ROW] = { 0U };
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/******************************************************************************
+ * Function Name: app_qspi_bench_kbps
+ ******************************************************************************
+ * Summary:
+ *   Converts a number of bytes read in a number of CPU cycles to kB/s.
+ *
+ *****************************************************************************/
+static uint32_t app_qspi_bench_kbps(uint32_t bytes, uint32_t cycles)
+{
+    return (0U == cycles) ? 0U :
+           (uint32_t)(((uint64_t)bytes * SystemCoreClock) / ((uint64_t)cycles * 1000ULL));
+}
+
+/******************************************************************************
+ * Function Name: app_qspi_bench_pattern
+ ******************************************************************************
+ * Summary:
+ *   Fills the test pattern. No byte repeats its neighbours, so a command
+ *   with the wrong number of dummy or mode cycles reads it shifted and
+ *   fails the comparison.
+ *
+ * Parameters:
+ *   pattern: Buffer of APP_QSPI_BENCH_PATTERN_SIZE bytes.
+ *
+ *****************************************************************************/
+static void app_qspi_bench_pattern(uint8_t *pattern)
+{
+    for (uint32_t i = 0; i < APP_QSPI_BENCH_PATTERN_SIZE; i++)
+    {
+        pattern[i] = (uint8_t)((i * 73U) ^ (i >> 3) ^ 0x5AU);
+    }
+}
+
+/******************************************************************************
+ * Function Name: app_qspi_bench_prepare
+ ******************************************************************************
+ * Summary:
+ *   Writes the test pattern at the start of the benchmark sector, unless it
+ *   is already there from a previous boot.
+ *
+ * Parameters:
+ *   area: Offset of the benchmark sector.
+ *   pattern: Test pattern.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or the error of the erase or program.
+ *
+ *****************************************************************************/
+static cy_rslt_t app_qspi_bench_prepare(uint32_t area, const uint8_t *pattern)
+{
+    uint8_t data[APP_QSPI_BENCH_PATTERN_SIZE];
+    cy_rslt_t result = app_xip_read(area, data, sizeof(data));
+    bool blank = true;
+
+    if ((CY_RSLT_SUCCESS != result) || (0 == memcmp(data, pattern, sizeof(data))))
+    {
+        return result;
+    }
+
+    for (uint32_t i = 0; i < sizeof(data); i++)
+    {
+        blank = blank && (0xFFU == data[i]);
+    }
+    if (!blank)
+    {
+        result = app_xip_erase(area, app_xip_get_device()->eraseSize);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = app_xip_write(area, pattern, APP_QSPI_BENCH_PATTERN_SIZE);
+    }
+
+    return result;
+}
+
+/******************************************************************************
+ * Function Name: app_qspi_bench_dma
+ ******************************************************************************
+ * Summary:
+ *   Measures the throughput of DMA copies from the XIP region to the SRAM,
+ *   in transfers of APP_QSPI_BENCH_DMA_WORDS words. The time includes the
+ *   setup of each transfer.
+ *
+ * Parameters:
+ *   area: Offset of the benchmark sector.
+ *
+ * Return:
+ *   uint32_t: Throughput in kB/s, 0 if the DMA channel is not available.
+ *
+ *****************************************************************************/
+static uint32_t app_qspi_bench_dma(uint32_t area)
+{
+    cyhal_dma_t dma;
+    cyhal_dma_cfg_t cfg;
+    uint32_t *buf;
+    uint32_t start;
+    uint32_t cycles;
+    cy_rslt_t result;
+
+    if (CY_RSLT_SUCCESS != cyhal_dma_init(&dma, CYHAL_DMA_PRIORITY_DEFAULT,
+                                          CYHAL_DMA_DIRECTION_MEM2MEM))
+    {
+        return 0U;
+    }
+    buf = new uint32_t[APP_QSPI_BENCH_DMA_WORDS];
+
+    cfg.src_increment = 1;
+    cfg.dst_addr = (uint32_t)buf;
+    cfg.dst_increment = 1;
+    cfg.transfer_width = 32U;
+    cfg.length = APP_QSPI_BENCH_DMA_WORDS;
+    cfg.burst_size = 0U;
+    cfg.action = CYHAL_DMA_TRANSFER_FULL;
+
+    app_xip_invalidate_cache();
+    start = DWT->CYCCNT;
+    result = CY_RSLT_SUCCESS;
+    for (uint32_t offset = 0; (offset < APP_QSPI_BENCH_SEQ_SIZE) &&
+         (CY_RSLT_SUCCESS == result); offset += APP_QSPI_BENCH_DMA_WORDS * 4U)
+    {
+        cfg.src_addr = APP_XIP_BASE_ADDR + area + offset;
+        result = cyhal_dma_configure(&dma, &cfg);
+        if (CY_RSLT_SUCCESS == result)
+        {
+            result = cyhal_dma_start_transfer(&dma);
+        }
+        while ((CY_RSLT_SUCCESS == result) && cyhal_dma_is_busy(&dma))
+        {
+        }
+    }
+    cycles = DWT->CYCCNT - start;
+
+    delete[] buf;
+    cyhal_dma_free(&dma);
+
+    return (CY_RSLT_SUCCESS == result) ?
+           app_qspi_bench_kbps(APP_QSPI_BENCH_SEQ_SIZE, cycles) : 0U;
+}
+
+/******************************************************************************
+ * Function Name: app_qspi_bench_measure
+ ******************************************************************************
+ * Summary:
+ *   Measures the current read command: the sequential XIP read throughput,
+ *   the latency of single word reads at scattered offsets with the caches
+ *   invalidated before each, and the DMA throughput. The CPU reads run with
+ *   interrupts disabled.
+ *
+ * Parameters:
+ *   area: Offset of the benchmark sector.
+ *   result: Result of the command.
+ *
+ *****************************************************************************/
+static void app_qspi_bench_measure(uint32_t area, app_qspi_bench_result_t *result)
+{
+    const volatile uint32_t *base = (const volatile uint32_t *)(APP_XIP_BASE_ADDR + area);
+    uint32_t sector_words = app_xip_get_device()->eraseSize / sizeof(uint32_t);
+    uint32_t sum = 0;
+    uint32_t cycles = 0;
+    uint32_t start;
+    uint32_t index = 0;
+
+    core_util_critical_section_enter();
+
+    app_xip_invalidate_cache();
+    start = DWT->CYCCNT;
+    for (uint32_t i = 0; i < (APP_QSPI_BENCH_SEQ_SIZE / sizeof(uint32_t)); i++)
+    {
+        sum += base[i];
+    }
+    result->xip_kbps = app_qspi_bench_kbps(APP_QSPI_BENCH_SEQ_SIZE, DWT->CYCCNT - start);
+
+    for (uint32_t i = 0; i < APP_QSPI_BENCH_MISSES; i++)
+    {
+        index = (index * 1664525UL + 1013904223UL) % sector_words;
+        app_xip_invalidate_cache();
+        start = DWT->CYCCNT;
+        sum += base[index];
+        cycles += DWT->CYCCNT - start;
+    }
+    result->latency_ns = (uint32_t)(((uint64_t)cycles * 1000000000ULL) /
+                                    ((uint64_t)SystemCoreClock * APP_QSPI_BENCH_MISSES));
+
+    core_util_critical_section_exit();
+
+    (void)sum;
+    result->dma_kbps = app_qspi_bench_dma(area);
+}
+
+/******************************************************************************
+ * Function Name: app_qspi_bench_load
+ ******************************************************************************
+ * Summary:
+ *   Reads the stored selection.
+ *
+ * Return:
+ *   int32_t: Index of the stored read command, -1 if there is none or it
+ *   does not match the command table.
+ *
+ *****************************************************************************/
+static int32_t app_qspi_bench_load(void)
+{
+    app_qspi_bench_sel_t sel;
+
+    for (uint32_t i = 0; i < sizeof(sel); i++)
+    {
+        ((uint8_t *)&sel)[i] = bench_row[i];
+    }
+
+    if ((APP_QSPI_BENCH_MAGIC != sel.magic) || (APP_QSPI_BENCH_MODES <= sel.index) ||
+        ((uint8_t)~sel.index != sel.check) ||
+        (bench_modes[sel.index].cmd.command != sel.command) ||
+        (bench_modes[sel.index].cmd.dummyCycles != sel.dummy_cycles))
+    {
+        return -1;
+    }
+
+    return sel.index;
+}
+
+/******************************************************************************
+ * Function Name: app_qspi_bench_store
+ ******************************************************************************
+ * Summary:
+ *   Stores the selection in the emulated EEPROM row.
+ *
+ * Parameters:
+ *   index: Index of the selected read command.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or the error of the flash driver.
+ *
+ *****************************************************************************/
+static cy_rslt_t app_qspi_bench_store(uint8_t index)
+{
+    uint32_t *row = new uint32_t[CY_FLASH_SIZEOF_ROW / sizeof(uint32_t)];
+    app_qspi_bench_sel_t sel;
+    cy_en_flashdrv_status_t status;
+
+    sel.magic = APP_QSPI_BENCH_MAGIC;
+    sel.index = index;
+    sel.command = bench_modes[index].cmd.command;
+    sel.dummy_cycles = (uint8_t)bench_modes[index].cmd.dummyCycles;
+    sel.check = (uint8_t)~index;
+
+    memset(row, 0, CY_FLASH_SIZEOF_ROW);
+    memcpy(row, &sel, sizeof(sel));
+    status = Cy_Flash_WriteRow((uint32_t)bench_row, row);
+    delete[] row;
+
+    return (CY_FLASH_DRV_SUCCESS == status) ? CY_RSLT_SUCCESS : (cy_rslt_t)status;
+}
+
+/******************************************************************************
+ * Function Name: app_qspi_bench_init
+ ******************************************************************************
+ * Summary:
+ *   Applies the stored read command. Without a stored selection, or with
+ *   force, each read command of the memory is checked against a test
+ *   pattern and measured, the best one is applied and stored. The pattern
+ *   is kept in the erase sector below the QSPI log. Must be called after
+ *   app_xip_init() and before the read command is changed otherwise.
+ *
+ * Parameters:
+ *   force: Measure again even if a selection is stored.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or the error of the pattern write, the
+ *   switch or the store.
+ *
+ *****************************************************************************/
+cy_rslt_t app_qspi_bench_init(bool force)
+{
+    const cy_stc_smif_mem_device_cfg_t *dev = app_xip_get_device();
+    app_qspi_bench_result_t results[APP_QSPI_BENCH_MODES];
+    uint8_t pattern[APP_QSPI_BENCH_PATTERN_SIZE];
+    uint32_t area;
+    int32_t stored;
+    uint8_t best;
+    cy_rslt_t result;
+
+    if (!app_xip_is_mapped() ||
+        (dev->memSize < ((MBED_CONF_APP_QSPI_LOG_SECTORS + 1UL) * dev->eraseSize)))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+    area = dev->memSize - ((MBED_CONF_APP_QSPI_LOG_SECTORS + 1UL) * dev->eraseSize);
+
+    bench_modes[0].cmd = *app_xip_get_read_cmd();
+    app_qspi_bench_pattern(pattern);
+    result = app_qspi_bench_prepare(area, pattern);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    stored = app_qspi_bench_load();
+    if (!force && (0 <= stored))
+    {
+        result = app_xip_set_read_cmd(&bench_modes[stored].cmd, area, pattern,
+                                      sizeof(pattern));
+        if (CY_RSLT_SUCCESS == result)
+        {
+            APP_INFO(("QSPI read: %s (stored)\n", bench_modes[stored].name));
+            return result;
+        }
+        /* The stored command no longer reads correctly, measure again. */
+    }
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    for (uint8_t i = 0; i < APP_QSPI_BENCH_MODES; i++)
+    {
+        memset(&results[i], 0, sizeof(results[i]));
+        if ((0U != i) && app_qspi_bench_same_cmd(&bench_modes[i].cmd, &bench_modes[0].cmd))
+        {
+            APP_INFO(("QSPI bench: %s is the generated command\n", bench_modes[i].name));
+            continue;
+        }
+        if (CY_RSLT_SUCCESS != app_xip_set_read_cmd(&bench_modes[i].cmd, area,
+                                                    pattern, sizeof(pattern)))
+        {
+            APP_INFO(("QSPI bench: %s fails the read check\n", bench_modes[i].name));
+            continue;
+        }
+        results[i].valid = true;
+        app_qspi_bench_measure(area, &results[i]);
+        APP_INFO(("QSPI bench: %s xip %lu kB/s, dma %lu kB/s, latency %lu ns, cost %lu ns\n",
+                  bench_modes[i].name, results[i].xip_kbps, results[i].dma_kbps,
+                  results[i].latency_ns, app_qspi_bench_cost_ns(&results[i])));
+    }
+
+    best = app_qspi_bench_select(results, APP_QSPI_BENCH_MODES);
+    result = app_xip_set_read_cmd(&bench_modes[best].cmd, area, pattern, sizeof(pattern));
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = app_qspi_bench_store(best);
+    }
+    APP_INFO(("QSPI bench: selected %s\n", bench_modes[best].name));
+
+    return result;
+}
+
+
+/* [] END OF FILE */
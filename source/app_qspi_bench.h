@@ -0,0 +1,95 @@
+/******************************************************************************
+ * File Name: app_qspi_bench.h
+ *
+ * Description:
+ *   Benchmark of the read commands of the QSPI memory and selection of the
+ *   read command of the XIP mode.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef APP_QSPI_BENCH_H
+#define APP_QSPI_BENCH_H
+
+#include "mbed.h"
+#include "cy_pdl.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+/* Bytes read sequentially for the throughput of each command. */
+#define APP_QSPI_BENCH_SEQ_SIZE    (32768UL)
+
+/* Number of random single word reads for the latency of each command. */
+#define APP_QSPI_BENCH_MISSES      (64UL)
+
+/* Size of the cold code path whose fetch time is minimized, one cache miss
+ * and the rest read sequentially. Must stay in sync with tools/qspi_bench.py.
+ */
+#define APP_QSPI_BENCH_PATH_SIZE   (1024UL)
+
+/* Mode byte of a read command without one. */
+#define APP_QSPI_NO_MODE           (0xFFFFFFFFUL)
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+/* Read command of the memory. */
+typedef struct
+{
+    const char             *name;
+    cy_stc_smif_mem_cmd_t  cmd;
+} app_qspi_read_mode_t;
+
+/* Result of one read command. */
+typedef struct
+{
+    bool      valid;          /* The command read the test pattern correctly */
+    uint32_t  xip_kbps;       /* Sequential XIP read throughput, kB/s */
+    uint32_t  dma_kbps;       /* DMA copy throughput from the XIP region, kB/s */
+    uint32_t  latency_ns;     /* Single word read after a cache miss */
+} app_qspi_bench_result_t;
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+cy_rslt_t app_qspi_bench_init(bool force);
+bool app_qspi_bench_same_cmd(const cy_stc_smif_mem_cmd_t *a, const cy_stc_smif_mem_cmd_t *b);
+uint8_t app_qspi_bench_select(const app_qspi_bench_result_t *results, uint8_t count);
+uint32_t app_qspi_bench_cost_ns(const app_qspi_bench_result_t *result);
+
+#endif /* APP_QSPI_BENCH_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,137 @@
+/******************************************************************************
+ * File Name: app_qspi_bench_select.cpp
+ *
+ * Description:
+ *   Selection of the read command of the QSPI memory from the benchmark
+ *   results. Kept apart from the measurements, which need the kit, so that the
+ *   host unit tests build the same code.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "app_qspi_bench.h"
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/******************************************************************************
+ * Function Name: app_qspi_bench_same_cmd
+ ******************************************************************************
+ * Summary:
+ *   Checks whether two read commands transfer the same phases: the command,
+ *   the widths, the mode byte and the dummy cycles. The width of an absent
+ *   mode byte does not matter. Must stay in sync with commands() in
+ *   tools/qspi_bench.py.
+ *
+ * Parameters:
+ *   a: Read command.
+ *   b: Read command.
+ *
+ * Return:
+ *   bool: true if both commands are the same.
+ *
+ *****************************************************************************/
+bool app_qspi_bench_same_cmd(const cy_stc_smif_mem_cmd_t *a, const cy_stc_smif_mem_cmd_t *b)
+{
+    return (a->command == b->command) && (a->cmdWidth == b->cmdWidth) &&
+           (a->addrWidth == b->addrWidth) && (a->mode == b->mode) &&
+           ((APP_QSPI_NO_MODE == a->mode) || (a->modeWidth == b->modeWidth)) &&
+           (a->dummyCycles == b->dummyCycles) && (a->dataWidth == b->dataWidth);
+}
+
+/******************************************************************************
+ * Function Name: app_qspi_bench_cost_ns
+ ******************************************************************************
+ * Summary:
+ *   Returns the time to fetch a cold code path of APP_QSPI_BENCH_PATH_SIZE
+ *   bytes: one cache miss followed by sequential reads.
+ *
+ * Parameters:
+ *   result: Result of a read command.
+ *
+ * Return:
+ *   uint32_t: Time in ns, UINT32_MAX if the command was not measured.
+ *
+ *****************************************************************************/
+uint32_t app_qspi_bench_cost_ns(const app_qspi_bench_result_t *result)
+{
+    if (!result->valid || (0U == result->xip_kbps))
+    {
+        return UINT32_MAX;
+    }
+
+    return result->latency_ns +
+           (uint32_t)((APP_QSPI_BENCH_PATH_SIZE * 1000000ULL) / result->xip_kbps);
+}
+
+/******************************************************************************
+ * Function Name: app_qspi_bench_select
+ ******************************************************************************
+ * Summary:
+ *   Selects the read command with the lowest cold path cost, the higher DMA
+ *   throughput breaking ties. Must stay in sync with select() in
+ *   tools/qspi_bench.py, the app_qspi_bench host unit test checks both on
+ *   the same results.
+ *
+ * Parameters:
+ *   results: Results of the read commands.
+ *   count: Number of results.
+ *
+ * Return:
+ *   uint8_t: Index of the selected command, 0 (the generated command) if
+ *   none is valid.
+ *
+ *****************************************************************************/
+uint8_t app_qspi_bench_select(const app_qspi_bench_result_t *results, uint8_t count)
+{
+    uint8_t best = 0;
+
+    for (uint8_t i = 1; i < count; i++)
+    {
+        uint32_t cost = app_qspi_bench_cost_ns(&results[i]);
+        uint32_t best_cost = app_qspi_bench_cost_ns(&results[best]);
+
+        if (results[i].valid &&
+            ((cost < best_cost) ||
+             ((cost == best_cost) && (results[i].dma_kbps > results[best].dma_kbps))))
+        {
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+
+/* [] END OF FILE */
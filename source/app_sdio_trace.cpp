@@ -0,0 +1,593 @@
+/******************************************************************************
+ * File Name: app_sdio_trace.cpp
+ *
+ * Description:
+ *   Link time wrappers of the PSoC 6 HAL SDIO and GPIO calls made by the WLAN
+ *   host driver. Each wrapper counts the call, records it into the profile of
+ *   the current wake period and forwards it to the HAL. The wrappers are only
+ *   built with APP_SDIO_TRACE_ENABLED, see profiles/sdio_trace.json, as the
+ *   __real_ symbols only exist when linking with the matching --wrap options.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#define APP_LOG_MODULE APP_LOG_MODULE_STATS
+
+#include "app_sdio_trace.h"
+#include "app_log.h"
+
+#if APP_SDIO_TRACE_ENABLED
+#include "app_olm.h"
+#include "hal/us_ticker_api.h"
+#include "cyhal.h"
+#include "cycfg.h"
+#endif /* APP_SDIO_TRACE_ENABLED */
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+/* Fields of the CMD52 and CMD53 argument, see the SDIO specification. */
+#define SDIO_ARG_WRITE             (1UL << 31)
+#define SDIO_ARG_FUNC(arg)         (((arg) >> 28) & 0x7UL)
+#define SDIO_ARG_ADDR(arg)         (((arg) >> 9) & 0x1FFFFUL)
+#define SDIO_ARG_DATA(arg)         ((arg) & 0xFFUL)
+
+#define SDIO_FUNC_BACKPLANE        (1UL)
+#define SDIO_FUNC_WLAN             (2UL)
+
+/* Frame control register of the WLAN device backplane. Writing the
+ * terminate bit aborts the frame being read.
+ */
+#define SDIO_FRAME_CONTROL         (0x1000DUL)
+#define SDIO_SFC_RF_TERM           (1UL << 0)
+
+/* Backplane accesses through function 1 use a 32 KB window. The host
+ * driver keeps the window on the enumeration space, so the SDIO core
+ * registers appear at these offsets.
+ */
+#define SBSDIO_SB_ACCESS_2_4B_FLAG (0x8000UL)
+#define SBSDIO_SB_OFT_ADDR_MASK    (0x7FFFUL)
+#define SDIO_CORE_INT_STATUS       (0x2020UL)
+#define SDIO_CORE_TO_SB_MAILBOX    (0x2040UL)
+#define SDIO_CORE_TO_HOST_MAILBOX  (0x204CUL)
+
+/* Hardware tag and software header of a frame. Frames without payload only
+ * carry the credit update. The profiler counts every read of that size as
+ * a credit update, tools/sdio_profile.py moves the ones followed by the
+ * rest of a frame to the data class.
+ */
+#define SDPCM_HEADER_SIZE          (12U)
+
+/* Flags of a raw record. */
+#define REC_FLAG_CMD53             (1U << 0)
+#define REC_FLAG_FAIL              (1U << 1)
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+/* Raw bus transaction. */
+typedef struct
+{
+    uint32_t t_us;       /* Start, relative to the start of the wake period */
+    uint32_t arg;        /* CMD52/CMD53 argument */
+    uint32_t resp;       /* Response, holds the data read by CMD52 */
+    uint16_t len;        /* Bytes transferred by CMD53 */
+    uint16_t dur_us;     /* Duration, saturated */
+    uint8_t  flags;
+    uint8_t  cls;
+} app_sdio_rec_t;
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+static app_bus_stats_t bus_stats;
+
+#if APP_SDIO_TRACE_ENABLED
+/* Callbacks registered by the WLAN host driver. */
+static cyhal_sdio_event_callback_t sdio_cb = NULL;
+static void *sdio_cb_arg = NULL;
+static cyhal_gpio_event_callback_t oob_cb = NULL;
+static void *oob_cb_arg = NULL;
+
+/* Profile of the wake period in progress and of the last completed one.
+ * The raw records are double buffered, the main thread dumps the last
+ * period while the next one is recorded.
+ */
+static bool prof_suspended = false;
+static bool prof_open = false;
+static uint32_t prof_start_us = 0;
+static uint32_t prof_wakes = 0;
+static app_sdio_profile_t prof_cur;
+static app_sdio_profile_t prof_last;
+static bool prof_last_valid = false;
+
+static app_sdio_rec_t prof_recs[2][MBED_CONF_APP_SDIO_TRACE_RECORDS];
+static uint32_t prof_rec_count[2];
+static uint8_t prof_buf = 0;
+
+static const char *const sdio_class_name[APP_SDIO_CLASS_COUNT] =
+{
+    "poll",
+    "intr_ack",
+    "credit",
+    "data",
+    "ctrl",
+};
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+extern "C" {
+cy_rslt_t __real_cyhal_sdio_send_cmd(const cyhal_sdio_t *obj,
+                                     cyhal_transfer_t direction,
+                                     cyhal_sdio_command_t command,
+                                     uint32_t argument, uint32_t *response);
+cy_rslt_t __real_cyhal_sdio_bulk_transfer(cyhal_sdio_t *obj,
+                                          cyhal_transfer_t direction,
+                                          uint32_t argument,
+                                          const uint32_t *data,
+                                          uint16_t length,
+                                          uint32_t *response);
+void __real_cyhal_sdio_register_callback(cyhal_sdio_t *obj,
+                                         cyhal_sdio_event_callback_t callback,
+                                         void *callback_arg);
+void __real_cyhal_gpio_register_callback(cyhal_gpio_t pin,
+                                         cyhal_gpio_event_callback_t callback,
+                                         void *callback_arg);
+}
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/******************************************************************************
+ * Function Name: app_sdio_profile_open
+ ******************************************************************************
+ * Summary:
+ *   Starts the profile of a wake period. Must be called with interrupts
+ *   disabled.
+ *
+ *****************************************************************************/
+static void app_sdio_profile_open(void)
+{
+    prof_open = true;
+    prof_start_us = us_ticker_read();
+    prof_cur = app_sdio_profile_t();
+    prof_cur.wake = ++prof_wakes;
+    prof_buf ^= 1U;
+    prof_rec_count[prof_buf] = 0;
+}
+
+/******************************************************************************
+ * Function Name: app_sdio_classify
+ ******************************************************************************
+ * Summary:
+ *   Classifies a bus transaction by its function and register address.
+ *
+ * Parameters:
+ *   arg: CMD52/CMD53 argument.
+ *   len: Bytes transferred by CMD53, 0 for CMD52.
+ *
+ * Return:
+ *   app_sdio_class_t: Class of the transaction.
+ *
+ *****************************************************************************/
+static app_sdio_class_t app_sdio_classify(uint32_t arg, uint16_t len)
+{
+    bool write = (0 != (arg & SDIO_ARG_WRITE));
+    uint32_t addr = SDIO_ARG_ADDR(arg);
+
+    if (SDIO_FUNC_WLAN == SDIO_ARG_FUNC(arg))
+    {
+        return ((!write) && (SDPCM_HEADER_SIZE >= len)) ?
+               APP_SDIO_CLASS_CREDIT : APP_SDIO_CLASS_DATA;
+    }
+
+    if ((SDIO_FUNC_BACKPLANE == SDIO_ARG_FUNC(arg)) &&
+        (0 != (addr & SBSDIO_SB_ACCESS_2_4B_FLAG)))
+    {
+        uint32_t offset = addr & SBSDIO_SB_OFT_ADDR_MASK;
+
+        if ((write && ((SDIO_CORE_INT_STATUS == offset) ||
+                       (SDIO_CORE_TO_SB_MAILBOX == offset))) ||
+            ((!write) && (SDIO_CORE_TO_HOST_MAILBOX == offset)))
+        {
+            return APP_SDIO_CLASS_INTR_ACK;
+        }
+    }
+
+    return write ? APP_SDIO_CLASS_CTRL : APP_SDIO_CLASS_POLL;
+}
+
+/******************************************************************************
+ * Function Name: app_sdio_profile_record
+ ******************************************************************************
+ * Summary:
+ *   Accounts a bus transaction to the wake period in progress. Transactions
+ *   outside of a wake period are only counted in the bus counters.
+ *
+ * Parameters:
+ *   start_us: Start of the transaction.
+ *   end_us: End of the transaction.
+ *   arg: CMD52/CMD53 argument.
+ *   resp: Response of the transaction.
+ *   len: Bytes transferred by CMD53, 0 for CMD52.
+ *   flags: REC_FLAG_* flags.
+ *
+ *****************************************************************************/
+static void app_sdio_profile_record(uint32_t start_us, uint32_t end_us,
+                                    uint32_t arg, uint32_t resp,
+                                    uint16_t len, uint8_t flags)
+{
+    app_sdio_class_t cls = app_sdio_classify(arg, len);
+    uint32_t dur_us = end_us - start_us;
+
+    core_util_critical_section_enter();
+
+    if (prof_open)
+    {
+        app_sdio_cost_t *cost = &prof_cur.cls[cls];
+
+        cost->count++;
+        cost->bytes += len;
+        cost->time_us += dur_us;
+
+        if (MBED_CONF_APP_SDIO_TRACE_RECORDS > prof_rec_count[prof_buf])
+        {
+            app_sdio_rec_t *rec = &prof_recs[prof_buf][prof_rec_count[prof_buf]++];
+
+            rec->t_us = start_us - prof_start_us;
+            rec->arg = arg;
+            rec->resp = resp;
+            rec->len = len;
+            rec->dur_us = (dur_us > UINT16_MAX) ? UINT16_MAX : (uint16_t)dur_us;
+            rec->flags = flags;
+            rec->cls = (uint8_t)cls;
+        }
+        else
+        {
+            prof_cur.dropped++;
+        }
+    }
+
+    core_util_critical_section_exit();
+}
+
+/******************************************************************************
+ * Function Name: app_sdio_profile_olm_hook
+ ******************************************************************************
+ * Summary:
+ *   Offload manager hook. Closes the wake period on suspend. On resume, a
+ *   wake period is started unless the host wake interrupt already started
+ *   it.
+ *
+ * Parameters:
+ *   suspended: true on suspend, false on resume.
+ *
+ *****************************************************************************/
+static void app_sdio_profile_olm_hook(bool suspended)
+{
+    core_util_critical_section_enter();
+
+    if (suspended)
+    {
+        if (prof_open)
+        {
+            prof_cur.duration_us = us_ticker_read() - prof_start_us;
+            prof_last = prof_cur;
+            prof_last_valid = true;
+            prof_open = false;
+        }
+    }
+    else if (!prof_open)
+    {
+        app_sdio_profile_open();
+    }
+
+    prof_suspended = suspended;
+
+    core_util_critical_section_exit();
+}
+
+/* Counts the in-band card interrupts before calling the driver handler. */
+static void app_sdio_trace_sdio_event(void *callback_arg,
+                                      cyhal_sdio_event_t event)
+{
+    if (0 != (event & CYHAL_SDIO_CARD_INTERRUPT))
+    {
+        core_util_atomic_incr_u32(&bus_stats.sdio_intrs, 1);
+    }
+
+    sdio_cb(sdio_cb_arg, event);
+}
+
+/* Counts the host wake interrupts before calling the driver handler. A host
+ * wake interrupt while suspended starts the profile of a wake period.
+ */
+static void app_sdio_trace_oob_event(void *callback_arg,
+                                     cyhal_gpio_event_t event)
+{
+    core_util_atomic_incr_u32(&bus_stats.oob_intrs, 1);
+
+    core_util_critical_section_enter();
+    if (prof_suspended && (!prof_open))
+    {
+        app_sdio_profile_open();
+    }
+    core_util_critical_section_exit();
+
+    oob_cb(oob_cb_arg, event);
+}
+
+extern "C" {
+
+cy_rslt_t __wrap_cyhal_sdio_send_cmd(const cyhal_sdio_t *obj,
+                                     cyhal_transfer_t direction,
+                                     cyhal_sdio_command_t command,
+                                     uint32_t argument, uint32_t *response)
+{
+    uint32_t start_us = us_ticker_read();
+    cy_rslt_t result = __real_cyhal_sdio_send_cmd(obj, direction, command,
+                                                  argument, response);
+
+    if (CYHAL_SDIO_CMD_IO_RW_DIRECT == command)
+    {
+        core_util_atomic_incr_u32(&bus_stats.cmd52, 1);
+
+        if (CY_RSLT_SUCCESS != result)
+        {
+            core_util_atomic_incr_u32(&bus_stats.cmd52_fail, 1);
+        }
+        else if ((0 != (argument & SDIO_ARG_WRITE)) &&
+                 (SDIO_FUNC_BACKPLANE == SDIO_ARG_FUNC(argument)) &&
+                 (SDIO_FRAME_CONTROL == SDIO_ARG_ADDR(argument)) &&
+                 (0 != (SDIO_ARG_DATA(argument) & SDIO_SFC_RF_TERM)))
+        {
+            core_util_atomic_incr_u32(&bus_stats.read_aborts, 1);
+        }
+
+        app_sdio_profile_record(start_us, us_ticker_read(), argument,
+                                (NULL != response) ? *response : 0, 0,
+                                (CY_RSLT_SUCCESS != result) ? REC_FLAG_FAIL : 0);
+    }
+
+    return result;
+}
+
+cy_rslt_t __wrap_cyhal_sdio_bulk_transfer(cyhal_sdio_t *obj,
+                                          cyhal_transfer_t direction,
+                                          uint32_t argument,
+                                          const uint32_t *data,
+                                          uint16_t length,
+                                          uint32_t *response)
+{
+    uint32_t start_us = us_ticker_read();
+    cy_rslt_t result = __real_cyhal_sdio_bulk_transfer(obj, direction,
+                                                       argument, data,
+                                                       length, response);
+    uint8_t flags = REC_FLAG_CMD53;
+
+    if (CYHAL_READ == direction)
+    {
+        core_util_atomic_incr_u32(&bus_stats.cmd53_read, 1);
+        core_util_atomic_incr_u32(&bus_stats.read_bytes, length);
+    }
+    else
+    {
+        core_util_atomic_incr_u32(&bus_stats.cmd53_write, 1);
+        core_util_atomic_incr_u32(&bus_stats.write_bytes, length);
+    }
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        core_util_atomic_incr_u32(&bus_stats.cmd53_fail, 1);
+        flags |= REC_FLAG_FAIL;
+    }
+
+    app_sdio_profile_record(start_us, us_ticker_read(), argument,
+                            (NULL != response) ? *response : 0, length,
+                            flags);
+
+    return result;
+}
+
+void __wrap_cyhal_sdio_register_callback(cyhal_sdio_t *obj,
+                                         cyhal_sdio_event_callback_t callback,
+                                         void *callback_arg)
+{
+    if (NULL == callback)
+    {
+        __real_cyhal_sdio_register_callback(obj, callback, callback_arg);
+        return;
+    }
+
+    sdio_cb = callback;
+    sdio_cb_arg = callback_arg;
+    __real_cyhal_sdio_register_callback(obj, app_sdio_trace_sdio_event, NULL);
+}
+
+void __wrap_cyhal_gpio_register_callback(cyhal_gpio_t pin,
+                                         cyhal_gpio_event_callback_t callback,
+                                         void *callback_arg)
+{
+    /* Other users of GPIO interrupts, such as InterruptIn, are not traced. */
+    if ((CYCFG_WIFI_HOST_WAKE_GPIO != pin) || (NULL == callback))
+    {
+        __real_cyhal_gpio_register_callback(pin, callback, callback_arg);
+        return;
+    }
+
+    oob_cb = callback;
+    oob_cb_arg = callback_arg;
+    __real_cyhal_gpio_register_callback(pin, app_sdio_trace_oob_event, NULL);
+}
+
+}
+#endif /* APP_SDIO_TRACE_ENABLED */
+
+/******************************************************************************
+ * Function Name: app_sdio_trace_get
+ ******************************************************************************
+ * Summary:
+ *   Copies the SDIO bus counters. The counters are free running and wrap
+ *   around, compute differences between two copies to get the activity of
+ *   a period.
+ *
+ * Parameters:
+ *   stats: Copy of the counters.
+ *
+ * Return:
+ *   bool: false if the bus counters are not built in. stats is zeroed then.
+ *
+ *****************************************************************************/
+bool app_sdio_trace_get(app_bus_stats_t *stats)
+{
+    *stats = bus_stats;
+    return (APP_SDIO_TRACE_ENABLED != 0);
+}
+
+/******************************************************************************
+ * Function Name: app_sdio_profile_init
+ ******************************************************************************
+ * Summary:
+ *   Starts profiling the bus transactions of each wake period. Does nothing
+ *   without the bus counters built in.
+ *
+ * Return:
+ *   cy_rslt_t: Result of the hook registration.
+ *
+ *****************************************************************************/
+cy_rslt_t app_sdio_profile_init(void)
+{
+#if APP_SDIO_TRACE_ENABLED
+    return app_olm_add_hook(app_sdio_profile_olm_hook);
+#else
+    return CY_RSLT_SUCCESS;
+#endif /* APP_SDIO_TRACE_ENABLED */
+}
+
+/******************************************************************************
+ * Function Name: app_sdio_profile_get_last
+ ******************************************************************************
+ * Summary:
+ *   Returns the bus cost of the last completed wake period.
+ *
+ * Parameters:
+ *   profile: Bus cost of the period.
+ *
+ * Return:
+ *   bool: false if no wake period was profiled yet.
+ *
+ *****************************************************************************/
+bool app_sdio_profile_get_last(app_sdio_profile_t *profile)
+{
+#if APP_SDIO_TRACE_ENABLED
+    core_util_critical_section_enter();
+    *profile = prof_last;
+    core_util_critical_section_exit();
+
+    return prof_last_valid;
+#else
+    *profile = app_sdio_profile_t();
+    return false;
+#endif /* APP_SDIO_TRACE_ENABLED */
+}
+
+/******************************************************************************
+ * Function Name: app_sdio_profile_print
+ ******************************************************************************
+ * Summary:
+ *   Logs the cost table of a wake period.
+ *
+ * Parameters:
+ *   profile: Bus cost of the period.
+ *
+ *****************************************************************************/
+void app_sdio_profile_print(const app_sdio_profile_t *profile)
+{
+#if APP_SDIO_TRACE_ENABLED
+    APP_INFO(("Bus wake %lu: %lu us, %lu records dropped\n",
+              profile->wake, profile->duration_us, profile->dropped));
+    APP_INFO(("  %-8s %6s %8s %8s\n", "class", "count", "bytes", "us"));
+
+    for (int i = 0; i < APP_SDIO_CLASS_COUNT; i++)
+    {
+        APP_INFO(("  %-8s %6lu %8lu %8lu\n", sdio_class_name[i],
+                  profile->cls[i].count, profile->cls[i].bytes,
+                  profile->cls[i].time_us));
+    }
+#endif /* APP_SDIO_TRACE_ENABLED */
+}
+
+/******************************************************************************
+ * Function Name: app_sdio_profile_dump
+ ******************************************************************************
+ * Summary:
+ *   Prints the raw transactions of the last completed wake period as '#B:'
+ *   lines for tools/sdio_profile.py. Must be called from the thread calling
+ *   wait_net_suspend() while the network stack is resumed, so the buffer is
+ *   not reused during the dump.
+ *
+ *****************************************************************************/
+void app_sdio_profile_dump(void)
+{
+#if APP_SDIO_TRACE_ENABLED
+    uint8_t buf;
+    uint32_t wake;
+    uint32_t count;
+
+    core_util_critical_section_enter();
+    buf = prof_open ? (prof_buf ^ 1U) : prof_buf;
+    wake = prof_last.wake;
+    count = prof_rec_count[buf];
+    core_util_critical_section_exit();
+
+    if (!prof_last_valid)
+    {
+        return;
+    }
+
+    app_log_flush();
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const app_sdio_rec_t *rec = &prof_recs[buf][i];
+
+        printf("#B:%lx:%lx:%08lx:%08lx:%x:%x:%x\n", wake, rec->t_us,
+               rec->arg, rec->resp, rec->len, rec->dur_us, rec->flags);
+    }
+#endif /* APP_SDIO_TRACE_ENABLED */
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,119 @@
+/******************************************************************************
+ * File Name: app_sdio_trace.h
+ *
+ * Description:
+ *   Counters and profile of the SDIO bus between the host and the WLAN device.
+ *   The counters are collected by wrapping the PSoC 6 HAL SDIO and GPIO calls of
+ *   the WLAN host driver at link time. This requires the GCC_ARM toolchain and the
+ *   profiles/sdio_trace.json build profile, which defines
+ *   APP_SDIO_TRACE_ENABLED. Without it the bus counters are not available.
+ *   The profiler times and classifies every CMD52/CMD53 issued from the host
+ *   wake interrupt, or the resume of the network stack, until the next suspend.
+ *   It keeps a cost table per class for each of these wake periods and the raw
+ *   transactions of the last one for tools/sdio_profile.py.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef APP_SDIO_TRACE_H
+#define APP_SDIO_TRACE_H
+
+#include "mbed.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#ifndef APP_SDIO_TRACE_ENABLED
+#define APP_SDIO_TRACE_ENABLED     (0)
+#endif
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+typedef struct
+{
+    uint32_t cmd52;          /* CMD52 register accesses */
+    uint32_t cmd52_fail;     /* CMD52 accesses which returned an error */
+    uint32_t cmd53_read;     /* CMD53 reads from the WLAN device */
+    uint32_t cmd53_write;    /* CMD53 writes to the WLAN device */
+    uint32_t cmd53_fail;     /* CMD53 transfers which returned an error */
+    uint32_t read_bytes;     /* Bytes read with CMD53 */
+    uint32_t write_bytes;    /* Bytes written with CMD53 */
+    uint32_t read_aborts;    /* Frame reads terminated by the host */
+    uint32_t sdio_intrs;     /* In-band SDIO card interrupts */
+    uint32_t oob_intrs;      /* Host wake (out-of-band) interrupts */
+} app_bus_stats_t;
+
+/* Classes of bus transactions. Must stay in sync with CLASSES in
+ * tools/sdio_profile.py.
+ */
+typedef enum
+{
+    APP_SDIO_CLASS_POLL = 0, /* Register reads */
+    APP_SDIO_CLASS_INTR_ACK, /* Interrupt status and mailbox handshake */
+    APP_SDIO_CLASS_CREDIT,   /* Header only frames carrying credit updates */
+    APP_SDIO_CLASS_DATA,     /* Data frames */
+    APP_SDIO_CLASS_CTRL,     /* Other register writes: clock, window, sleep */
+    APP_SDIO_CLASS_COUNT
+} app_sdio_class_t;
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t bytes;
+    uint32_t time_us;
+} app_sdio_cost_t;
+
+/* Bus cost of one wake period. */
+typedef struct
+{
+    uint32_t         wake;
+    uint32_t         duration_us;
+    uint32_t         dropped;     /* Raw records which did not fit */
+    app_sdio_cost_t  cls[APP_SDIO_CLASS_COUNT];
+} app_sdio_profile_t;
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+bool app_sdio_trace_get(app_bus_stats_t *stats);
+cy_rslt_t app_sdio_profile_init(void);
+bool app_sdio_profile_get_last(app_sdio_profile_t *profile);
+void app_sdio_profile_print(const app_sdio_profile_t *profile);
+void app_sdio_profile_dump(void);
+
+#endif /* APP_SDIO_TRACE_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,355 @@
+/******************************************************************************
+ * File Name: app_stats.cpp
+ *
+ * Description:
+ *   Snapshots of the WLAN host driver and SDIO bus counters, and their
+ *   attribution to the wake periods of the network stack.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#define APP_LOG_MODULE APP_LOG_MODULE_STATS
+
+#include "app_stats.h"
+#include "app_olm.h"
+#include "app_log.h"
+#include "app_xip.h"
+#include "whd_emac.h"
+#include "whd_int.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#define APP_STATS_WORDS            (sizeof(app_stats_snapshot_t) / sizeof(uint32_t))
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+/* Snapshots taken by the offload manager hook. Only accessed from the thread
+ * calling wait_net_suspend(), so no locking is needed.
+ */
+static app_stats_snapshot_t at_suspend;
+static app_stats_snapshot_t at_wake;
+static bool awake_valid = false;
+static app_wake_reason_t wake_reason = APP_WAKE_REASON_UNKNOWN;
+static uint32_t wake_sleep_ms = 0;
+
+static app_stats_cycle_t last_cycle;
+static uint32_t cycle_count = 0;
+static app_stats_reason_t reason_stats[APP_WAKE_REASON_COUNT];
+
+static const char *const wake_reason_name[APP_WAKE_REASON_COUNT] =
+{
+    "unknown",
+    "wlan",
+    "host",
+};
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+static void app_stats_olm_hook(bool suspended);
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/******************************************************************************
+ * Function Name: app_stats_init
+ ******************************************************************************
+ * Summary:
+ *   Starts recording the activity and the bus profile of each wake period
+ *   of the network stack.
+ *
+ * Return:
+ *   cy_rslt_t: Result of the hook registration.
+ *
+ *****************************************************************************/
+cy_rslt_t app_stats_init(void)
+{
+    cy_rslt_t result = app_olm_add_hook(app_stats_olm_hook);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = app_sdio_profile_init();
+    }
+
+    return result;
+}
+
+/******************************************************************************
+ * Function Name: app_stats_capture
+ ******************************************************************************
+ * Summary:
+ *   Copies the current counters without any processing. The WLAN host
+ *   driver counters read as zero until the interface is initialized.
+ *
+ * Parameters:
+ *   snap: Snapshot to fill.
+ *
+ *****************************************************************************/
+void app_stats_capture(app_stats_snapshot_t *snap)
+{
+    whd_interface_t ifp = WHD_EMAC::get_instance().ifp;
+
+    snap->time_ms = (uint32_t)Kernel::Clock::now().time_since_epoch().count();
+
+    if ((NULL != ifp) && (NULL != ifp->whd_driver))
+    {
+        const whd_stats_t *whd = &ifp->whd_driver->whd_stats;
+
+        snap->whd.tx_total     = whd->tx_total;
+        snap->whd.rx_total     = whd->rx_total;
+        snap->whd.tx_no_mem    = whd->tx_no_mem;
+        snap->whd.rx_no_mem    = whd->rx_no_mem;
+        snap->whd.tx_fail      = whd->tx_fail;
+        snap->whd.no_credit    = whd->no_credit;
+        snap->whd.flow_control = whd->flow_control;
+    }
+    else
+    {
+        snap->whd = app_whd_stats_t();
+    }
+
+    app_sdio_trace_get(&snap->bus);
+}
+
+/******************************************************************************
+ * Function Name: app_stats_delta
+ ******************************************************************************
+ * Summary:
+ *   Computes the difference of two snapshots. The counters are free running,
+ *   the unsigned difference stays correct across a wrap around.
+ *
+ * Parameters:
+ *   from: Older snapshot.
+ *   to: Newer snapshot.
+ *   delta: Difference, time_ms being the elapsed time. May alias from or to.
+ *
+ *****************************************************************************/
+void app_stats_delta(const app_stats_snapshot_t *from,
+                     const app_stats_snapshot_t *to,
+                     app_stats_snapshot_t *delta)
+{
+    const uint32_t *a = (const uint32_t *)from;
+    const uint32_t *b = (const uint32_t *)to;
+    uint32_t *d = (uint32_t *)delta;
+
+    for (size_t i = 0; i < APP_STATS_WORDS; i++)
+    {
+        d[i] = b[i] - a[i];
+    }
+}
+
+/******************************************************************************
+ * Function Name: app_stats_add
+ ******************************************************************************
+ * Summary:
+ *   Accumulates a difference of snapshots.
+ *
+ * Parameters:
+ *   acc: Accumulated differences.
+ *   delta: Difference to add.
+ *
+ *****************************************************************************/
+void app_stats_add(app_stats_snapshot_t *acc,
+                   const app_stats_snapshot_t *delta)
+{
+    uint32_t *a = (uint32_t *)acc;
+    const uint32_t *d = (const uint32_t *)delta;
+
+    for (size_t i = 0; i < APP_STATS_WORDS; i++)
+    {
+        a[i] += d[i];
+    }
+}
+
+/******************************************************************************
+ * Function Name: app_stats_olm_hook
+ ******************************************************************************
+ * Summary:
+ *   Offload manager hook. On suspend it closes the wake period started by
+ *   the previous resume. On resume it derives the wake reason from the
+ *   activity while suspended.
+ *
+ * Parameters:
+ *   suspended: true on suspend, false on resume.
+ *
+ *****************************************************************************/
+APP_HOT static void app_stats_olm_hook(bool suspended)
+{
+    if (suspended)
+    {
+        app_stats_capture(&at_suspend);
+
+        if (awake_valid)
+        {
+            last_cycle.cycle = ++cycle_count;
+            last_cycle.reason = wake_reason;
+            last_cycle.sleep_ms = wake_sleep_ms;
+            app_stats_delta(&at_wake, &at_suspend, &last_cycle.delta);
+
+            reason_stats[wake_reason].cycles++;
+            reason_stats[wake_reason].sleep_ms += wake_sleep_ms;
+            app_stats_add(&reason_stats[wake_reason].total, &last_cycle.delta);
+        }
+    }
+    else
+    {
+        app_stats_capture(&at_wake);
+
+        wake_sleep_ms = at_wake.time_ms - at_suspend.time_ms;
+        wake_reason = APP_WAKE_REASON_UNKNOWN;
+
+        if (APP_SDIO_TRACE_ENABLED)
+        {
+            wake_reason = (at_wake.bus.oob_intrs != at_suspend.bus.oob_intrs) ?
+                          APP_WAKE_REASON_WLAN : APP_WAKE_REASON_HOST;
+        }
+
+        awake_valid = true;
+    }
+}
+
+/******************************************************************************
+ * Function Name: app_stats_get_last_cycle
+ ******************************************************************************
+ * Summary:
+ *   Returns the activity of the last completed wake period.
+ *
+ * Parameters:
+ *   cycle: Activity of the period.
+ *
+ * Return:
+ *   bool: false if no wake period completed yet.
+ *
+ *****************************************************************************/
+bool app_stats_get_last_cycle(app_stats_cycle_t *cycle)
+{
+    *cycle = last_cycle;
+    return (0 != cycle_count);
+}
+
+/******************************************************************************
+ * Function Name: app_stats_get_reason
+ ******************************************************************************
+ * Summary:
+ *   Returns the activity accumulated over the wake periods of one reason.
+ *
+ * Parameters:
+ *   reason: Wake reason.
+ *   stats: Accumulated activity.
+ *
+ *****************************************************************************/
+void app_stats_get_reason(app_wake_reason_t reason,
+                          app_stats_reason_t *stats)
+{
+    *stats = reason_stats[reason];
+}
+
+/******************************************************************************
+ * Function Name: app_stats_print_cycle
+ ******************************************************************************
+ * Summary:
+ *   Logs the activity of one wake period, with the bus cost table of the
+ *   last completed wake period when the bus counters are built in.
+ *
+ * Parameters:
+ *   cycle: Activity of the period.
+ *
+ *****************************************************************************/
+APP_XIP void app_stats_print_cycle(const app_stats_cycle_t *cycle)
+{
+    const app_stats_snapshot_t *d = &cycle->delta;
+
+    APP_INFO(("Wake %lu (%s): slept %lu ms, awake %lu ms\n",
+              (unsigned long)cycle->cycle, wake_reason_name[cycle->reason],
+              (unsigned long)cycle->sleep_ms, (unsigned long)d->time_ms));
+    APP_INFO(("  whd: tx %lu rx %lu tx_fail %lu no_mem %lu/%lu\n",
+              (unsigned long)d->whd.tx_total, (unsigned long)d->whd.rx_total,
+              (unsigned long)d->whd.tx_fail, (unsigned long)d->whd.tx_no_mem,
+              (unsigned long)d->whd.rx_no_mem));
+
+    if (APP_SDIO_TRACE_ENABLED)
+    {
+        APP_INFO(("  bus: cmd52 %lu cmd53 %lu/%lu bytes %lu/%lu fail %lu\n",
+                  (unsigned long)d->bus.cmd52, (unsigned long)d->bus.cmd53_read,
+                  (unsigned long)d->bus.cmd53_write, (unsigned long)d->bus.read_bytes,
+                  (unsigned long)d->bus.write_bytes,
+                  (unsigned long)(d->bus.cmd52_fail + d->bus.cmd53_fail)));
+
+        /* Both are closed by the same suspend. */
+        app_sdio_profile_t profile;
+
+        if (app_sdio_profile_get_last(&profile))
+        {
+            app_sdio_profile_print(&profile);
+        }
+
+#if MBED_CONF_APP_SDIO_TRACE_DUMP
+        app_sdio_profile_dump();
+#endif /* MBED_CONF_APP_SDIO_TRACE_DUMP */
+    }
+}
+
+/******************************************************************************
+ * Function Name: app_stats_print_summary
+ ******************************************************************************
+ * Summary:
+ *   Logs the activity accumulated per wake reason.
+ *
+ *****************************************************************************/
+APP_XIP void app_stats_print_summary(void)
+{
+    for (int i = 0; i < APP_WAKE_REASON_COUNT; i++)
+    {
+        const app_stats_reason_t *r = &reason_stats[i];
+
+        if (0 == r->cycles)
+        {
+            continue;
+        }
+
+        APP_INFO(("Wake reason %s: %lu wakes, slept %lu ms, awake %lu ms\n",
+                  wake_reason_name[i], (unsigned long)r->cycles,
+                  (unsigned long)r->sleep_ms, (unsigned long)r->total.time_ms));
+        APP_INFO(("  whd: tx %lu rx %lu, bus: cmd52 %lu cmd53 %lu\n",
+                  (unsigned long)r->total.whd.tx_total,
+                  (unsigned long)r->total.whd.rx_total,
+                  (unsigned long)r->total.bus.cmd52,
+                  (unsigned long)(r->total.bus.cmd53_read + r->total.bus.cmd53_write)));
+    }
+}
+
+
+/* [] END OF FILE */
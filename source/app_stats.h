@@ -0,0 +1,126 @@
+/******************************************************************************
+ * File Name: app_stats.h
+ *
+ * Description:
+ *   Snapshots of the WLAN host driver and SDIO bus counters.
+ *   app_stats_capture() only copies the counters, so it is cheap enough to call
+ *   on every suspend and resume of the network stack. The activity of a period
+ *   is the difference of two snapshots, see app_stats_delta(). Once
+ *   app_stats_init() registered the offload manager hook, the activity of each
+ *   wake period is recorded and accumulated per wake reason. Printing is left to
+ *   app_stats_print_cycle() and app_stats_print_summary(), which are meant to be
+ *   called outside of the suspend path.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef APP_STATS_H
+#define APP_STATS_H
+
+#include "mbed.h"
+#include "app_sdio_trace.h"
+
+/******************************************************************************
+ *                           TYPE DEFINITIONS
+ *****************************************************************************/
+/* Reason the network stack was resumed. The reason is only known with the
+ * SDIO bus counters built in.
+ */
+typedef enum
+{
+    APP_WAKE_REASON_UNKNOWN = 0,
+    APP_WAKE_REASON_WLAN,    /* Host wake interrupt from the WLAN device */
+    APP_WAKE_REASON_HOST,    /* Host activity such as a timer or a send */
+    APP_WAKE_REASON_COUNT
+} app_wake_reason_t;
+
+/* Packet counters of the WLAN host driver. */
+typedef struct
+{
+    uint32_t tx_total;
+    uint32_t rx_total;
+    uint32_t tx_no_mem;
+    uint32_t rx_no_mem;
+    uint32_t tx_fail;
+    uint32_t no_credit;
+    uint32_t flow_control;
+} app_whd_stats_t;
+
+/* All members are uint32_t counters, app_stats_delta() relies on it. */
+typedef struct
+{
+    uint32_t         time_ms;
+    app_whd_stats_t  whd;
+    app_bus_stats_t  bus;
+} app_stats_snapshot_t;
+
+/* Activity of one wake period, from the resume of the network stack to its
+ * next suspend.
+ */
+typedef struct
+{
+    uint32_t              cycle;
+    app_wake_reason_t     reason;
+    uint32_t              sleep_ms;
+    app_stats_snapshot_t  delta;
+} app_stats_cycle_t;
+
+/* Activity accumulated over all wake periods of one reason. */
+typedef struct
+{
+    uint32_t              cycles;
+    uint32_t              sleep_ms;
+    app_stats_snapshot_t  total;
+} app_stats_reason_t;
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+cy_rslt_t app_stats_init(void);
+void app_stats_capture(app_stats_snapshot_t *snap);
+void app_stats_delta(const app_stats_snapshot_t *from,
+                     const app_stats_snapshot_t *to,
+                     app_stats_snapshot_t *delta);
+void app_stats_add(app_stats_snapshot_t *acc,
+                   const app_stats_snapshot_t *delta);
+bool app_stats_get_last_cycle(app_stats_cycle_t *cycle);
+void app_stats_get_reason(app_wake_reason_t reason,
+                          app_stats_reason_t *stats);
+void app_stats_print_cycle(const app_stats_cycle_t *cycle);
+void app_stats_print_summary(void);
+
+#endif /* APP_STATS_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,252 @@
+/******************************************************************************
+ * File Name: app_wco.cpp
+ *
+ * Description:
+ *   Polls the WCO started by init_cycfg_system() and moves CLK_LF to it once
+ *   it is stable.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "app_wco.h"
+#include "app_log.h"
+#include "cy_mcwdt.h"
+#include "cy_sysclk.h"
+#include "cy_wdt.h"
+#include "cycfg.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#define APP_WCO_FLAG_READY         (1UL << 0)
+#define APP_WCO_FLAG_FAILED        (1UL << 1)
+
+/* Time an MCWDT enable or disable takes to synchronize: up to three CLK_LF
+ * cycles of the 32 kHz ILO.
+ */
+#define APP_WCO_MCWDT_SYNC_US      (93U)
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+static EventFlags wco_flags;
+static uint32_t wco_startup_ms = 0;
+
+#if defined(CY_CFG_SYSCLK_WCO_DEFERRED)
+static Ticker wco_poll;
+static Timer wco_timer;
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/******************************************************************************
+ * Function Name: app_wco_switch_clklf
+ ******************************************************************************
+ * Summary:
+ *   Moves CLK_LF to its configured source. CLK_LF clocks the MCWDT of the
+ *   low power ticker, and a counter must not run while its clock changes,
+ *   so the enabled MCWDT counters are stopped around the switch and started
+ *   again afterwards. The counters keep their values. The switch needs the
+ *   WDT unlocked, its lock state is restored afterwards.
+ *
+ *****************************************************************************/
+static void app_wco_switch_clklf(void)
+{
+    MCWDT_STRUCT_Type *const mcwdt[] =
+    {
+        MCWDT_STRUCT0,
+#if (SRSS_NUM_MCWDT > 1)
+        MCWDT_STRUCT1,
+#endif
+    };
+    uint32_t enabled[sizeof(mcwdt) / sizeof(mcwdt[0])];
+    bool locked = Cy_WDT_Locked();
+
+    for (uint32_t i = 0; i < (sizeof(mcwdt) / sizeof(mcwdt[0])); i++)
+    {
+        enabled[i] = 0;
+        for (uint32_t ctr = CY_MCWDT_COUNTER0; ctr <= CY_MCWDT_COUNTER2; ctr++)
+        {
+            if (0UL != Cy_MCWDT_GetEnabledStatus(mcwdt[i], (cy_en_mcwdtctr_t)ctr))
+            {
+                enabled[i] |= (1UL << ctr);
+            }
+        }
+        if (0UL != enabled[i])
+        {
+            Cy_MCWDT_Disable(mcwdt[i], enabled[i], APP_WCO_MCWDT_SYNC_US);
+        }
+    }
+
+    if (locked)
+    {
+        Cy_WDT_Unlock();
+    }
+    Cy_SysClk_ClkLfSetSource(CY_CFG_SYSCLK_CLKLF_SOURCE);
+    if (locked)
+    {
+        Cy_WDT_Lock();
+    }
+
+    for (uint32_t i = 0; i < (sizeof(mcwdt) / sizeof(mcwdt[0])); i++)
+    {
+        if (0UL != enabled[i])
+        {
+            Cy_MCWDT_Enable(mcwdt[i], enabled[i], APP_WCO_MCWDT_SYNC_US);
+        }
+    }
+}
+
+/******************************************************************************
+ * Function Name: app_wco_poll
+ ******************************************************************************
+ * Summary:
+ *   Checks the WCO from the poll ticker. Once it is stable, CLK_LF is moved
+ *   to its configured source with app_wco_switch_clklf(). The MCWDT of the
+ *   low power ticker runs at the ILO rate until then. After wco-timeout-ms
+ *   CLK_LF stays on the ILO and the failure is flagged, so that waiters are
+ *   released either way.
+ *
+ *****************************************************************************/
+static void app_wco_poll(void)
+{
+    uint32_t elapsed_ms = (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+                              wco_timer.elapsed_time()).count();
+
+    if (Cy_SysClk_WcoOkay())
+    {
+        if (CY_CFG_SYSCLK_CLKLF_SOURCE != Cy_SysClk_ClkLfGetSource())
+        {
+            app_wco_switch_clklf();
+        }
+
+        wco_startup_ms = elapsed_ms;
+        wco_poll.detach();
+        wco_timer.stop();
+        wco_flags.set(APP_WCO_FLAG_READY);
+    }
+    else if (elapsed_ms >= MBED_CONF_APP_WCO_TIMEOUT_MS)
+    {
+        wco_poll.detach();
+        wco_timer.stop();
+        wco_flags.set(APP_WCO_FLAG_FAILED);
+    }
+}
+#endif /* CY_CFG_SYSCLK_WCO_DEFERRED */
+
+/******************************************************************************
+ * Function Name: app_wco_init
+ ******************************************************************************
+ * Summary:
+ *   Starts polling the WCO every wco-poll-ms. Without a deferred startup the
+ *   WCO was already stable when init_cycfg_system() returned, so the event is
+ *   set immediately. The poll ticker and the startup timer keep the device
+ *   out of deep sleep until the WCO is stable or the timeout expires.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS.
+ *
+ *****************************************************************************/
+cy_rslt_t app_wco_init(void)
+{
+#if defined(CY_CFG_SYSCLK_WCO_DEFERRED)
+    wco_timer.start();
+    wco_poll.attach(&app_wco_poll, std::chrono::milliseconds(MBED_CONF_APP_WCO_POLL_MS));
+
+    core_util_critical_section_enter();
+    app_wco_poll();
+    core_util_critical_section_exit();
+#else
+    wco_flags.set(APP_WCO_FLAG_READY);
+#endif /* CY_CFG_SYSCLK_WCO_DEFERRED */
+
+    return CY_RSLT_SUCCESS;
+}
+
+/******************************************************************************
+ * Function Name: app_wco_is_ready
+ ******************************************************************************
+ * Summary:
+ *   Checks whether the WCO is stable and CLK_LF runs from its configured
+ *   source.
+ *
+ * Return:
+ *   bool: true once the WCO is ready.
+ *
+ *****************************************************************************/
+bool app_wco_is_ready(void)
+{
+    return (0 != (wco_flags.get() & APP_WCO_FLAG_READY));
+}
+
+/******************************************************************************
+ * Function Name: app_wco_wait_ready
+ ******************************************************************************
+ * Summary:
+ *   Blocks the calling thread until the WCO is ready or its startup failed.
+ *   Must not be called from interrupt context.
+ *
+ * Parameters:
+ *   timeout_ms: Maximum time to wait, osWaitForever to wait for the outcome.
+ *
+ * Return:
+ *   bool: true if the WCO is ready, false on a startup failure or timeout.
+ *
+ *****************************************************************************/
+bool app_wco_wait_ready(uint32_t timeout_ms)
+{
+    uint32_t flags = wco_flags.wait_any(APP_WCO_FLAG_READY | APP_WCO_FLAG_FAILED,
+                                        timeout_ms, false);
+
+    /* wait_any() returns an error code with the top bit set on timeout. */
+    return (0 == (flags & osFlagsError)) && (0 != (flags & APP_WCO_FLAG_READY));
+}
+
+/******************************************************************************
+ * Function Name: app_wco_get_startup_ms
+ ******************************************************************************
+ * Summary:
+ *   Returns the time from app_wco_init() until the WCO was stable.
+ *
+ * Return:
+ *   uint32_t: Time in ms, 0 if the WCO was not deferred or is not ready.
+ *
+ *****************************************************************************/
+uint32_t app_wco_get_startup_ms(void)
+{
+    return wco_startup_ms;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,64 @@
+/******************************************************************************
+ * File Name: app_wco.h
+ *
+ * Description:
+ *   Deferred WCO startup. With "wco_startup": "deferred" in
+ *   COMPONENT_CUSTOM_DESIGN_MODUS/boards.json, init_cycfg_system() starts the
+ *   32 kHz crystal without waiting for it and CLK_LF runs from the ILO. The
+ *   application polls the WCO and moves CLK_LF to it once it is stable, then
+ *   sets the readiness event. Components which need the accurate low
+ *   frequency clock, such as the RTC, wait for that event; the rest of the
+ *   start-up, networking included, does not.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef APP_WCO_H
+#define APP_WCO_H
+
+#include "mbed.h"
+#include "cy_result.h"
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+cy_rslt_t app_wco_init(void);
+bool app_wco_is_ready(void);
+bool app_wco_wait_ready(uint32_t timeout_ms);
+uint32_t app_wco_get_startup_ms(void);
+
+#endif /* APP_WCO_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,244 @@
+/******************************************************************************
+ * File Name: app_wl_connect.cpp
+ *
+ * Description:
+ *   Wi-Fi connect helpers. app_wl_connect_async() returns as soon as the
+ *   worker thread is started so that the caller can prepare sockets and
+ *   filters while the association is in progress.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#define APP_LOG_MODULE             APP_LOG_MODULE_WIFI
+
+#include "app_wl_connect.h"
+#include "app_log.h"
+#include "app_dvfs.h"
+#include "app_xip.h"
+
+/******************************************************************************
+ *                          TYPE DEFINITIONS
+ *****************************************************************************/
+/* Arguments handed over to the connect worker thread. */
+typedef struct
+{
+    WhdSTAInterface  *wifi;
+    const char       *ssid;
+    const char       *pwd;
+    nsapi_security_t  security;
+    app_wl_conn_cb_t  done_cb;
+} app_wl_connect_req_t;
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+/* Worker thread of the asynchronous connect request in progress. */
+static rtos::Thread *connect_thread = NULL;
+
+/* Request owned by connect_thread. */
+static app_wl_connect_req_t connect_req;
+
+/* Set until the completion callback of the request returned. */
+static volatile bool connect_busy = false;
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/******************************************************************************
+ * Function Name: app_wl_do_connect
+ ******************************************************************************
+ * Summary:
+ *   Associates to the AP and fills the link parameters into the info
+ *   structure. The link parameters are gathered in a single snapshot once
+ *   the association succeeded.
+ *
+ * Parameters:
+ *   wifi: A pointer to WLAN interface.
+ *   ssid: Wi-Fi AP SSID.
+ *   pwd: Wi-Fi AP Password.
+ *   security: Wi-Fi security type as defined in structure nsapi_security_t.
+ *   info: Link parameters to be filled.
+ *
+ *****************************************************************************/
+APP_XIP static void app_wl_do_connect(WhdSTAInterface *wifi, const char *ssid,
+                              const char *pwd, nsapi_security_t security,
+                              app_wl_conn_info_t *info)
+{
+    info->net = app_net_info_t();
+
+    APP_INFO(("Connecting to %s...\n", ssid));
+
+    /* The WPA handshake and the DHCP exchange are CPU bound bursts. */
+    (void)app_dvfs_request();
+    info->result = wifi->connect(ssid, pwd, security);
+    app_dvfs_release();
+
+    if (CY_RSLT_SUCCESS == info->result)
+    {
+        info->result = app_net_info_get(wifi, &info->net);
+    }
+    else
+    {
+        info->result = CY_RSLT_TYPE_ERROR;
+    }
+}
+
+/******************************************************************************
+ * Function Name: app_wl_connect_thread
+ ******************************************************************************
+ * Summary:
+ *   Entry function of the connect worker thread. It performs the association
+ *   and delivers the result through the completion callback of the request.
+ *
+ *****************************************************************************/
+APP_XIP static void app_wl_connect_thread(void)
+{
+    app_wl_conn_info_t info;
+
+    app_wl_do_connect(connect_req.wifi, connect_req.ssid, connect_req.pwd,
+                      connect_req.security, &info);
+
+    if (connect_req.done_cb)
+    {
+        connect_req.done_cb(&info);
+    }
+
+    core_util_atomic_store_bool(&connect_busy, false);
+}
+
+/******************************************************************************
+ * Function Name: app_wl_print_conn_info
+ ******************************************************************************
+ * Summary:
+ *   Prints the link parameters reported by a connect request.
+ *
+ * Parameters:
+ *   info: Link parameters of the connect request.
+ *
+ *****************************************************************************/
+APP_XIP void app_wl_print_conn_info(const app_wl_conn_info_t *info)
+{
+    if (CY_RSLT_SUCCESS == info->result)
+    {
+        APP_INFO(("MAC\t : %s\n", info->net.mac));
+        APP_INFO(("Netmask\t : %s\n", info->net.netmask.get_ip_address()));
+        APP_INFO(("Gateway\t : %s\n", info->net.gateway.get_ip_address()));
+        APP_INFO(("RSSI\t : %d\n\n", info->net.rssi));
+        APP_INFO(("IP Addr\t : %s\n\n", info->net.ip.get_ip_address()));
+    }
+    else
+    {
+        APP_INFO(("\nFailed to connect to Wi-Fi AP.\n"));
+    }
+}
+
+/******************************************************************************
+ * Function Name: app_wl_connect_async
+ ******************************************************************************
+ * Summary:
+ *   Starts the association to the given AP in a worker thread and returns
+ *   immediately. The completion callback is invoked exactly once from the
+ *   worker thread with the result and the link parameters. Only one request
+ *   can be in progress at a time, a new one is accepted once the callback
+ *   of the previous one returned.
+ *
+ * Parameters:
+ *   wifi: A pointer to WLAN interface whose emac activity is being monitored.
+ *   ssid: Wi-Fi AP SSID. Must remain valid until the callback is invoked.
+ *   pwd: Wi-Fi AP Password. Must remain valid until the callback is invoked.
+ *   security: Wi-Fi security type as defined in structure nsapi_security_t.
+ *   done_cb: Completion callback.
+ *
+ * Return:
+ *   cy_rslt_t: Returns CY_RSLT_SUCCESS if the request was started, or
+ *              CY_RSLT_TYPE_ERROR on bad arguments, if a request is already
+ *              in progress or if the worker thread could not be started.
+ *
+ *****************************************************************************/
+APP_XIP cy_rslt_t app_wl_connect_async(WhdSTAInterface *wifi, const char *ssid,
+                               const char *pwd, nsapi_security_t security,
+                               app_wl_conn_cb_t done_cb)
+{
+    bool idle = false;
+
+    APP_INFO(("SSID: %s, Security: %d\n", ssid, security));
+
+    if ((NULL == wifi) || (NULL == ssid) || (NULL == pwd) || (!done_cb))
+    {
+        ERR_INFO(("%s( %p, %p, %p) bad args\n",
+                  __func__, (void*)wifi, (void*)ssid, (void*)pwd));
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    /* Only the caller which sets the flag owns connect_thread and
+     * connect_req until the worker clears it again.
+     */
+    if (!core_util_atomic_cas_bool(&connect_busy, &idle, true))
+    {
+        ERR_INFO(("%s: connect already in progress\n", __func__));
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    if (NULL != connect_thread)
+    {
+        /* The worker only has to return from its entry function. */
+        (void)connect_thread->join();
+        delete connect_thread;
+        connect_thread = NULL;
+    }
+
+    connect_req.wifi = wifi;
+    connect_req.ssid = ssid;
+    connect_req.pwd = pwd;
+    connect_req.security = security;
+    connect_req.done_cb = done_cb;
+
+    connect_thread = new rtos::Thread(osPriorityNormal,
+                                      APP_WL_CONNECT_THREAD_STACK_SIZE,
+                                      NULL, "wl_connect");
+
+    if (osOK != connect_thread->start(mbed::callback(app_wl_connect_thread)))
+    {
+        ERR_INFO(("%s: failed to start the connect thread\n", __func__));
+        delete connect_thread;
+        connect_thread = NULL;
+        core_util_atomic_store_bool(&connect_busy, false);
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,83 @@
+/******************************************************************************
+ * File Name: app_wl_connect.h
+ *
+ * Description:
+ *   Interface to the Wi-Fi connect helpers. The asynchronous variant
+ *   associates to the AP in a worker thread and reports the link
+ *   parameters through a single completion callback.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef APP_WL_CONNECT_H
+#define APP_WL_CONNECT_H
+
+#include "mbed.h"
+#include "WhdSTAInterface.h"
+#include "app_net_info.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+/* Stack size in bytes of the worker thread which performs the association. */
+#define APP_WL_CONNECT_THREAD_STACK_SIZE    (4096)
+
+/******************************************************************************
+ *                          TYPE DEFINITIONS
+ *****************************************************************************/
+/* Link parameters delivered on completion of the connect request. */
+typedef struct
+{
+    cy_rslt_t      result;   /* CY_RSLT_SUCCESS on association.         */
+    app_net_info_t net;      /* Link parameters, valid on success only. */
+} app_wl_conn_info_t;
+
+/* Completion callback. It is invoked from the connect worker thread, the info
+ * pointer is only valid for the duration of the call.
+ */
+typedef mbed::Callback<void(const app_wl_conn_info_t *info)> app_wl_conn_cb_t;
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+cy_rslt_t app_wl_connect_async(WhdSTAInterface *wifi, const char *ssid,
+                               const char *pwd, nsapi_security_t security,
+                               app_wl_conn_cb_t done_cb);
+
+void app_wl_print_conn_info(const app_wl_conn_info_t *info);
+
+#endif /* APP_WL_CONNECT_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,471 @@
+/******************************************************************************
+ * File Name: app_xip.cpp
+ *
+ * Description:
+ *   Setup of the QSPI memory of the kit in memory-mapped (XIP) mode with the
+ *   memory slot generated by the QSPI Configurator, and the erase and
+ *   program commands of the data stored in it.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#include "app_xip.h"
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cycfg_qspi_memslot.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+/* Timeout of the quad enable status register write. */
+#define APP_XIP_QE_TIMEOUT_US      (100000UL)
+
+/******************************************************************************
+ *                       GLOBAL VARIABLES
+ *****************************************************************************/
+static cyhal_qspi_t xip_qspi;
+static bool xip_mapped = false;
+
+/* Serializes the command sequences and the reads of the mapped memory. */
+static Mutex xip_mutex;
+
+/* Copies of the generated memory slot, so that the read command of the XIP
+ * mode can be changed at runtime.
+ */
+static cy_stc_smif_mem_cmd_t xip_read_cmd;
+static cy_stc_smif_mem_device_cfg_t xip_device;
+static cy_stc_smif_mem_config_t xip_mem;
+static cy_stc_smif_mem_config_t *xip_mems[CY_SMIF_DEVICE_NUM] = { &xip_mem };
+static cy_stc_smif_block_config_t xip_block;
+
+static cy_stc_syspm_callback_params_t xip_cb_params;
+static cy_stc_syspm_callback_t xip_cb =
+{
+    .callback = &Cy_SMIF_DeepSleepCallback,
+    .type = CY_SYSPM_DEEPSLEEP,
+    .skipMode = 0UL,
+    .callbackParams = &xip_cb_params,
+    .prevItm = NULL,
+    .nextItm = NULL,
+    .order = 0U,
+};
+
+/******************************************************************************
+ *                     FUNCTION DEFINITIONS
+ *****************************************************************************/
+/******************************************************************************
+ * Function Name: app_xip_quad_enable
+ ******************************************************************************
+ * Summary:
+ *   Sets the quad enable bit of the memory if its read command transfers the
+ *   data on four lines, and waits for the status register write to finish.
+ *
+ * Parameters:
+ *   mem: Memory slot configuration.
+ *
+ * Return:
+ *   cy_rslt_t: Result of the SMIF driver.
+ *
+ *****************************************************************************/
+static cy_rslt_t app_xip_quad_enable(const cy_stc_smif_mem_config_t *mem)
+{
+    cy_en_smif_status_t status;
+    uint32_t waited_us = 0;
+
+    if (CY_SMIF_WIDTH_QUAD != mem->deviceCfg->readCmd->dataWidth)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    status = Cy_SMIF_Memslot_QuadEnable(xip_qspi.base,
+                                        (cy_stc_smif_mem_config_t *)mem,
+                                        &xip_qspi.context);
+
+    while ((CY_SMIF_SUCCESS == status) &&
+           Cy_SMIF_Memslot_IsBusy(xip_qspi.base, (cy_stc_smif_mem_config_t *)mem,
+                                  &xip_qspi.context))
+    {
+        if (waited_us >= APP_XIP_QE_TIMEOUT_US)
+        {
+            status = CY_SMIF_EXCEED_TIMEOUT;
+            break;
+        }
+        Cy_SysLib_DelayUs(10U);
+        waited_us += 10U;
+    }
+
+    return (CY_SMIF_SUCCESS == status) ? CY_RSLT_SUCCESS : (cy_rslt_t)status;
+}
+
+/******************************************************************************
+ * Function Name: app_xip_init
+ ******************************************************************************
+ * Summary:
+ *   Initializes the SMIF block on the QSPI pins of the kit and maps the
+ *   memory at APP_XIP_BASE_ADDR with the read command of the generated
+ *   memory slot. Must be called by main() before any code placed with
+ *   APP_XIP runs. A SMIF deep sleep callback is registered so that deep
+ *   sleep is not entered during a transfer.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or the error of the HAL or SMIF driver.
+ *
+ *****************************************************************************/
+cy_rslt_t app_xip_init(void)
+{
+    const cy_stc_smif_mem_config_t *mem = &xip_mem;
+    cy_rslt_t result;
+
+    if (xip_mapped)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    xip_mem = *smifMemConfigs[0];
+    xip_device = *xip_mem.deviceCfg;
+    xip_read_cmd = *xip_device.readCmd;
+    xip_device.readCmd = &xip_read_cmd;
+    xip_mem.deviceCfg = &xip_device;
+    xip_block = smifBlockConfig;
+    xip_block.memCount = 1U;
+    xip_block.memConfig = xip_mems;
+
+    result = cyhal_qspi_init(&xip_qspi, CYBSP_QSPI_D0, CYBSP_QSPI_D1,
+                             CYBSP_QSPI_D2, CYBSP_QSPI_D3, NC, NC, NC, NC,
+                             CYBSP_QSPI_SCK, CYBSP_QSPI_SS,
+                             APP_XIP_QSPI_FREQ_HZ, 0U);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    /* Memslot init programs the XIP read sequence of every memory-mapped
+     * slot. The device stays in command mode until the quad enable bit is
+     * set.
+     */
+    result = (cy_rslt_t)Cy_SMIF_Memslot_Init(xip_qspi.base, &xip_block,
+                                             &xip_qspi.context);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        Cy_SMIF_SetDataSelect(xip_qspi.base, mem->slaveSelect, mem->dataSelect);
+        result = app_xip_quad_enable(mem);
+    }
+    if (CY_RSLT_SUCCESS != result)
+    {
+        cyhal_qspi_free(&xip_qspi);
+        return result;
+    }
+
+    Cy_SMIF_SetMode(xip_qspi.base, CY_SMIF_MEMORY);
+
+    xip_cb_params.base = xip_qspi.base;
+    xip_cb_params.context = &xip_qspi.context;
+    if (!Cy_SysPm_RegisterCallback(&xip_cb))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    xip_mapped = true;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/******************************************************************************
+ * Function Name: app_xip_command_begin
+ ******************************************************************************
+ * Summary:
+ *   Leaves the memory-mapped mode for a command sequence. The memory cannot
+ *   be read while it erases or programs, so in XIP builds the kernel is
+ *   locked until app_xip_command_end(): no other thread may fetch code
+ *   placed with APP_XIP in the meantime. Interrupt handlers keep running,
+ *   none of them is placed in the QSPI memory.
+ *
+ * Return:
+ *   int32_t: Kernel lock state to be passed to app_xip_command_end().
+ *
+ *****************************************************************************/
+static int32_t app_xip_command_begin(void)
+{
+    int32_t lock = 0;
+
+    xip_mutex.lock();
+#if APP_XIP_ENABLED
+    lock = osKernelLock();
+#endif /* APP_XIP_ENABLED */
+    Cy_SMIF_SetMode(xip_qspi.base, CY_SMIF_NORMAL);
+
+    return lock;
+}
+
+/******************************************************************************
+ * Function Name: app_xip_command_end
+ ******************************************************************************
+ * Summary:
+ *   Invalidates the XIP cache, which may hold the old content of the
+ *   changed memory, and returns to the memory-mapped mode.
+ *
+ * Parameters:
+ *   lock: Kernel lock state returned by app_xip_command_begin().
+ *
+ *****************************************************************************/
+static void app_xip_command_end(int32_t lock)
+{
+    Cy_SMIF_CacheInvalidate(xip_qspi.base, CY_SMIF_CACHE_BOTH);
+    Cy_SMIF_SetMode(xip_qspi.base, CY_SMIF_MEMORY);
+#if APP_XIP_ENABLED
+    (void)osKernelRestoreLock(lock);
+#else
+    (void)lock;
+#endif /* APP_XIP_ENABLED */
+    xip_mutex.unlock();
+}
+
+/******************************************************************************
+ * Function Name: app_xip_is_mapped
+ ******************************************************************************
+ * Summary:
+ *   Checks whether the QSPI memory is mapped.
+ *
+ * Return:
+ *   bool: true after a successful app_xip_init().
+ *
+ *****************************************************************************/
+bool app_xip_is_mapped(void)
+{
+    return xip_mapped;
+}
+
+/******************************************************************************
+ * Function Name: app_xip_get_device
+ ******************************************************************************
+ * Summary:
+ *   Returns the generated configuration of the memory, with its size, erase
+ *   sector size and program page size.
+ *
+ * Return:
+ *   const cy_stc_smif_mem_device_cfg_t *: Device configuration.
+ *
+ *****************************************************************************/
+const cy_stc_smif_mem_device_cfg_t *app_xip_get_device(void)
+{
+    return &xip_device;
+}
+
+/******************************************************************************
+ * Function Name: app_xip_read
+ ******************************************************************************
+ * Summary:
+ *   Copies data from the mapped memory. Unlike a plain access through
+ *   APP_XIP_BASE_ADDR, it waits for a running erase or program to finish.
+ *
+ * Parameters:
+ *   offset: Offset in the memory.
+ *   data: Destination buffer.
+ *   length: Number of bytes.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if the memory is not
+ *   mapped or the range is outside of it.
+ *
+ *****************************************************************************/
+cy_rslt_t app_xip_read(uint32_t offset, void *data, uint32_t length)
+{
+    if (!xip_mapped || (offset > app_xip_get_device()->memSize) ||
+        (length > (app_xip_get_device()->memSize - offset)))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    xip_mutex.lock();
+    memcpy(data, (const void *)(APP_XIP_BASE_ADDR + offset), length);
+    xip_mutex.unlock();
+
+    return CY_RSLT_SUCCESS;
+}
+
+/******************************************************************************
+ * Function Name: app_xip_erase
+ ******************************************************************************
+ * Summary:
+ *   Erases the sectors of a range of the memory. The call blocks for the
+ *   erase time of the part, up to seconds per sector.
+ *
+ * Parameters:
+ *   offset: Offset in the memory, aligned to the erase sector size.
+ *   length: Number of bytes, a multiple of the erase sector size.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or the error of the SMIF driver.
+ *
+ *****************************************************************************/
+cy_rslt_t app_xip_erase(uint32_t offset, uint32_t length)
+{
+    cy_en_smif_status_t status;
+    int32_t lock;
+
+    if (!xip_mapped)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    lock = app_xip_command_begin();
+    status = Cy_SMIF_MemEraseSector(xip_qspi.base, &xip_mem, offset,
+                                    length, &xip_qspi.context);
+    app_xip_command_end(lock);
+
+    return (CY_SMIF_SUCCESS == status) ? CY_RSLT_SUCCESS : (cy_rslt_t)status;
+}
+
+/******************************************************************************
+ * Function Name: app_xip_write
+ ******************************************************************************
+ * Summary:
+ *   Programs erased memory. The SMIF driver splits the data at the program
+ *   page boundaries and waits for each page.
+ *
+ * Parameters:
+ *   offset: Offset in the memory.
+ *   data: Data to be programmed.
+ *   length: Number of bytes.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, or the error of the SMIF driver.
+ *
+ *****************************************************************************/
+cy_rslt_t app_xip_write(uint32_t offset, const void *data, uint32_t length)
+{
+    cy_en_smif_status_t status;
+    int32_t lock;
+
+    if (!xip_mapped)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    lock = app_xip_command_begin();
+    status = Cy_SMIF_MemWrite(xip_qspi.base, &xip_mem, offset,
+                              (const uint8_t *)data, length, &xip_qspi.context);
+    app_xip_command_end(lock);
+
+    return (CY_SMIF_SUCCESS == status) ? CY_RSLT_SUCCESS : (cy_rslt_t)status;
+}
+
+/******************************************************************************
+ * Function Name: app_xip_get_read_cmd
+ ******************************************************************************
+ * Summary:
+ *   Returns the read command of the XIP mode.
+ *
+ * Return:
+ *   const cy_stc_smif_mem_cmd_t *: Current read command.
+ *
+ *****************************************************************************/
+const cy_stc_smif_mem_cmd_t *app_xip_get_read_cmd(void)
+{
+    return &xip_read_cmd;
+}
+
+/******************************************************************************
+ * Function Name: app_xip_set_read_cmd
+ ******************************************************************************
+ * Summary:
+ *   Changes the read command of the XIP mode. Code placed with APP_XIP must
+ *   never be fetched with a command the memory does not answer as
+ *   expected, such as one with the wrong number of dummy cycles. The new
+ *   command is therefore checked against known data before the kernel is
+ *   unlocked, and the previous command is restored if the data differs.
+ *
+ * Parameters:
+ *   cmd: Read command.
+ *   offset: Offset of the data read back with the new command.
+ *   expected: Data expected at offset.
+ *   length: Number of bytes, 0 to skip the check.
+ *
+ * Return:
+ *   cy_rslt_t: CY_RSLT_SUCCESS, CY_RSLT_TYPE_ERROR if the data read back
+ *   differs, or the error of the SMIF driver.
+ *
+ *****************************************************************************/
+cy_rslt_t app_xip_set_read_cmd(const cy_stc_smif_mem_cmd_t *cmd, uint32_t offset,
+                               const void *expected, uint32_t length)
+{
+    cy_stc_smif_mem_cmd_t previous = xip_read_cmd;
+    cy_rslt_t result;
+    int32_t lock;
+
+    if (!xip_mapped || (offset > xip_device.memSize) ||
+        (length > (xip_device.memSize - offset)))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    lock = app_xip_command_begin();
+    xip_read_cmd = *cmd;
+    result = (cy_rslt_t)Cy_SMIF_Memslot_Init(xip_qspi.base, &xip_block,
+                                             &xip_qspi.context);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        Cy_SMIF_CacheInvalidate(xip_qspi.base, CY_SMIF_CACHE_BOTH);
+        Cy_SMIF_SetMode(xip_qspi.base, CY_SMIF_MEMORY);
+        if (0 != memcmp((const void *)(APP_XIP_BASE_ADDR + offset), expected, length))
+        {
+            result = CY_RSLT_TYPE_ERROR;
+        }
+        Cy_SMIF_SetMode(xip_qspi.base, CY_SMIF_NORMAL);
+    }
+    if (CY_RSLT_SUCCESS != result)
+    {
+        xip_read_cmd = previous;
+        (void)Cy_SMIF_Memslot_Init(xip_qspi.base, &xip_block, &xip_qspi.context);
+    }
+    app_xip_command_end(lock);
+
+    return result;
+}
+
+/******************************************************************************
+ * Function Name: app_xip_invalidate_cache
+ ******************************************************************************
+ * Summary:
+ *   Invalidates both XIP caches, so that the next reads of the mapped memory
+ *   are fetched from the device.
+ *
+ *****************************************************************************/
+void app_xip_invalidate_cache(void)
+{
+    Cy_SMIF_CacheInvalidate(xip_qspi.base, CY_SMIF_CACHE_BOTH);
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,95 @@
+/******************************************************************************
+ * File Name: app_xip.h
+ *
+ * Description:
+ *   Placement of code in the execute-in-place (XIP) QSPI memory, the internal
+ *   flash or the SRAM, and the setup of the memory-mapped QSPI interface.
+ *
+ * Related Document: README.md
+ *
+ ******************************************************************************
+ * Copyright (2019-2020), Cypress Semiconductor Corporation. All rights reserved.
+ ******************************************************************************
+ * This software, including source code, documentation and related materials
+ * (“Software”), is owned by Cypress Semiconductor Corporation or one of its
+ * subsidiaries (“Cypress”) and is protected by and subject to worldwide patent
+ * protection (United States and foreign), United States copyright laws and
+ * international treaty provisions. Therefore, you may use this Software only
+ * as provided in the license agreement accompanying the software package from
+ * which you obtained this Software (“EULA”).
+ *
+ * If no EULA applies, Cypress hereby grants you a personal, nonexclusive,
+ * non-transferable license to copy, modify, and compile the Software source
+ * code solely for use in connection with Cypress’s integrated circuit products.
+ * Any reproduction, modification, translation, compilation, or representation
+ * of this Software except as specified above is prohibited without the express
+ * written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death (“High Risk Product”). By
+ * including Cypress’s product in a High Risk Product, the manufacturer of such
+ * system or application assumes all risk of such use and in doing so agrees to
+ * indemnify Cypress against all liability.
+ *****************************************************************************/
+
+#ifndef APP_XIP_H
+#define APP_XIP_H
+
+#include "mbed.h"
+#include "cy_pdl.h"
+
+/******************************************************************************
+ *                                MACROS
+ *****************************************************************************/
+#ifndef APP_XIP_ENABLED
+#define APP_XIP_ENABLED            (0)
+#endif
+
+/* Frequency requested for the SMIF interface clock. */
+#define APP_XIP_QSPI_FREQ_HZ       (50000000UL)
+
+/* Base address of the memory-mapped QSPI memory. */
+#define APP_XIP_BASE_ADDR          (0x18000000UL)
+
+/* Cold code, such as the connect path, log formatting and the parsing of the
+ * configuration, is placed in the .cy_xip section of the QSPI memory by
+ * builds with the profiles/xip.json profile and stays in the internal flash
+ * otherwise. It must not run before app_xip_init().
+ */
+#if APP_XIP_ENABLED
+#define APP_XIP                    CY_SECTION(".cy_xip")
+#else
+#define APP_XIP
+#endif /* APP_XIP_ENABLED */
+
+/* Code of the suspend and resume path, which must not wait for QSPI fetches
+ * after a deep sleep exit. It stays in the internal flash, the section name
+ * only lets tools/xip_map.py check the placement.
+ */
+#define APP_HOT                    CY_SECTION(".text.app_hot")
+
+/******************************************************************************
+ *                        FUNCTION DECLARATIONS
+ *****************************************************************************/
+cy_rslt_t app_xip_init(void);
+bool app_xip_is_mapped(void);
+const cy_stc_smif_mem_device_cfg_t *app_xip_get_device(void);
+cy_rslt_t app_xip_read(uint32_t offset, void *data, uint32_t length);
+cy_rslt_t app_xip_erase(uint32_t offset, uint32_t length);
+cy_rslt_t app_xip_write(uint32_t offset, const void *data, uint32_t length);
+const cy_stc_smif_mem_cmd_t *app_xip_get_read_cmd(void);
+cy_rslt_t app_xip_set_read_cmd(const cy_stc_smif_mem_cmd_t *cmd, uint32_t offset,
+                               const void *expected, uint32_t length);
+void app_xip_invalidate_cache(void);
+
+#endif /* APP_XIP_H */
+
+
+/* [] END OF FILE */
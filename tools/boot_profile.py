@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+"""
+Estimates the time of each stage of init_cycfg_all() from the generated
+sources of every kit, and compares it with the boot profile measured on a
+kit built with the profiles/boot_profile.json build profile.
+
+The measured profile is printed at boot as
+
+    Boot profile: init_cycfg_all <us> us
+    Boot profile: system <us> us, WCO wait <us> us, FLL wait <us> us
+    Boot profile: clocks <us> us, routing <us> us, pins <us> us
+
+The host model counts the work of each stage in the generated sources:
+the busy-waits of init_cycfg_system() (WCO startup unless deferred, FLL
+lock and the ILO to CLKLF transition delay), the peripheral clock dividers of
+init_cycfg_clocks() and the pins of init_cycfg_pins(), at the CPU clock of
+the configuration. The blocks moved out of boot by the lazy list of
+boards.json are not counted. The cost constants are rough defaults; a
+measured profile passed with --log replaces them, so the model then
+predicts the effect of design changes on the other kits and designs.
+
+Usage:
+    python tools/boot_profile.py                         estimate all kits
+    python tools/boot_profile.py --design ulp            estimate the ULP designs
+    python tools/boot_profile.py --log console.log --target <kit>
+                                                         calibrate with a
+                                                         measured profile
+"""
+
+import argparse
+import os
+import re
+import sys
+
+from cycfg_gen import IMO_HZ, clock_tree, defines
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir)
+DESIGNS = {"custom": "COMPONENT_CUSTOM_DESIGN_MODUS", "ulp": "COMPONENT_ULP_DESIGN_MODUS"}
+
+STAGES = ("system", "clocks", "routing", "pins")
+
+# Default costs. Cycles are CPU cycles of the PDL calls, the waits are in us.
+MODEL = {
+    "system_cycles": 6000,     # register setup of init_cycfg_system() on the IMO
+    "divider_cycles": 80,      # disable, set and enable of a peripheral divider
+    "pin_cycles": 150,         # Cy_GPIO_Pin_Init() of one pin
+    "reserve_cycles": 120,     # cyhal_hwmgr_reserve() of one resource
+    "wco_us": 500000,          # WCO crystal startup
+    "fll_us": 15,              # FLL lock
+}
+CLKLF_DELAY_US = 200           # Cy_SysLib_DelayUs() after a CLKLF switch without ILO
+
+PROFILE = re.compile(r"Boot profile: (.*)$")
+FIELD = re.compile(r"(init_cycfg_all|system|WCO wait|FLL wait|clocks|routing|pins) (\d+) us")
+
+
+def read(design, target, name):
+    """Reads a generated source of a design. The ULP design only overrides
+    the system files and takes the others from the custom design."""
+    path = os.path.join(ROOT, design, target, "GeneratedSource", name)
+    if not os.path.exists(path):
+        path = os.path.join(ROOT, DESIGNS["custom"], target, "GeneratedSource", name)
+    if not os.path.exists(path):
+        return ""
+    with open(path) as f:
+        return f.read()
+
+
+def function_body(text, name):
+    m = re.search(r"^void %s\(void\)\n\{\n(.*?)^\}" % name, text, re.S | re.M)
+    return m.group(1) if m else ""
+
+
+def workload(design, target):
+    """Counts the work of each stage of a kit."""
+    defs = defines(read(design, target, "cycfg_system.c"))
+    hdefs = defines(read(design, target, "cycfg_system.h"))
+    pins = function_body(read(design, target, "cycfg_pins.c"), "init_cycfg_pins")
+    clocks = function_body(read(design, target, "cycfg_clocks.c"), "init_cycfg_clocks")
+    tree = clock_tree(defs)
+    return {
+        "cpu_hz": tree["fast"],
+        "wco": (defs.get("CY_CFG_SYSCLK_WCO_ENABLED") == "1" and
+                hdefs.get("CY_CFG_SYSCLK_WCO_DEFERRED") != "1"),
+        "fll": defs.get("CY_CFG_SYSCLK_FLL_ENABLED") == "1",
+        "clklf_delay": (defs.get("CY_CFG_SYSCLK_ILO_ENABLED") != "1" and
+                        defs.get("CY_CFG_SYSCLK_CLKLF_ENABLED") == "1"),
+        "pins": pins.count("Cy_GPIO_Pin_Init("),
+        "pin_reserves": pins.count("cyhal_hwmgr_reserve("),
+        "dividers": clocks.count("Cy_SysClk_PeriphEnableDivider("),
+        "divider_reserves": clocks.count("cyhal_hwmgr_reserve("),
+    }
+
+
+def estimate(work, model):
+    """Returns the estimated time in us of each stage and wait."""
+    us_per_cycle = 1e6 / work["cpu_hz"]
+    waits = {
+        "WCO wait": model["wco_us"] if work["wco"] else 0,
+        "FLL wait": model["fll_us"] if work["fll"] else 0,
+    }
+    system = model["system_cycles"] * 1e6 / IMO_HZ + sum(waits.values())
+    if work["clklf_delay"]:
+        system += CLKLF_DELAY_US
+    result = {
+        "system": system,
+        "clocks": (work["dividers"] * model["divider_cycles"] +
+                   work["divider_reserves"] * model["reserve_cycles"]) * us_per_cycle,
+        "routing": 0,
+        "pins": (work["pins"] * model["pin_cycles"] +
+                 work["pin_reserves"] * model["reserve_cycles"]) * us_per_cycle,
+    }
+    result.update(waits)
+    result["init_cycfg_all"] = sum(result[s] for s in STAGES)
+    return result
+
+
+def parse_log(path):
+    """Returns the last boot profile printed in a console log."""
+    measured = {}
+    with open(path, errors="replace") as f:
+        for line in f:
+            m = PROFILE.search(line)
+            if not m:
+                continue
+            fields = dict((k, int(v)) for k, v in FIELD.findall(m.group(1)))
+            if "init_cycfg_all" in fields:
+                measured = {}
+            measured.update(fields)
+    return measured
+
+
+def calibrate(model, work, measured):
+    """Derives the cost constants from a measured profile of a kit."""
+    model = dict(model)
+    cycles_per_us = work["cpu_hz"] / 1e6
+    if work["wco"] and "WCO wait" in measured:
+        model["wco_us"] = measured["WCO wait"]
+    if work["fll"] and "FLL wait" in measured:
+        model["fll_us"] = measured["FLL wait"]
+    if "system" in measured:
+        rest = measured["system"] - measured.get("WCO wait", 0) - measured.get("FLL wait", 0)
+        if work["clklf_delay"]:
+            rest -= CLKLF_DELAY_US
+        model["system_cycles"] = max(0, int(rest * IMO_HZ / 1e6))
+    # Reservations are attributed the pin cost ratio of the defaults.
+    units = work["pins"] * MODEL["pin_cycles"] + work["pin_reserves"] * MODEL["reserve_cycles"]
+    if "pins" in measured and units:
+        scale = measured["pins"] * cycles_per_us / units
+        model["pin_cycles"] = int(MODEL["pin_cycles"] * scale)
+        model["reserve_cycles"] = int(MODEL["reserve_cycles"] * scale)
+    if "clocks" in measured and work["dividers"]:
+        rest = measured["clocks"] * cycles_per_us - work["divider_reserves"] * model["reserve_cycles"]
+        model["divider_cycles"] = max(0, int(rest / work["dividers"]))
+    return model
+
+
+def targets(design):
+    return sorted(t for t in os.listdir(os.path.join(ROOT, design)) if t.startswith("TARGET_"))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--design", choices=sorted(DESIGNS), default="custom",
+                        help="designs to estimate")
+    parser.add_argument("--log", help="console output of a boot profile build")
+    parser.add_argument("--target", help="kit the log was captured on")
+    options = parser.parse_args()
+    design = DESIGNS[options.design]
+
+    model = dict(MODEL)
+    measured = {}
+    if options.log:
+        if not options.target:
+            parser.error("--log requires --target")
+        target = options.target if options.target.startswith("TARGET_") else "TARGET_" + options.target
+        measured = parse_log(options.log)
+        if not measured:
+            print("%s: no boot profile found" % options.log)
+            return 1
+        model = calibrate(model, workload(DESIGNS["custom"], target), measured)
+        print("Calibrated on %s: %s" % (target, ", ".join(
+            "%s %d" % (k, v) for k, v in sorted(model.items()))))
+        print()
+
+    columns = STAGES + ("WCO wait", "FLL wait", "init_cycfg_all")
+    print("%-30s %s" % ("us", " ".join("%14s" % c for c in columns)))
+    for target in targets(design):
+        est = estimate(workload(design, target), model)
+        print("%-30s %s" % (target, " ".join("%14.1f" % est[c] for c in columns)))
+        if options.log and target.endswith(options.target.replace("TARGET_", "")) \
+                and design == DESIGNS["custom"]:
+            print("%-30s %s" % ("  measured", " ".join(
+                "%14s" % measured.get(c, "-") for c in columns)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
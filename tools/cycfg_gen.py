@@ -0,0 +1,861 @@
+#!/usr/bin/env python3
+"""
+Applies the declarative power, clock, QSPI and offload description of
+COMPONENT_CUSTOM_DESIGN_MODUS/boards.json to the generated sources of every
+kit, and checks that the committed sources match it.
+
+The description holds default settings and per-kit overrides:
+
+    power   mode (LP, ULP), regulator (buck, ldo), regulator_min_current,
+            pmic, idle_mode (DEEPSLEEP, SLEEP, ACTIVE), deepsleep_latency,
+            vdd_mv
+    clocks  fll_hz, hf (CLK_HF root: path, divider), fast_div, peri_div,
+            slow_div, clklf (WCO, ILO), clkbak (WCO, CLKLF),
+            wco_startup (boot, deferred)
+    qspi    read command of the memory: command, mode, addr_width,
+            mode_width, data_width, dummy_cycles
+    offloads
+            packet_filters: feature (iptype, ethtype, port), value,
+            direction (port only), sleep, wake, action (keep, discard)
+    lazy    blocks configured on their first claim instead of at boot
+            (capsense, swo), see source/app_lazy_init.h
+
+The Device Configurator remains the owner of the structure of the sources,
+such as which blocks are enabled. This tool owns the values above:
+cycfg_connectivity_wifi.c is generated completely, cycfg_system.c/.h,
+cycfg_qspi_memslot.c, cycfg_pins.c/.h and cycfg_clocks.c/.h are rewritten
+in place. The ULP designs are
+regenerated afterwards, see tools/ulp_design.py.
+
+The Device Configurator regenerates all sources from design.modus when the
+design is saved, which undoes this tool. The settings which design.modus
+also holds must therefore match boards.json, --check fails when they drift.
+
+Usage:
+    python tools/cycfg_gen.py            apply boards.json to the sources
+    python tools/cycfg_gen.py --check    report every setting of the
+                                         sources or of design.modus
+                                         which differs from boards.json
+"""
+
+import argparse
+import copy
+import json
+import math
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir)
+DESIGN = "COMPONENT_CUSTOM_DESIGN_MODUS"
+DESCRIPTION = os.path.join(DESIGN, "boards.json")
+
+MHZ = 1000000
+IMO_HZ = 8 * MHZ
+
+# Maximum frequencies in MHz per power mode, from the PSoC 6 datasheets.
+LIMITS = {
+    "LP":  {"fll": 100, "hf": 150, "fast": 150, "peri": 100, "slow": 100},
+    "ULP": {"fll": 50, "hf": 50, "fast": 50, "peri": 25, "slow": 25},
+}
+
+# FLL CCO ranges as in Cy_SysClk_FllConfigure(): lower bound of each range
+# in Hz, trim step (scaled by 1e8) and margin frequency.
+CCO_MIN_HZ = 48000000
+CCO_MAX_HZ = 200000000
+CCO_RANGE_MIN = (0, 63855600, 84948700, 113009380, 150339200)
+CCO_TRIM_STEPS = (110340, 110200, 110000, 110000, 117062)
+CCO_MARGIN = (43600000, 58100000, 77200000, 103000000, 132000000)
+FLL_GAINS = (1 / 256, 1 / 128, 1 / 64, 1 / 32, 1 / 16, 1 / 8,
+             1 / 4, 1 / 2, 1, 2, 4, 8)
+
+HF_DIVIDERS = {
+    "CY_SYSCLK_CLKHF_NO_DIVIDE": 1,
+    "CY_SYSCLK_CLKHF_DIVIDE_BY_2": 2,
+    "CY_SYSCLK_CLKHF_DIVIDE_BY_4": 4,
+    "CY_SYSCLK_CLKHF_DIVIDE_BY_8": 8,
+}
+HF_DIVIDER_NAMES = {v: k for k, v in HF_DIVIDERS.items()}
+
+VDD_RAILS = ("VDDA", "VDDD", "VBACKUP", "VDD_NS", "VDDIO0", "VDDIO1")
+
+DEFINE = re.compile(r"^#define (CY_CFG_\w+) (.+?)\s*$", re.M)
+
+
+def defines(text):
+    return dict(DEFINE.findall(text))
+
+
+def number(value):
+    return int(value.rstrip("UL"), 0)
+
+
+def set_define(text, name, value):
+    return re.sub(r"^(#define %s ).*$" % name, lambda m: m.group(1) + value, text, flags=re.M)
+
+
+def set_divider(text, clock, value):
+    text = set_define(text, "CY_CFG_SYSCLK_CLK%s_DIVIDER" % clock.upper(), str(value))
+    return re.sub(r"(Cy_SysClk_Clk%sInit\(\)\s*\{\s*Cy_SysClk_Clk%sSetDivider\()\d+U" % (clock, clock),
+                  lambda m: m.group(1) + "%dU" % value, text)
+
+
+def fll_config(out_hz):
+    """FLL parameters for an 8 MHz IMO reference, see Cy_SysClk_FllConfigure()."""
+    cco_hz = out_hz * 2
+    cco_range = max(i for i, low in enumerate(CCO_RANGE_MIN) if cco_hz >= low)
+    ref_div = -(-IMO_HZ * 250 // out_hz)
+    mult = -(-cco_hz * ref_div // IMO_HZ)
+    lock_tol = -(-mult * 2 // 100)
+    step = CCO_TRIM_STEPS[cco_range] / 1e8
+    kcco = step * CCO_MARGIN[cco_range]
+    ki_p = 0.85 * (IMO_HZ / ref_div) / kcco
+    igain = max([i for i, g in enumerate(FLL_GAINS) if g <= ki_p] or [0])
+    pgain = max([i for i, g in enumerate(FLL_GAINS) if g <= ki_p - FLL_GAINS[igain]] or [0])
+    cco_freq = int(round(math.log(cco_hz / CCO_MARGIN[cco_range]) / math.log(1 + step)))
+    return {
+        "MULT": mult, "REFDIV": ref_div, "CCO_RANGE": cco_range,
+        "LOCK_TOLERANCE": lock_tol, "IGAIN": igain, "PGAIN": pgain,
+        "CCO_FREQ": cco_freq,
+    }
+
+
+def set_fll(text, out_hz):
+    """Retunes the FLL of a cycfg_system.c to the given output frequency."""
+    fll = fll_config(out_hz)
+    for key in ("MULT", "REFDIV", "LOCK_TOLERANCE", "IGAIN", "PGAIN", "CCO_FREQ"):
+        text = set_define(text, "CY_CFG_SYSCLK_FLL_" + key, "%dU" % fll[key])
+    text = set_define(text, "CY_CFG_SYSCLK_FLL_CCO_RANGE",
+                      "CY_SYSCLK_FLL_CCO_RANGE%d" % fll["CCO_RANGE"])
+    text = set_define(text, "CY_CFG_SYSCLK_FLL_OUT_FREQ", str(out_hz))
+    fields = {"fllMult": fll["MULT"], "refDiv": fll["REFDIV"],
+              "lockTolerance": fll["LOCK_TOLERANCE"], "igain": fll["IGAIN"],
+              "pgain": fll["PGAIN"], "cco_Freq": fll["CCO_FREQ"]}
+    for field, value in fields.items():
+        text = re.sub(r"(\t\t\.%s = )\d+U," % field,
+                      lambda m, v=value: m.group(1) + "%dU," % v, text)
+    return re.sub(r"(\t\t\.ccoRange = )CY_SYSCLK_FLL_CCO_RANGE\d",
+                  lambda m: m.group(1) + "CY_SYSCLK_FLL_CCO_RANGE%d" % fll["CCO_RANGE"], text)
+
+
+def set_hf_freqs(text):
+    """Updates the FREQ_MHZ macros of the CLK_HF roots from the clock tree."""
+    for n, hz in clock_tree(defines(text))["hf"].items():
+        text = set_define(text, "CY_CFG_SYSCLK_CLKHF%d_FREQ_MHZ" % n, "%dUL" % (hz // MHZ))
+    return text
+
+
+def set_power_mode(text, mode):
+    """Selects the core voltage of the LP or ULP power mode in cycfg_system.c."""
+    ulp = mode == "ULP"
+    text = set_define(text, "CY_CFG_PWR_BUCK_VOLTAGE", "CY_SYSPM_BUCK_OUT1_VOLTAGE_" + mode)
+    text = set_define(text, "CY_CFG_PWR_USING_ULP", "1" if ulp else "0")
+    text = re.sub(r"Cy_SysPm_BuckEnable\(CY_SYSPM_BUCK_OUT1_VOLTAGE_U?LP\);",
+                  "Cy_SysPm_BuckEnable(CY_SYSPM_BUCK_OUT1_VOLTAGE_%s);" % mode, text)
+    return re.sub(r"Cy_SysPm_LdoSetVoltage\(CY_SYSPM_LDO_VOLTAGE_U?LP\);",
+                  "Cy_SysPm_LdoSetVoltage(CY_SYSPM_LDO_VOLTAGE_%s);" % mode, text)
+
+
+def clock_tree(defs):
+    """Computes the frequencies in Hz of the clocks of a system configuration."""
+    paths = {}
+    for n in range(16):
+        src = defs.get("CY_CFG_SYSCLK_CLKPATH%d_SOURCE" % n)
+        if src is None:
+            continue
+        if src != "CY_SYSCLK_CLKPATH_IN_IMO":
+            raise ValueError("path %d: unsupported source %s" % (n, src))
+        paths[n] = IMO_HZ
+    cco_hz = fll_hz = None
+    if defs.get("CY_CFG_SYSCLK_FLL_ENABLED") == "1":
+        ref = IMO_HZ / number(defs["CY_CFG_SYSCLK_FLL_REFDIV"])
+        cco_hz = ref * number(defs["CY_CFG_SYSCLK_FLL_MULT"])
+        div = 2 if defs["CY_CFG_SYSCLK_FLL_ENABLE_OUTDIV"] == "true" else 1
+        fll_hz = cco_hz / div
+        paths[0] = fll_hz
+    if any(k.startswith("CY_CFG_SYSCLK_PLL") and k.endswith("_ENABLED") for k in defs):
+        raise ValueError("PLL designs are not supported")
+
+    tree = {"fll": fll_hz, "cco": cco_hz, "hf": {}}
+    for n in range(6):
+        if defs.get("CY_CFG_SYSCLK_CLKHF%d_ENABLED" % n) != "1":
+            continue
+        path = int(defs["CY_CFG_SYSCLK_CLKHF%d_CLKPATH" % n].rsplit("CLKPATH", 1)[1])
+        tree["hf"][n] = paths[path] / HF_DIVIDERS[defs["CY_CFG_SYSCLK_CLKHF%d_DIVIDER" % n]]
+    hf0 = tree["hf"][0]
+    tree["fast"] = hf0 / (number(defs.get("CY_CFG_SYSCLK_CLKFAST_DIVIDER", "0")) + 1)
+    tree["peri"] = hf0 / (number(defs.get("CY_CFG_SYSCLK_CLKPERI_DIVIDER", "0")) + 1)
+    tree["slow"] = tree["peri"] / (number(defs.get("CY_CFG_SYSCLK_CLKSLOW_DIVIDER", "0")) + 1)
+    return tree
+
+
+def validate(name, text):
+    """Returns the list of clock tree errors of a cycfg_system.c."""
+    defs = defines(text)
+    mode = "ULP" if defs.get("CY_CFG_PWR_USING_ULP") == "1" else "LP"
+    limit = LIMITS[mode]
+    errors = []
+    try:
+        tree = clock_tree(defs)
+    except (KeyError, ValueError) as err:
+        return ["%s: %s" % (name, err)]
+
+    def check(clock, hz, max_mhz):
+        if hz > max_mhz * MHZ:
+            errors.append("%s: %s %.3f MHz exceeds %d MHz in %s mode"
+                          % (name, clock, hz / MHZ, max_mhz, mode))
+
+    if tree["fll"] is not None:
+        check("FLL", tree["fll"], limit["fll"])
+        cco = tree["cco"]
+        if not CCO_MIN_HZ <= cco <= CCO_MAX_HZ:
+            errors.append("%s: CCO %.3f MHz out of range" % (name, cco / MHZ))
+        else:
+            cco_range = max(i for i, low in enumerate(CCO_RANGE_MIN) if cco >= low)
+            if defs["CY_CFG_SYSCLK_FLL_CCO_RANGE"] != "CY_SYSCLK_FLL_CCO_RANGE%d" % cco_range:
+                errors.append("%s: CCO %.3f MHz requires CY_SYSCLK_FLL_CCO_RANGE%d"
+                              % (name, cco / MHZ, cco_range))
+        if number(defs["CY_CFG_SYSCLK_FLL_OUT_FREQ"]) != tree["fll"]:
+            errors.append("%s: CY_CFG_SYSCLK_FLL_OUT_FREQ does not match %.3f MHz"
+                          % (name, tree["fll"] / MHZ))
+    for n, hz in sorted(tree["hf"].items()):
+        check("CLK_HF%d" % n, hz, limit["hf"])
+        if number(defs["CY_CFG_SYSCLK_CLKHF%d_FREQ_MHZ" % n]) != int(hz // MHZ):
+            errors.append("%s: CY_CFG_SYSCLK_CLKHF%d_FREQ_MHZ does not match %.3f MHz"
+                          % (name, n, hz / MHZ))
+    check("CLK_FAST", tree["fast"], limit["fast"])
+    check("CLK_PERI", tree["peri"], limit["peri"])
+    check("CLK_SLOW", tree["slow"], limit["slow"])
+    if mode == "ULP" and defs.get("CY_CFG_PWR_BUCK_VOLTAGE") != "CY_SYSPM_BUCK_OUT1_VOLTAGE_ULP":
+        errors.append("%s: ULP mode requires CY_SYSPM_BUCK_OUT1_VOLTAGE_ULP" % name)
+    return errors
+
+
+# ---------------------------------------------------------------------------
+# Description
+# ---------------------------------------------------------------------------
+
+def merge(base, override):
+    """Merges per-kit overrides into the defaults. Lists are replaced."""
+    result = copy.deepcopy(base)
+    for key, value in override.items():
+        if isinstance(value, dict) and isinstance(result.get(key), dict):
+            result[key] = merge(result[key], value)
+        else:
+            result[key] = copy.deepcopy(value)
+    return result
+
+
+def load_description():
+    with open(os.path.join(ROOT, DESCRIPTION)) as f:
+        desc = json.load(f)
+    return {target: merge(desc["defaults"], override)
+            for target, override in desc["boards"].items()}
+
+
+def flatten(settings, prefix=""):
+    """Flattens nested settings into dotted keys for reporting."""
+    flat = {}
+    for key, value in settings.items():
+        if isinstance(value, dict):
+            flat.update(flatten(value, prefix + key + "."))
+        else:
+            flat[prefix + key] = value
+    return flat
+
+
+# ---------------------------------------------------------------------------
+# cycfg_system.c/.h
+# ---------------------------------------------------------------------------
+
+def read_system(sys_c, sys_h):
+    defs = defines(sys_c)
+    hdefs = defines(sys_h)
+    hf = {}
+    for n in range(6):
+        if defs.get("CY_CFG_SYSCLK_CLKHF%d_ENABLED" % n) == "1":
+            hf[str(n)] = {
+                "path": int(defs["CY_CFG_SYSCLK_CLKHF%d_CLKPATH" % n].rsplit("CLKPATH", 1)[1]),
+                "divider": HF_DIVIDERS[defs["CY_CFG_SYSCLK_CLKHF%d_DIVIDER" % n]],
+            }
+    return {
+        "power": {
+            "mode": "ULP" if defs["CY_CFG_PWR_USING_ULP"] == "1" else "LP",
+            "regulator": "ldo" if hdefs["CY_CFG_PWR_USING_LDO"] == "1" else "buck",
+            "regulator_min_current": defs["CY_CFG_PWR_REGULATOR_MODE_MIN"] == "true",
+            "pmic": defs["CY_CFG_PWR_USING_PMIC"] == "1",
+            "idle_mode": hdefs["CY_CFG_PWR_SYS_IDLE_MODE"].rsplit("_", 1)[1],
+            "deepsleep_latency": number(hdefs["CY_CFG_PWR_DEEPSLEEP_LATENCY"]),
+            "vdd_mv": number(hdefs["CY_CFG_PWR_VDDD_MV"]),
+        },
+        "clocks": {
+            "fll_hz": number(defs["CY_CFG_SYSCLK_FLL_OUT_FREQ"]),
+            "hf": hf,
+            "fast_div": number(defs["CY_CFG_SYSCLK_CLKFAST_DIVIDER"]),
+            "peri_div": number(defs["CY_CFG_SYSCLK_CLKPERI_DIVIDER"]),
+            "slow_div": number(defs["CY_CFG_SYSCLK_CLKSLOW_DIVIDER"]),
+            "clklf": hdefs["CY_CFG_SYSCLK_CLKLF_SOURCE"].rsplit("_", 1)[1],
+            "clkbak": defs["CY_CFG_SYSCLK_CLKBAK_SOURCE"].rsplit("_", 1)[1],
+            "wco_startup": "deferred" if hdefs.get("CY_CFG_SYSCLK_WCO_DEFERRED") == "1" else "boot",
+        },
+    }
+
+
+def apply_system(sys_c, sys_h, power, clocks):
+    defs = defines(sys_c)
+    enabled = sorted(str(n) for n in range(6)
+                     if defs.get("CY_CFG_SYSCLK_CLKHF%d_ENABLED" % n) == "1")
+    if enabled != sorted(clocks["hf"]):
+        raise ValueError("CLK_HF roots %s are enabled in design.modus, boards.json lists %s"
+                         % (", ".join(enabled), ", ".join(sorted(clocks["hf"]))))
+    for clock in ("clklf", "clkbak"):
+        if clocks[clock] == "WCO" and defs.get("CY_CFG_SYSCLK_WCO_ENABLED") != "1":
+            raise ValueError("%s uses the WCO, which is disabled in design.modus" % clock)
+
+    sys_c = set_power_mode(sys_c, power["mode"])
+    sys_c = set_define(sys_c, "CY_CFG_PWR_REGULATOR_MODE_MIN",
+                       "true" if power["regulator_min_current"] else "false")
+    sys_c = set_define(sys_c, "CY_CFG_PWR_USING_PMIC", "1" if power["pmic"] else "0")
+    sys_h = set_define(sys_h, "CY_CFG_PWR_USING_LDO", "1" if power["regulator"] == "ldo" else "0")
+    sys_h = set_define(sys_h, "CY_CFG_PWR_SYS_ACTIVE_MODE", "CY_CFG_PWR_MODE_" + power["mode"])
+    sys_h = set_define(sys_h, "CY_CFG_PWR_SYS_IDLE_MODE", "CY_CFG_PWR_MODE_" + power["idle_mode"])
+    sys_h = set_define(sys_h, "CY_CFG_PWR_DEEPSLEEP_LATENCY", "%dUL" % power["deepsleep_latency"])
+    for rail in VDD_RAILS:
+        sys_h = set_define(sys_h, "CY_CFG_PWR_%s_MV" % rail, str(power["vdd_mv"]))
+
+    sys_c = set_fll(sys_c, clocks["fll_hz"])
+    for n, hf in clocks["hf"].items():
+        path = "CY_SYSCLK_CLKHF_IN_CLKPATH%d" % hf["path"]
+        divider = HF_DIVIDER_NAMES[hf["divider"]]
+        sys_c = set_define(sys_c, "CY_CFG_SYSCLK_CLKHF%s_CLKPATH" % n, path)
+        sys_c = set_define(sys_c, "CY_CFG_SYSCLK_CLKHF%s_DIVIDER" % n, divider)
+        sys_c = re.sub(r"(Cy_SysClk_ClkHf%sInit\(\)\s*\{.*?Cy_SysClk_ClkHfSetDivider\(\w+, )\w+\)" % n,
+                       lambda m: m.group(1) + divider + ")", sys_c, flags=re.S)
+        sys_h = set_define(sys_h, "CY_CFG_SYSCLK_CLKHF%s_CLKPATH_NUM" % n, "%dUL" % hf["path"])
+    sys_c = set_hf_freqs(sys_c)
+    sys_c = set_divider(sys_c, "Fast", clocks["fast_div"])
+    sys_c = set_divider(sys_c, "Peri", clocks["peri_div"])
+    sys_c = set_divider(sys_c, "Slow", clocks["slow_div"])
+
+    sys_c, sys_h = apply_wco_startup(sys_c, sys_h, clocks["wco_startup"])
+    boot_clklf = clocks["clklf"]
+    if clocks["wco_startup"] == "deferred" and boot_clklf == "WCO":
+        boot_clklf = "ILO"
+    sys_h = set_define(sys_h, "CY_CFG_SYSCLK_CLKLF_SOURCE", "CY_SYSCLK_CLKLF_IN_" + clocks["clklf"])
+    sys_c = re.sub(r"Cy_SysClk_ClkLfSetSource\(CY_SYSCLK_CLKLF_IN_\w+\);",
+                   "Cy_SysClk_ClkLfSetSource(CY_SYSCLK_CLKLF_IN_%s);" % boot_clklf, sys_c)
+    sys_c = set_define(sys_c, "CY_CFG_SYSCLK_CLKBAK_SOURCE", "CY_SYSCLK_BAK_IN_" + clocks["clkbak"])
+    sys_c = re.sub(r"Cy_SysClk_ClkBakSetSource\(CY_SYSCLK_BAK_IN_\w+\);",
+                   "Cy_SysClk_ClkBakSetSource(CY_SYSCLK_BAK_IN_%s);" % clocks["clkbak"], sys_c)
+    return sys_c, sys_h
+
+
+WCO_WAIT = ("if (CY_SYSCLK_SUCCESS != Cy_SysClk_WcoEnable(1000000UL))\n"
+            "\t    {\n"
+            "\t        cycfg_ClockStartupError(CY_CFG_SYSCLK_WCO_ERROR);\n"
+            "\t    }")
+WCO_NO_WAIT = "(void)Cy_SysClk_WcoEnable(0UL);"
+WCO_DEFERRED = "#define CY_CFG_SYSCLK_WCO_DEFERRED 1\n"
+
+
+def apply_wco_startup(sys_c, sys_h, startup):
+    """With a deferred startup, Cy_SysClk_WcoInit() starts the WCO without
+    waiting for it and CLK_LF boots from the ILO. source/app_wco.cpp moves
+    CLK_LF to the WCO once it is stable.
+    """
+    defs = defines(sys_c)
+    sys_c = sys_c.replace(WCO_NO_WAIT, WCO_WAIT)
+    sys_h = sys_h.replace(WCO_DEFERRED, "")
+    if startup == "boot":
+        return sys_c, sys_h
+    if defs.get("CY_CFG_SYSCLK_WCO_ENABLED") != "1" or defs.get("CY_CFG_SYSCLK_ILO_ENABLED") != "1":
+        raise ValueError("a deferred WCO startup needs the WCO and the ILO enabled in design.modus")
+    sys_c = sys_c.replace(WCO_WAIT, WCO_NO_WAIT)
+    return sys_c, re.sub(r"^(#define CY_CFG_SYSCLK_CLKLF_SOURCE .*\n)",
+                         lambda m: m.group(1) + WCO_DEFERRED, sys_h, count=1, flags=re.M)
+
+
+# ---------------------------------------------------------------------------
+# cycfg_qspi_memslot.c
+# ---------------------------------------------------------------------------
+
+QSPI_READ = re.compile(r"(SlaveSlot_0_readCmd =\s*\{)(.*?)(\};)", re.S)
+QSPI_FIELDS = {
+    "command": "command", "mode": "mode", "addr_width": "addrWidth",
+    "mode_width": "modeWidth", "data_width": "dataWidth", "dummy_cycles": "dummyCycles",
+}
+
+
+def read_qspi(text):
+    body = QSPI_READ.search(text).group(2)
+    fields = dict(re.findall(r"\.(\w+) = (\w+)", body))
+    read = {}
+    for key, field in QSPI_FIELDS.items():
+        value = fields[field]
+        if value.startswith("CY_SMIF_WIDTH_"):
+            read[key] = value[len("CY_SMIF_WIDTH_"):]
+        elif key == "dummy_cycles":
+            read[key] = number(value)
+        else:
+            read[key] = "0x%02X" % number(value)
+    return {"read": read}
+
+
+def apply_qspi(text, qspi):
+    def rewrite(m):
+        body = m.group(2)
+        for key, field in QSPI_FIELDS.items():
+            value = qspi["read"][key]
+            if key.endswith("_width"):
+                value = "CY_SMIF_WIDTH_" + value
+            elif key == "dummy_cycles":
+                value = "%dU" % value
+            else:
+                value = "0x%02XU" % int(value, 16)
+            body = re.sub(r"(\.%s = )\w+" % field, lambda f, v=value: f.group(1) + v, body)
+        return m.group(1) + body + m.group(3)
+    return QSPI_READ.sub(rewrite, text, count=1)
+
+
+# ---------------------------------------------------------------------------
+# cycfg_connectivity_wifi.c
+# ---------------------------------------------------------------------------
+
+WIFI_HEADER = """/*******************************************************************************
+* File Name: cycfg_connectivity_wifi.c
+*
+* Description:
+* Connectivity Wi-Fi configuration
+* This file was automatically generated and should not be modified.
+* Tools Package 2.1.0.1266
+* psoc6pdl 1.6.1.4886
+* personalities_2.0 2.0.0.0
+* udd 1.2.0.473
+*
+********************************************************************************
+* Copyright 2020 Cypress Semiconductor Corporation
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+********************************************************************************/
+
+#include "cycfg_connectivity_wifi.h"
+
+"""
+
+PF_FEATURES = {"iptype": "CY_PF_OL_FEAT_IPTYPE", "ethtype": "CY_PF_OL_FEAT_ETHTYPE",
+               "port": "CY_PF_OL_FEAT_PORTNUM"}
+PF_DIRECTIONS = {"dst": "PF_PN_PORT_DEST", "src": "PF_PN_PORT_SOURCE"}
+
+
+def pf_entry(index, flt):
+    bits = []
+    if flt["sleep"]:
+        bits.append("CY_PF_ACTIVE_SLEEP")
+    if flt["wake"]:
+        bits.append("CY_PF_ACTIVE_WAKE")
+    bits.append("CY_PF_ACTION_DISCARD" if flt["action"] == "discard" else "CY_PF_ACTION_KEEP")
+    if flt["feature"] == "iptype":
+        union = ["\t\t\t\t.ip = {", "\t\t\t\t\t\t.ip_type = %du," % flt["value"], "\t\t\t\t\t\t},"]
+    elif flt["feature"] == "ethtype":
+        union = ["\t\t\t\t.eth = {", "\t\t\t\t\t\t.eth_type = 0x%04xu," % flt["value"], "\t\t\t\t\t\t},"]
+    else:
+        union = ["\t\t\t\t.port = {", "\t\t\t\t\t\t.portnum = %du," % flt["value"],
+                 "\t\t\t\t\t\t.range = 0u,",
+                 "\t\t\t\t\t\t.direction = %s," % PF_DIRECTIONS[flt.get("direction", "dst")],
+                 "\t\t\t\t\t\t},"]
+    return "\n".join(["\t[%du] = {.feature = %s," % (index, PF_FEATURES[flt["feature"]]),
+                      "\t\t\t.bits = %s," % " | ".join(bits),
+                      "\t\t\t.id = %du," % index,
+                      "\t\t\t.u = {"] + union + ["\t\t\t\t},", "\t\t\t},"])
+
+
+def gen_wifi(offloads):
+    filters = offloads["packet_filters"]
+    lines = [WIFI_HEADER.rstrip("\n"), ""]
+    entries = []
+    if filters:
+        lines += ["#define CYCFG_PF_OL_ENABLED (1u)", "",
+                  "static pf_ol_t pf_ol_0;",
+                  "static const cy_pf_ol_cfg_t cy_pf_ol_cfg_0[] = ", "{"]
+        lines += [pf_entry(i, f) for i, f in enumerate(filters)]
+        lines += ["\t[%du] = {.feature = CY_PF_OL_FEAT_LAST}," % len(filters), "};"]
+        entries.append('\t[0u] = {"Pkt_Filter", &cy_pf_ol_cfg_0, &pf_ol_fns, &pf_ol_0},')
+    lines += ["static const ol_desc_t ol_list_0[] = ", "{"] + entries
+    lines += ["\t[%du] = {NULL, NULL, NULL, NULL}," % (len(entries) + 1), "};", "",
+              "const ol_desc_t *cycfg_get_default_ol_list(void)", "{",
+              "\treturn &ol_list_0[0];", "}", "", ""]
+    return "\n".join(lines)
+
+
+def read_wifi(text):
+    filters = []
+    for m in re.finditer(r"\.feature = CY_PF_OL_FEAT_(\w+),\s*\.bits = ([^,]+),(.*?)\n\t\t\t\},",
+                         text, re.S):
+        feature = {v: k for k, v in PF_FEATURES.items()}.get("CY_PF_OL_FEAT_" + m.group(1))
+        bits = m.group(2)
+        value = re.search(r"\.(?:ip_type|eth_type|portnum) = (\w+?)u?,", m.group(3)).group(1)
+        flt = {"feature": feature, "value": int(value, 0),
+               "sleep": "CY_PF_ACTIVE_SLEEP" in bits, "wake": "CY_PF_ACTIVE_WAKE" in bits,
+               "action": "discard" if "CY_PF_ACTION_DISCARD" in bits else "keep"}
+        if feature == "port":
+            flt["direction"] = "src" if "PF_PN_PORT_SOURCE" in m.group(3) else "dst"
+        filters.append(flt)
+    return {"packet_filters": filters}
+
+
+# ---------------------------------------------------------------------------
+# cycfg_pins.c/.h, cycfg_clocks.c/.h
+# ---------------------------------------------------------------------------
+
+# Blocks configured on the first claim instead of at boot, by the name of
+# their HAL resource object.
+LAZY_GROUPS = {
+    "capsense": re.compile(r"CSD_\w+|CINA|CINB|CMOD"),
+    "swo": re.compile(r"SWO"),
+}
+LAZY_FILES = (("cycfg_pins.c", "cycfg_pins.h", "pins"),
+              ("cycfg_clocks.c", "cycfg_clocks.h", "clocks"))
+INIT_BLOCK = re.compile(r"\t[^\n]*\n(?:.*?\n)*?#endif //defined \(CY_USING_HAL\)\n?", re.M)
+
+
+def init_function(text, name):
+    """Returns the match of the body of a generated init function."""
+    return re.search(r"^void %s\(void\)\n\{\n(.*?)\}\n" % name, text, re.S | re.M)
+
+
+def init_blocks(body):
+    """Splits an init function into (resource name, block) tuples."""
+    blocks = []
+    for block in INIT_BLOCK.findall(body):
+        name = re.search(r"cyhal_hwmgr_reserve\(&CYBSP_(\w+)_obj\)", block)
+        blocks.append((name.group(1) if name else "", block.rstrip("\n")))
+    return blocks
+
+
+HAL_RESERVE = ("#if defined (CY_USING_HAL)\n\tcyhal_hwmgr_reserve(&CYBSP_%s_obj);\n"
+               "#endif //defined (CY_USING_HAL)")
+LAZY_RESERVE = """#if defined (CY_USING_HAL)
+\tstatic const cyhal_resource_inst_t *const resources[] =
+\t{
+%s
+\t};
+\tfor (uint32_t i = 0u; i < (sizeof(resources) / sizeof(resources[0])); i++)
+\t{
+\t\tcy_rslt_t result = cyhal_hwmgr_reserve(resources[i]);
+\t\tif (CY_RSLT_SUCCESS != result)
+\t\t{
+\t\t\twhile (i-- > 0u)
+\t\t\t{
+\t\t\t\tcyhal_hwmgr_free(resources[i]);
+\t\t\t}
+\t\t\treturn result;
+\t\t}
+\t}
+#endif //defined (CY_USING_HAL)
+"""
+NOTICES = '#include "cycfg_notices.h"\n'
+RESULT = '#include "cy_result.h"\n'
+LAZY_FUNCTION = re.compile(r"^cy_rslt_t (init_cycfg_\w+)\(void\)\n\{\n(.*?)\n\treturn CY_RSLT_SUCCESS;\n\}\n",
+                           re.S | re.M)
+
+
+def lazy_function(text, kind, group):
+    """Returns the match of a generated lazy init function."""
+    for m in LAZY_FUNCTION.finditer(text):
+        if m.group(1) == "init_cycfg_%s_%s" % (kind, group):
+            return m
+    return None
+
+
+def gen_lazy_function(kind, group, blocks):
+    """Builds init_cycfg_<kind>_<group>() from the blocks of the group. All
+    HAL resources are reserved before any register is written: on a
+    conflict the reservations made so far are released, the hardware is
+    left untouched and the error of cyhal_hwmgr_reserve() is returned.
+    """
+    names = []
+    configs = []
+    for name, block in blocks:
+        if not name or not block.endswith("\n" + HAL_RESERVE % name):
+            raise ValueError("init block of %s does not end with its reservation" % (name or "?"))
+        names.append(name)
+        configs.append(block[:-len(HAL_RESERVE % name) - 1])
+    resources = "\n".join("\t\t&CYBSP_%s_obj," % n for n in names)
+    return ("\ncy_rslt_t init_cycfg_%s_%s(void)\n{\n%s%s\n\treturn CY_RSLT_SUCCESS;\n}\n"
+            % (kind, group, LAZY_RESERVE % resources, "\n\n".join(configs)))
+
+
+def lazy_blocks(func):
+    """Splits a generated lazy init function back into (resource name,
+    block) tuples of init_cycfg_<kind>()."""
+    body = func.group(2)
+    end = body.index("#endif //defined (CY_USING_HAL)\n") + len("#endif //defined (CY_USING_HAL)\n")
+    names = re.findall(r"&CYBSP_(\w+)_obj,", body[:end])
+    configs = body[end:].split("\n\n")
+    if len(names) != len(configs):
+        raise ValueError("%s: %d reservations for %d init blocks"
+                         % (func.group(1), len(names), len(configs)))
+    return [(n, c + "\n" + HAL_RESERVE % n) for n, c in zip(names, configs)]
+
+
+def restore_lazy(c_text, h_text, kind):
+    """Moves the blocks of the lazy init functions back into init_cycfg_<kind>()."""
+    moved = []
+    for group in LAZY_GROUPS:
+        func = lazy_function(c_text, kind, group)
+        if func:
+            moved += [block for _, block in lazy_blocks(func)]
+            c_text = c_text[:func.start()].rstrip("\n") + "\n" + c_text[func.end():]
+        h_text = h_text.replace("#define CYCFG_%s_%s_LAZY 1\n" % (kind.upper(), group.upper()), "")
+        h_text = h_text.replace("cy_rslt_t init_cycfg_%s_%s(void);\n" % (kind, group), "")
+    h_text = h_text.replace(NOTICES + RESULT, NOTICES, 1)
+    if moved:
+        main = init_function(c_text, "init_cycfg_" + kind)
+        sep = "\n\n" if kind == "pins" else "\n"
+        body = sep.join([b for _, b in init_blocks(main.group(1))] + moved) + "\n"
+        c_text = c_text[:main.start(1)] + body + c_text[main.end(1):]
+    return c_text, h_text
+
+
+def lazy_applicable(sources, groups):
+    """Lazy groups which have blocks in the sources of a kit."""
+    names = []
+    for c_name, h_name, kind in LAZY_FILES:
+        if c_name in sources:
+            c_text, _ = restore_lazy(sources[c_name], sources[h_name], kind)
+            names += [n for n, _ in init_blocks(init_function(c_text, "init_cycfg_" + kind).group(1))]
+    return [g for g in groups if any(LAZY_GROUPS[g].fullmatch(n) for n in names)]
+
+
+def read_lazy(sources):
+    found = []
+    for c_name, _, kind in LAZY_FILES:
+        if c_name in sources:
+            found += [g for g in LAZY_GROUPS
+                      if lazy_function(sources[c_name], kind, g)]
+    return [g for g in LAZY_GROUPS if g in found]
+
+
+def apply_lazy(c_text, h_text, kind, groups):
+    """Moves the blocks of the lazy groups out of init_cycfg_<kind>() into
+    init_cycfg_<kind>_<group>(), declared in the header with a
+    CYCFG_<KIND>_<GROUP>_LAZY macro, see gen_lazy_function().
+    """
+    c_text, h_text = restore_lazy(c_text, h_text, kind)
+    main = init_function(c_text, "init_cycfg_" + kind)
+    sep = "\n\n" if kind == "pins" else "\n"
+    keep = []
+    lazy = {g: [] for g in groups}
+    for name, block in init_blocks(main.group(1)):
+        group = next((g for g in groups if LAZY_GROUPS[g].fullmatch(name)), None)
+        if group:
+            lazy[group].append((name, block))
+        else:
+            keep.append(block)
+    funcs = ""
+    decls = ""
+    for group in groups:
+        if lazy[group]:
+            funcs += gen_lazy_function(kind, group, lazy[group])
+            decls += "#define CYCFG_%s_%s_LAZY 1\ncy_rslt_t init_cycfg_%s_%s(void);\n" \
+                % (kind.upper(), group.upper(), kind, group)
+    if not funcs:
+        return c_text, h_text
+    body = sep.join(keep) + "\n" if keep else ""
+    c_text = c_text[:main.start(1)] + body + "}\n" + funcs + c_text[main.end():]
+    prototype = "void init_cycfg_%s(void);\n" % kind
+    h_text = h_text.replace(prototype, prototype + decls, 1)
+    h_text = h_text.replace(NOTICES, NOTICES + RESULT, 1)
+    return c_text, h_text
+
+
+# ---------------------------------------------------------------------------
+# design.modus
+# ---------------------------------------------------------------------------
+
+MODUS_BLOCK = re.compile(r'<Block location="([^"]+)">(.*?)</Block>', re.S)
+MODUS_PARAM = re.compile(r'<Param id="(\w+)" value="([^"]*)"/>')
+MODUS_FILTERS = {"CY_PF_PORT_IP_TYPE_FILTER": ("iptype", "ip_type"),
+                 "CY_PF_PORT_ETHER_TYPE_FILTER": ("ethtype", "ether_type"),
+                 "CY_PF_PORT_FILTER": ("port", "port")}
+
+
+def read_modus(text):
+    """Returns the settings of boards.json which design.modus also holds.
+    The FLL frequency is left out when the design computes it, the WCO
+    startup, the lazy blocks and the sleep and wake bits of the filters only
+    exist in boards.json.
+    """
+    blocks = {loc: dict(MODUS_PARAM.findall(body)) for loc, body in MODUS_BLOCK.findall(text)}
+
+    def param(loc, name):
+        return blocks.get("srss[0].clock[0].%s[0]" % loc, {}).get(name)
+
+    pwr = blocks["srss[0].power[0]"]
+    power = {
+        "mode": pwr["actPwrMode"],
+        "regulator": "ldo" if "_LDO_" in pwr["coreRegulator"] else "buck",
+        "regulator_min_current": pwr["coreRegulator"].endswith("_MIN"),
+        "pmic": pwr["pmicEnable"] == "true",
+        "idle_mode": pwr["idlePwrMode"].rsplit("_", 1)[1],
+        "deepsleep_latency": number(pwr["deepsleepLatency"]),
+        "vdd_mv": number(pwr["vdddMv"]),
+    }
+    hf = {}
+    for loc, params in blocks.items():
+        m = re.fullmatch(r"srss\[0\]\.clock\[0\]\.hfclk\[(\d)\]", loc)
+        if m:
+            hf[m.group(1)] = {"path": number(params["sourceClockNumber"]),
+                              "divider": number(params["divider"])}
+    clocks = {
+        "hf": hf,
+        "fast_div": number(param("fastclk", "divider")) - 1,
+        "peri_div": number(param("periclk", "divider")) - 1,
+        "slow_div": number(param("slowclk", "divider")) - 1,
+        "clklf": param("lfclk", "sourceClock").upper(),
+        "clkbak": {"lfclk": "CLKLF"}.get(param("bakclk", "sourceClock"),
+                                         param("bakclk", "sourceClock").upper()),
+    }
+    if param("fll", "configuration") != "auto" and param("fll", "desiredFrequency"):
+        clocks["fll_hz"] = int(round(float(param("fll", "desiredFrequency")) * MHZ))
+    filters = []
+    wifi = blocks.get("wifi[0].power[0]", {})
+    n = 0
+    while "config%d" % n in wifi:
+        key = "filter%d_" % n
+        if wifi["config%d" % n] == "true" and wifi[key + "type"] in MODUS_FILTERS:
+            feature, field = MODUS_FILTERS[wifi[key + "type"]]
+            flt = {"feature": feature, "value": int(wifi[key + field], 0),
+                   "action": "discard" if wifi[key + "action"] == "CY_PF_ACTION_DISCARD"
+                   else "keep"}
+            if feature == "port":
+                flt["direction"] = {v: k for k, v in PF_DIRECTIONS.items()}[wifi[key + "dir"]]
+            filters.append(flt)
+        n += 1
+    return {"power": power, "clocks": clocks, "offloads": {"packet_filters": filters}}
+
+
+def modus_drift(modus, settings):
+    """Returns the settings of design.modus which differ from boards.json.
+    The Device Configurator regenerates the sources from design.modus, so
+    each of them is reverted by the next save in the Configurator.
+    """
+    expected = copy.deepcopy(settings)
+    for flt in expected["offloads"]["packet_filters"]:
+        flt.pop("sleep", None)
+        flt.pop("wake", None)
+    actual, expected = flatten(modus), flatten(expected)
+    return [(key, actual[key], expected.get(key)) for key in sorted(actual)
+            if actual[key] != expected.get(key)]
+
+
+# ---------------------------------------------------------------------------
+# Driver
+# ---------------------------------------------------------------------------
+
+FILES = ("cycfg_system.c", "cycfg_system.h", "cycfg_qspi_memslot.c", "cycfg_connectivity_wifi.c",
+         "cycfg_pins.c", "cycfg_pins.h", "cycfg_clocks.c", "cycfg_clocks.h")
+
+
+def source_path(target, name):
+    return os.path.join(ROOT, DESIGN, target, "GeneratedSource", name)
+
+
+def read_sources(target):
+    sources = {}
+    for name in FILES:
+        if os.path.exists(source_path(target, name)):
+            with open(source_path(target, name)) as f:
+                sources[name] = f.read()
+    return sources
+
+
+def read_settings(sources):
+    settings = read_system(sources["cycfg_system.c"], sources["cycfg_system.h"])
+    settings["qspi"] = read_qspi(sources["cycfg_qspi_memslot.c"])
+    settings["offloads"] = read_wifi(sources["cycfg_connectivity_wifi.c"])
+    settings["lazy"] = read_lazy(sources)
+    return settings
+
+
+def apply(sources, settings):
+    out = dict(sources)
+    out["cycfg_system.c"], out["cycfg_system.h"] = apply_system(
+        sources["cycfg_system.c"], sources["cycfg_system.h"],
+        settings["power"], settings["clocks"])
+    out["cycfg_qspi_memslot.c"] = apply_qspi(sources["cycfg_qspi_memslot.c"], settings["qspi"])
+    out["cycfg_connectivity_wifi.c"] = gen_wifi(settings["offloads"])
+    for c_name, h_name, kind in LAZY_FILES:
+        if c_name in sources:
+            out[c_name], out[h_name] = apply_lazy(sources[c_name], sources[h_name],
+                                                  kind, settings["lazy"])
+    return out
+
+
+def generate(boards):
+    for target, settings in sorted(boards.items()):
+        sources = read_sources(target)
+        for name, text in apply(sources, settings).items():
+            if text != sources[name]:
+                with open(source_path(target, name), "w") as f:
+                    f.write(text)
+                print("%s/%s/GeneratedSource/%s" % (DESIGN, target, name))
+    import ulp_design
+    ulp_design.generate()
+
+
+def check(boards):
+    errors = []
+    for target, settings in sorted(boards.items()):
+        sources = read_sources(target)
+        actual = flatten(read_settings(sources))
+        expected = flatten(dict(settings, lazy=lazy_applicable(sources, settings["lazy"])))
+        for key in sorted(set(actual) | set(expected)):
+            if actual.get(key) != expected.get(key):
+                errors.append("%s: %s is %s, boards.json says %s"
+                              % (target, key, json.dumps(actual.get(key)),
+                                 json.dumps(expected.get(key))))
+        try:
+            for name, text in apply(sources, settings).items():
+                if text != sources[name]:
+                    errors.append("%s: %s differs from boards.json, run tools/cycfg_gen.py"
+                                  % (target, name))
+        except ValueError as err:
+            errors.append("%s: %s" % (target, err))
+        errors += validate(target, sources["cycfg_system.c"])
+        with open(os.path.join(ROOT, DESIGN, target, "design.modus")) as f:
+            modus = read_modus(f.read())
+        for key, value, expected in modus_drift(modus, settings):
+            errors.append("%s: design.modus sets %s to %s, boards.json says %s; the Device "
+                          "Configurator would revert the sources"
+                          % (target, key, json.dumps(value), json.dumps(expected)))
+    for error in errors:
+        print(error)
+    return 1 if errors else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--check", action="store_true",
+                        help="compare the sources with boards.json instead of updating them")
+    args = parser.parse_args()
+    boards = load_description()
+    if args.check:
+        return check(boards)
+    generate(boards)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
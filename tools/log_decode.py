@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""
+Decodes the deferred log records printed by the application when the
+log-binary-output option in mbed_app.json is enabled.
+
+Each record is printed as a single line
+
+    #L:<format string address>[:<argument>]...
+
+where a numeric argument is 8 hex digits and a string argument is 's'
+followed by the hex encoded bytes of the string. The first field is the
+address of the format string, which is read from the application ELF file,
+or with log-tokenized enabled the token of the format string, which is
+looked up in the database written by tools/log_tokens.py. All other lines
+are passed through unchanged.
+
+Usage:
+    python tools/log_decode.py --elf BUILD/<TARGET>/<TOOLCHAIN>/<app>.elf [console.log]
+    python tools/log_decode.py --db BUILD/log_tokens.json [console.log]
+
+Decoding with --elf requires pyelftools (pip install pyelftools).
+"""
+
+import argparse
+import json
+import re
+import sys
+
+RECORD_PREFIX = "#L:"
+
+# printf conversion specification, see C11 7.21.6.1.
+FMT_SPEC = re.compile(
+    r"%(?P<flags>[-+ #0]*)(?P<width>\d+)?(?P<prec>\.\d+)?"
+    r"(?P<length>hh|h|ll|l|j|z|t)?(?P<conv>[diouxXcsp%])")
+
+
+class FormatTable:
+    """Reads NUL terminated strings from the loadable sections of an ELF."""
+
+    def __init__(self, elf_path):
+        from elftools.elf.elffile import ELFFile
+
+        self._sections = []
+        with open(elf_path, "rb") as f:
+            elf = ELFFile(f)
+            for section in elf.iter_sections():
+                if section["sh_type"] != "SHT_PROGBITS" or section["sh_addr"] == 0:
+                    continue
+                self._sections.append((section["sh_addr"], section.data()))
+        self._cache = {}
+
+    def lookup(self, addr):
+        if addr in self._cache:
+            return self._cache[addr]
+        for base, data in self._sections:
+            if base <= addr < base + len(data):
+                offset = addr - base
+                end = data.find(b"\0", offset)
+                text = data[offset:end].decode("utf-8", errors="replace")
+                self._cache[addr] = text
+                return text
+        return None
+
+
+class TokenTable:
+    """Looks up format strings in the token database of tools/log_tokens.py."""
+
+    def __init__(self, db_path):
+        with open(db_path, "r", encoding="utf-8") as f:
+            self._tokens = {int(token, 16): fmt for token, fmt in json.load(f).items()}
+
+    def lookup(self, token):
+        return self._tokens.get(token)
+
+
+def c_format(fmt, args):
+    """Formats a C printf format string with the decoded argument list."""
+    out = []
+    pos = 0
+    arg_iter = iter(args)
+    for m in FMT_SPEC.finditer(fmt):
+        out.append(fmt[pos:m.start()])
+        pos = m.end()
+        conv = m.group("conv")
+        if conv == "%":
+            out.append("%")
+            continue
+        value = next(arg_iter, 0)
+        spec = "%" + m.group("flags") + (m.group("width") or "") + (m.group("prec") or "")
+        if conv == "s":
+            out.append((spec + "s") % (value if isinstance(value, str) else "0x%08x" % value))
+        elif conv in "di":
+            if isinstance(value, str):
+                value = 0
+            if value & 0x80000000:
+                value -= 0x100000000
+            out.append((spec + "d") % value)
+        elif conv == "c":
+            out.append((spec + "c") % chr(value & 0xFF))
+        elif conv == "p":
+            out.append("0x%08x" % value)
+        else:
+            out.append((spec + conv) % value)
+    out.append(fmt[pos:])
+    return "".join(out)
+
+
+def decode_record(line, table):
+    fields = line[len(RECORD_PREFIX):].split(":")
+    fmt = table.lookup(int(fields[0], 16))
+    if fmt is None:
+        return "<unknown format 0x%s> %s\n" % (fields[0], " ".join(fields[1:]))
+    args = []
+    for field in fields[1:]:
+        if field.startswith("s"):
+            args.append(bytes.fromhex(field[1:]).decode("utf-8", errors="replace"))
+        else:
+            args.append(int(field, 16))
+    return "Info: " + c_format(fmt, args)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    source_group = parser.add_mutually_exclusive_group(required=True)
+    source_group.add_argument("--elf", help="application ELF file")
+    source_group.add_argument("--db", help="token database of a log-tokenized build")
+    parser.add_argument("log", nargs="?", help="captured console output, stdin if omitted")
+    options = parser.parse_args()
+
+    table = FormatTable(options.elf) if options.elf else TokenTable(options.db)
+    source = open(options.log, "r", errors="replace") if options.log else sys.stdin
+
+    for line in source:
+        line = line.rstrip("\r\n")
+        if line.startswith(RECORD_PREFIX):
+            sys.stdout.write(decode_record(line, table))
+        else:
+            sys.stdout.write(line + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""
+Builds the token database of the APP_INFO() format strings for builds with
+the log-tokenized option enabled in mbed_app.json.
+
+The firmware replaces each APP_INFO() format string by its 32-bit FNV-1a
+hash (app_log_token() in source/app_log.h). This script scans the
+application sources for APP_INFO() calls, computes the same hash for each
+format string and writes a JSON object mapping the token, as 8 hex digits,
+to the format string. Run it together with the firmware build so that the
+database matches the image, and pass the result to tools/log_decode.py.
+
+Usage:
+    python tools/log_tokens.py [-o BUILD/log_tokens.json] [source dirs/files]
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+SOURCE_EXTENSIONS = (".c", ".cpp", ".h", ".hpp")
+
+# Directories deployed by 'mbed deploy' which do not use APP_INFO().
+SKIP_DIRS = ("mbed-os", "lpa", "connectivity-utilities", "BUILD", "tools")
+
+LOG_CALL = re.compile(r"\bAPP_INFO\s*\(\s*\(")
+STRING_LITERAL = re.compile(r'\s*"((?:[^"\\\n]|\\.)*)"', re.S)
+
+SIMPLE_ESCAPES = {
+    "n": "\n", "t": "\t", "r": "\r", "0": "\0", "\\": "\\", '"': '"',
+    "'": "'", "?": "?", "a": "\a", "b": "\b", "f": "\f", "v": "\v",
+}
+
+
+def fnv1a_32(data):
+    """Must stay in sync with app_log_token() in source/app_log.h."""
+    value = 2166136261
+    for byte in data:
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def unescape_c(text):
+    """Decodes the escape sequences of a C string literal body to bytes."""
+    out = bytearray()
+    i = 0
+    while i < len(text):
+        c = text[i]
+        if c != "\\":
+            out += c.encode("utf-8")
+            i += 1
+            continue
+        nxt = text[i + 1]
+        if nxt == "x":
+            m = re.match(r"[0-9a-fA-F]+", text[i + 2:])
+            out.append(int(m.group(0), 16) & 0xFF)
+            i += 2 + len(m.group(0))
+        elif nxt in "01234567":
+            m = re.match(r"[0-7]{1,3}", text[i + 1:])
+            out.append(int(m.group(0), 8) & 0xFF)
+            i += 1 + len(m.group(0))
+        else:
+            out += SIMPLE_ESCAPES[nxt].encode("utf-8")
+            i += 2
+    return bytes(out)
+
+
+def strip_comments(source):
+    """Removes C/C++ comments while keeping string literals intact."""
+    pattern = re.compile(r'//[^\n]*|/\*.*?\*/|"(?:[^"\\\n]|\\.)*"', re.S)
+    return pattern.sub(lambda m: m.group(0) if m.group(0).startswith('"') else " ", source)
+
+
+def format_strings(source):
+    """Yields the format string of each APP_INFO() call in the source."""
+    source = strip_comments(source)
+    for call in LOG_CALL.finditer(source):
+        pos = call.end()
+        parts = []
+        # Adjacent string literals are concatenated by the compiler.
+        for lit in iter(lambda: STRING_LITERAL.match(source, pos), None):
+            parts.append(unescape_c(lit.group(1)))
+            pos = lit.end()
+        if parts:
+            yield b"".join(parts)
+
+
+def source_files(paths):
+    for path in paths:
+        if os.path.isfile(path):
+            yield path
+            continue
+        for root, dirs, files in os.walk(path):
+            dirs[:] = [d for d in dirs if d not in SKIP_DIRS and not d.startswith(".")]
+            for name in sorted(files):
+                if name.endswith(SOURCE_EXTENSIONS):
+                    yield os.path.join(root, name)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("paths", nargs="*", default=["."],
+                        help="source files or directories (default: .)")
+    parser.add_argument("-o", "--output", help="database file, stdout if omitted")
+    options = parser.parse_args()
+
+    tokens = {}
+    for path in source_files(options.paths):
+        with open(path, "r", encoding="utf-8", errors="replace") as f:
+            for fmt in format_strings(f.read()):
+                token = "%08x" % fnv1a_32(fmt)
+                text = fmt.decode("utf-8", errors="replace")
+                if token in tokens and tokens[token] != text:
+                    sys.exit("error: token collision %s between %r and %r"
+                             % (token, tokens[token], text))
+                tokens[token] = text
+
+    output = open(options.output, "w") if options.output else sys.stdout
+    json.dump(tokens, output, indent=2, sort_keys=True, ensure_ascii=False)
+    output.write("\n")
+
+
+if __name__ == "__main__":
+    main()
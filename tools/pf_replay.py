@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+"""
+Replays a packet capture through the packet filters of the application to
+show which packets would reach, and wake, the host.
+
+The filters are read from the console output of app_ol_list_pf_print(),
+lines of the form
+
+    Filter <id>: <port|ethtype|iptype> <value>[/src|/dst] <S|-><W|-> <keep|discard>
+
+and the capture must be a classic pcap file of Ethernet frames, as taken
+with tcpdump or Wireshark on a wired segment bridged to the AP. A packet
+passes when it matches a keep filter, or, if no keep filter is active,
+when it matches no discard filter.
+
+With --expect-passed the script fails unless exactly that many packets
+pass, which checks a filter configuration against a reference capture such
+as tools/pf_chatter.pcap, a minute of synthetic discovery chatter.
+
+Usage:
+    python tools/pf_replay.py --filters console.log capture.pcap [--profile wake]
+                              [--expect-passed N]
+"""
+
+import argparse
+import collections
+import re
+import struct
+import sys
+
+FILTER_LINE = re.compile(
+    r"Filter (?P<id>\d+): (?P<feature>port|ethtype|iptype) (?P<value>\d+)"
+    r"(?P<dir>/src|/dst)? (?P<sleep>[S-])(?P<wake>[W-]) (?P<action>keep|discard)")
+
+Filter = collections.namedtuple("Filter", "feature value source sleep wake keep")
+Packet = collections.namedtuple("Packet", "eth_type ip_proto sport dport")
+
+# Magic numbers of microsecond and nanosecond captures, in the byte order
+# of the writer.
+PCAP_MAGIC_US = 0xA1B2C3D4
+PCAP_MAGIC_NS = 0xA1B23C4D
+ETH_HEADER_LEN = 14
+IPV4_HEADER_LEN = 20
+IPV6_HEADER_LEN = 40
+LINKTYPE_ETHERNET = 1
+ETH_TYPE_VLAN = 0x8100
+ETH_TYPE_IPV4 = 0x0800
+ETH_TYPE_IPV6 = 0x86DD
+IP_PROTO_ICMP = 1
+IP_PROTO_TCP = 6
+IP_PROTO_UDP = 17
+IP_PROTO_ICMPV6 = 58
+
+
+def read_filters(path):
+    filters = []
+    with open(path, "r", errors="replace") as log:
+        for line in log:
+            m = FILTER_LINE.search(line)
+            if m:
+                filters.append(Filter(m.group("feature"), int(m.group("value")),
+                                      m.group("dir") == "/src", m.group("sleep") == "S",
+                                      m.group("wake") == "W", m.group("action") == "keep"))
+    return filters
+
+
+def read_pcap(path):
+    with open(path, "rb") as capture:
+        header = capture.read(24)
+        if len(header) < 24:
+            sys.exit("%s: not a pcap file" % path)
+        for endian in "<>":
+            magic, = struct.unpack(endian + "I", header[:4])
+            if magic in (PCAP_MAGIC_US, PCAP_MAGIC_NS):
+                break
+        else:
+            sys.exit("%s: not a pcap file (pcapng is not supported)" % path)
+        linktype, = struct.unpack(endian + "I", header[20:24])
+        if linktype != LINKTYPE_ETHERNET:
+            sys.exit("%s: link type %d is not Ethernet" % (path, linktype))
+        while True:
+            record = capture.read(16)
+            if len(record) < 16:
+                return
+            incl_len = struct.unpack(endian + "IIII", record)[2]
+            frame = capture.read(incl_len)
+            if len(frame) < incl_len:
+                return
+            yield parse_frame(frame)
+
+
+def parse_frame(frame):
+    """Returns the headers of a frame, None if it is shorter than an
+    Ethernet header. Fields of headers cut short by the capture are None."""
+    if len(frame) < ETH_HEADER_LEN:
+        return None
+    eth_type, = struct.unpack("!H", frame[12:14])
+    offset = ETH_HEADER_LEN
+    if eth_type == ETH_TYPE_VLAN:
+        if len(frame) < ETH_HEADER_LEN + 4:
+            return None
+        eth_type, = struct.unpack("!H", frame[16:18])
+        offset += 4
+    ip_proto = sport = dport = None
+    if eth_type == ETH_TYPE_IPV4 and len(frame) >= offset + IPV4_HEADER_LEN:
+        ip_proto = frame[offset + 9]
+        offset += max((frame[offset] & 0x0F) * 4, IPV4_HEADER_LEN)
+    elif eth_type == ETH_TYPE_IPV6 and len(frame) >= offset + IPV6_HEADER_LEN:
+        ip_proto = frame[offset + 6]
+        offset += IPV6_HEADER_LEN
+    if ip_proto in (IP_PROTO_TCP, IP_PROTO_UDP) and len(frame) >= offset + 4:
+        sport, dport = struct.unpack("!HH", frame[offset:offset + 4])
+    return Packet(eth_type, ip_proto, sport, dport)
+
+
+def matches(flt, pkt):
+    if flt.feature == "ethtype":
+        return pkt.eth_type == flt.value
+    if flt.feature == "iptype":
+        return pkt.ip_proto == flt.value
+    port = pkt.sport if flt.source else pkt.dport
+    return port == flt.value
+
+
+def verdict(filters, pkt):
+    keep = [f for f in filters if f.keep]
+    if keep:
+        return any(matches(f, pkt) for f in keep)
+    return not any(matches(f, pkt) for f in filters)
+
+
+def describe(pkt):
+    if pkt.ip_proto in (IP_PROTO_UDP, IP_PROTO_TCP):
+        name = "udp" if pkt.ip_proto == IP_PROTO_UDP else "tcp"
+        if pkt.sport is None:
+            return name + "/short"
+        return "%s/%d" % (name, min(pkt.sport, pkt.dport))
+    if pkt.ip_proto in (IP_PROTO_ICMP, IP_PROTO_ICMPV6):
+        return "icmp"
+    if pkt.ip_proto is not None:
+        return "ip/%d" % pkt.ip_proto
+    return "eth/0x%04x" % pkt.eth_type
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--filters", required=True, help="console output with the filter table")
+    parser.add_argument("--profile", choices=("sleep", "wake"), default="sleep",
+                        help="filter profile to replay, default sleep")
+    parser.add_argument("--expect-passed", type=int, metavar="N",
+                        help="fail unless exactly N packets pass")
+    parser.add_argument("capture", help="pcap file of Ethernet frames")
+    options = parser.parse_args()
+
+    filters = [f for f in read_filters(options.filters)
+               if (f.sleep if options.profile == "sleep" else f.wake)]
+    if not filters:
+        print("No %s profile filters found, every packet passes." % options.profile)
+
+    counts = collections.defaultdict(lambda: [0, 0])
+    runts = 0
+    for pkt in read_pcap(options.capture):
+        if pkt is None:
+            runts += 1
+            continue
+        counts[describe(pkt)][0 if verdict(filters, pkt) else 1] += 1
+
+    passed = sum(c[0] for c in counts.values())
+    dropped = sum(c[1] for c in counts.values())
+    print("%-12s %8s %8s" % ("traffic", "passed", "dropped"))
+    for key, (p, d) in sorted(counts.items(), key=lambda item: -sum(item[1])):
+        print("%-12s %8d %8d" % (key, p, d))
+    print("%-12s %8d %8d" % ("total", passed, dropped))
+    if runts:
+        print("%d frames shorter than an Ethernet header skipped." % runts)
+    if options.expect_passed is not None and passed != options.expect_passed:
+        sys.exit("%d packets passed, expected %d." % (passed, options.expect_passed))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,349 @@
+#!/usr/bin/env python3
+"""
+Decodes the wear-leveled QSPI log of source/app_qlog.cpp, and checks its
+crash consistency on a file-backed emulation of the QSPI NOR flash.
+
+The application prints the newest pages at boot, with the
+qspi-log-dump-pages option in mbed_app.json, as single lines
+
+    #Q:<page header and records, hex encoded>
+
+A raw image of the log region, for example read out with a programmer,
+can be decoded as well.
+
+The check runs the page allocation of app_qlog.cpp against a flash image
+file with NOR semantics: an erase sets a whole sector to 0xFF and a program
+can only clear bits. A power loss is injected at a random point of a random
+erase or program, leaving a torn page or a partially erased sector, and the
+log is mounted again. After every mount, all pages completely written and
+not erased since must be valid, every valid page must hold the records it
+was written with, the next page must be newer than all of them, and no
+program may hit a page which is not blank. The page torn by the power loss
+may be either valid or not. The erase count of every sector is reported to
+show the wear leveling.
+
+The check runs a Python copy of the allocation, which must follow changes
+of app_qlog.cpp. UNITTESTS/app_qlog runs the same kind of check on the C
+code, built for the host against a file-backed flash.
+
+Usage:
+    python tools/qlog.py decode console.log
+    python tools/qlog.py image region.bin
+    python tools/qlog.py check [--image flash.bin] [--cycles 200] [--seed 1]
+"""
+
+import argparse
+import os
+import random
+import struct
+import sys
+import tempfile
+import zlib
+
+# Layout, must stay in sync with source/app_qlog.h and app_qlog.cpp.
+PAGE_SIZE = 512
+HEADER = struct.Struct("<IIHHI")
+RECORD = struct.Struct("<IIIBBH")
+MAGIC = 0x474F4C51
+RECS_PER_PAGE = (PAGE_SIZE - HEADER.size) // RECORD.size
+CRC_HEADER_SIZE = 12
+
+# S25FL512S of all kits, see cycfg_qspi_memslot.c.
+SECTOR_SIZE = 0x40000
+
+REC_TYPES = {1: "boot", 2: "wake"}
+# Must stay in sync with app_wake_reason_t in source/app_stats.h.
+REASONS = ("unknown", "wlan", "host")
+
+LINE_PREFIX = "#Q:"
+
+
+def page_crc(page):
+    count = HEADER.unpack_from(page)[2]
+    return zlib.crc32(page[:CRC_HEADER_SIZE] +
+                      page[HEADER.size:HEADER.size + count * RECORD.size]) & 0xFFFFFFFF
+
+
+def make_page(seq, records):
+    body = b"".join(RECORD.pack(*r) for r in records)
+    page = bytearray(HEADER.pack(MAGIC, seq, len(records), RECORD.size, 0) + body)
+    struct.pack_into("<I", page, CRC_HEADER_SIZE, page_crc(page))
+    return bytes(page) + b"\xff" * (PAGE_SIZE - len(page))
+
+
+def parse_page(data, pos=None, pages=None):
+    """Returns (seq, records) of a valid page, None otherwise."""
+    if len(data) < HEADER.size:
+        return None
+    magic, seq, count, rec_size, crc = HEADER.unpack_from(data)
+    if magic != MAGIC or not 0 < count <= RECS_PER_PAGE or rec_size != RECORD.size:
+        return None
+    if pos is not None and seq % pages != pos:
+        return None
+    if len(data) < HEADER.size + count * RECORD.size or page_crc(data) != crc:
+        return None
+    return seq, [RECORD.unpack_from(data, HEADER.size + i * RECORD.size)
+                 for i in range(count)]
+
+
+def format_record(rec):
+    time_s, sleep_ms, awake_ms, rtype, reason, packets = rec
+    if REC_TYPES.get(rtype) == "boot":
+        return "%10d boot  reset reason 0x%08x" % (time_s, awake_ms)
+    name = REASONS[reason] if reason < len(REASONS) else str(reason)
+    return "%10d wake  %-7s slept %8d ms, awake %6d ms, %5d packets" % (
+        time_s, name, sleep_ms, awake_ms, packets)
+
+
+def print_pages(pages):
+    for seq, records in sorted(pages):
+        for rec in records:
+            print("%8d %s" % (seq, format_record(rec)))
+
+
+class PowerLoss(Exception):
+    pass
+
+
+class Flash(object):
+    """File-backed NOR flash with an optional power loss injection."""
+
+    def __init__(self, path, size, sector_size, page_size):
+        self.size, self.sector_size, self.page_size = size, sector_size, page_size
+        self.file = open(path, "r+b" if os.path.exists(path) else "w+b")
+        self.file.truncate(size)
+        self.erases = [0] * (size // sector_size)
+        self.fail_at = None
+        self.rng = random.Random()
+
+    def read(self, offset, length):
+        self.file.seek(offset)
+        return self.file.read(length)
+
+    def _tick(self):
+        """Counts down the operations until the injected power loss."""
+        if self.fail_at is None:
+            return False
+        self.fail_at -= 1
+        return self.fail_at < 0
+
+    def erase(self, offset, length):
+        assert offset % self.sector_size == 0 and length % self.sector_size == 0
+        for sector in range(offset, offset + length, self.sector_size):
+            if self._tick():
+                # Some of the pages of the sector were erased.
+                for page in range(sector, sector + self.sector_size, self.page_size):
+                    if self.rng.random() < 0.5:
+                        self.file.seek(page)
+                        self.file.write(b"\xff" * self.page_size)
+                raise PowerLoss()
+            self.file.seek(sector)
+            self.file.write(b"\xff" * self.sector_size)
+            self.erases[sector // self.sector_size] += 1
+
+    def program(self, offset, data):
+        assert offset // self.page_size == (offset + len(data) - 1) // self.page_size
+        old = self.read(offset, len(data))
+        if any(o & d != d for o, d in zip(old, data)):
+            raise AssertionError("program over non-blank bytes at 0x%x" % offset)
+        cut = len(data)
+        if self._tick():
+            cut = self.rng.randrange(len(data))
+        new = bytes(o & d for o, d in zip(old[:cut], data[:cut]))
+        self.file.seek(offset)
+        self.file.write(new)
+        if cut < len(data):
+            # The byte being programmed lost some of its cleared bits.
+            self.file.write(bytes([old[cut] & (data[cut] | self.rng.randrange(256))]))
+            raise PowerLoss()
+
+
+class RingLog(object):
+    """Page allocation of source/app_qlog.cpp."""
+
+    def __init__(self, flash, base, sectors):
+        self.flash, self.base = flash, base
+        self.sector_size = flash.sector_size
+        self.pages_per_sector = flash.sector_size // PAGE_SIZE
+        self.pages = sectors * self.pages_per_sector
+        self.next_seq = 0
+        self.programming = None
+
+    def offset(self, seq):
+        return self.base + (seq % self.pages) * PAGE_SIZE
+
+    def read_header(self, pos):
+        magic, seq, count, rec_size, _ = HEADER.unpack(self.flash.read(self.offset(pos), HEADER.size))
+        valid = (magic == MAGIC and seq % self.pages == pos and
+                 0 < count <= RECS_PER_PAGE and rec_size == RECORD.size)
+        return seq if valid else None
+
+    def page(self, seq):
+        data = self.flash.read(self.offset(seq), PAGE_SIZE)
+        page = parse_page(data, seq % self.pages, self.pages)
+        return page[1] if page and page[0] == seq else None
+
+    def blank(self, pos):
+        return self.flash.read(self.offset(pos), PAGE_SIZE) == b"\xff" * PAGE_SIZE
+
+    def mount(self):
+        seqs = [s for s in (self.read_header(p) for p in range(self.pages)) if s is not None]
+        newest = max(seqs) if seqs else None
+        steps = 0
+        while newest is not None and self.page(newest) is None:
+            if newest == 0 or steps == self.pages:
+                newest = None
+                break
+            newest -= 1
+            steps += 1
+        self.next_seq = 0 if newest is None else newest + 1
+
+    def write_page(self, records, on_erase=None):
+        """Returns the sequence number the page was written with."""
+        seq = self.next_seq
+        for _ in range(self.pages):
+            pos = seq % self.pages
+            if pos % self.pages_per_sector == 0:
+                if on_erase:
+                    on_erase(pos // self.pages_per_sector)
+                self.flash.erase(self.offset(seq), self.sector_size)
+                break
+            if self.blank(pos):
+                break
+            seq += 1
+        else:
+            raise RuntimeError("no blank page")
+        self.next_seq = seq + 1
+        self.programming = seq
+        self.flash.program(self.offset(seq), make_page(seq, records))
+        self.programming = None
+        return seq
+
+    def valid_pages(self):
+        pages = []
+        for pos in range(self.pages):
+            data = self.flash.read(self.offset(pos), PAGE_SIZE)
+            page = parse_page(data, pos, self.pages)
+            if page:
+                pages.append(page)
+        return pages
+
+
+def decode(path):
+    pages = []
+    with open(path, errors="replace") as f:
+        for line in f:
+            i = line.find(LINE_PREFIX)
+            if i < 0:
+                continue
+            try:
+                data = bytes.fromhex(line[i + len(LINE_PREFIX):].strip())
+            except ValueError:
+                data = b""
+            page = parse_page(data)
+            if page is None:
+                print("bad page: %s" % line.strip()[:40])
+                continue
+            pages.append(page)
+    print_pages(pages)
+    return 0
+
+
+def image(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    total = len(data) // PAGE_SIZE
+    pages = [p for p in (parse_page(data[i * PAGE_SIZE:(i + 1) * PAGE_SIZE], i, total)
+                         for i in range(total)) if p]
+    print_pages(pages)
+    return 0
+
+
+def check(options):
+    rng = random.Random(options.seed)
+    path = options.image or os.path.join(tempfile.mkdtemp(), "qlog_flash.bin")
+    size = options.sectors * SECTOR_SIZE
+    flash = Flash(path, size, SECTOR_SIZE, PAGE_SIZE)
+    flash.rng = rng
+    if not options.image:
+        # A used part: old data, not a multiple of the log pages.
+        flash.file.write(bytes(rng.randrange(256) for _ in range(4096)) * (size // 4096))
+    log = RingLog(flash, 0, options.sectors)
+
+    committed = {}      # seq -> records of the pages written and not erased
+    history = {}        # seq -> records of all pages ever written
+    pages = losses = 0
+    for cycle in range(options.cycles):
+        log.mount()
+        found = dict(log.valid_pages())
+        missing = sorted(seq for seq in committed if found.get(seq) != committed[seq])
+        # A torn erase may leave pages of an old lap behind, which are never
+        # newer than the committed pages. Anything else is corruption.
+        corrupt = sorted(seq for seq in found if history.get(seq) != found[seq])
+        if missing or corrupt:
+            print("cycle %d: pages missing %s, corrupt %s" % (cycle, missing[:8], corrupt[:8]))
+            return 1
+        if found and log.next_seq <= max(found):
+            print("cycle %d: next page %d reuses a written page" % (cycle, log.next_seq))
+            return 1
+
+        def on_erase(sector):
+            for seq in [s for s in committed if (s % log.pages) // log.pages_per_sector == sector]:
+                del committed[seq]
+
+        flash.fail_at = rng.randrange(options.max_ops)
+        try:
+            for _ in range(rng.randrange(1, 4 * options.max_ops)):
+                records = [(rng.randrange(1 << 32), rng.randrange(1 << 20), rng.randrange(1 << 16),
+                            2, rng.randrange(len(REASONS)), rng.randrange(1 << 16))
+                           for _ in range(rng.randrange(1, RECS_PER_PAGE + 1))]
+                try:
+                    seq = log.write_page(records, on_erase)
+                finally:
+                    if log.programming is not None:
+                        # A torn page may still be complete.
+                        history[log.programming] = records
+                        log.programming = None
+                committed[seq] = history[seq] = records
+                pages += 1
+        except PowerLoss:
+            losses += 1
+        flash.fail_at = None
+
+    print("%d cycles, %d power losses, %d pages written, next page %d"
+          % (options.cycles, losses, pages, log.next_seq))
+    print("erases per sector: %s (max %d, min %d)" % (
+        " ".join(str(e) for e in flash.erases), max(flash.erases), min(flash.erases)))
+    print("consistent")
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    sub = parser.add_subparsers(dest="command")
+    p = sub.add_parser("decode", help="decode the '#Q:' lines of a console log")
+    p.add_argument("log")
+    p = sub.add_parser("image", help="decode a raw image of the log region")
+    p.add_argument("image")
+    p = sub.add_parser("check", help="crash consistency check on an emulated flash")
+    p.add_argument("--image", help="flash image file, a temporary file by default")
+    p.add_argument("--sectors", type=int, default=2,
+                   help="sectors of the log region, qspi-log-sectors")
+    p.add_argument("--cycles", type=int, default=200, help="power cycles")
+    p.add_argument("--max-ops", type=int, default=600,
+                   help="maximum erases and programs before a power loss")
+    p.add_argument("--seed", type=int, default=1)
+    options = parser.parse_args()
+
+    if options.command == "decode":
+        return decode(options.log)
+    if options.command == "image":
+        return image(options.image)
+    if options.command == "check":
+        return check(options)
+    parser.print_help()
+    return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
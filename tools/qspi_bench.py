@@ -0,0 +1,259 @@
+#!/usr/bin/env python3
+"""
+Models the read commands of the QSPI memory of each kit and compares the
+model with the benchmark run on a kit with the qspi-read-bench option of
+mbed_app.json.
+
+The benchmark of source/app_qspi_bench.cpp prints at boot
+
+    QSPI bench: <command> xip <kB/s> kB/s, dma <kB/s> kB/s, latency <ns> ns, cost <ns> ns
+    QSPI bench: <command> fails the read check
+    QSPI bench: <command> is the generated command
+    QSPI bench: selected <command>
+
+The table entry which repeats the generated command is not measured, and
+the model drops it as well.
+
+The host model counts the SCK cycles of one XIP transaction, a cache line of
+16 bytes: command, address, mode and dummy cycles and the data, each phase
+on its number of lines. SCK is half the SMIF clock, CLK_HF2 of the generated
+cycfg_system.c or APP_XIP_QSPI_FREQ_HZ of source/app_xip.h when the design
+leaves CLK_HF2 to the HAL, and at most the limit of the command. The
+latency is one transaction, the XIP throughput one line per transaction and
+the DMA throughput adds the word accesses of the DMA and the setup of each
+transfer. The selection is the one of app_qspi_bench_select(): lowest cost
+to fetch a cold code path of PATH_SIZE bytes, the higher DMA throughput
+breaking ties.
+
+The DDR read commands of the memory are listed but not modelled, the SMIF
+block of these devices transfers data on one clock edge only.
+
+With --log the measured results of every benchmark in the log are selected
+again on the host, and each choice and the command skipped as the generated
+one are compared with those of the kit; the exit status is 1 if any differs.
+The app_qspi_bench host unit test runs this check on the choices of
+app_qspi_bench_select().
+
+Usage:
+    python tools/qspi_bench.py                      model all kits
+    python tools/qspi_bench.py --log console.log --target <kit>
+                                                    check a measured benchmark
+"""
+
+import argparse
+import os
+import re
+import sys
+
+from cycfg_gen import clock_tree, defines, number, read_qspi
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir)
+DESIGN = "COMPONENT_CUSTOM_DESIGN_MODUS"
+
+LINES = {"SINGLE": 1, "DUAL": 2, "QUAD": 4, "OCTAL": 8}
+NO_MODE = 0xFFFFFFFF
+
+# Must stay in sync with APP_QSPI_BENCH_PATH_SIZE of source/app_qspi_bench.h.
+PATH_SIZE = 1024
+LINE_SIZE = 16                 # XIP cache line
+DMA_TRANSFER = 1024            # bytes of one DMA transfer of the benchmark
+ADDR_BITS = 32
+
+# Read commands of the S25FL512S with 4-byte addresses, in the order of
+# source/app_qspi_bench.cpp, after the generated command: name, command,
+# address lines, mode byte and its lines (None without mode), dummy cycles,
+# data lines, SCK limit in MHz.
+COMMANDS = (
+    ("read 1-1-1", 0x13, 1, None, None, 0, 1, 50),
+    ("fast 1-1-1", 0x0C, 1, None, None, 8, 1, 133),
+    ("dual 1-1-2", 0x3C, 1, None, None, 8, 2, 104),
+    ("dual 1-2-2", 0xBC, 2, 0x01, 2, 0, 2, 104),
+    ("quad 1-1-4", 0x6C, 1, None, None, 8, 4, 104),
+    ("quad 1-4-4", 0xEC, 4, 0x01, 4, 4, 4, 104),
+)
+DDR_COMMANDS = (("ddr quad 1-4-4", 0xEE),)
+
+# Default costs in ns.
+MODEL = {
+    "overhead_ns": 60,         # SMIF and bus cycles of one XIP transaction
+    "dma_word_ns": 40,         # one DMA word access through the XIP interface
+    "dma_setup_ns": 2000,      # configuration and start of one DMA transfer
+}
+
+RESULT = re.compile(r"QSPI bench: (.+?) xip (\d+) kB/s, dma (\d+) kB/s, latency (\d+) ns")
+FAILED = re.compile(r"QSPI bench: (.+?) fails the read check")
+SKIPPED = re.compile(r"QSPI bench: (.+?) is the generated command")
+SELECTED = re.compile(r"QSPI bench: selected (.+?)\s*$")
+
+
+def read(target, name):
+    path = os.path.join(ROOT, DESIGN, target, "GeneratedSource", name)
+    if not os.path.exists(path):
+        return ""
+    with open(path) as f:
+        return f.read()
+
+
+def hal_qspi_hz():
+    with open(os.path.join(ROOT, "source", "app_xip.h")) as f:
+        return number(re.search(r"#define APP_XIP_QSPI_FREQ_HZ\s+\((\w+)\)", f.read()).group(1))
+
+
+def commands(target):
+    """Returns the read commands of a kit, the generated one first. The
+    entry which repeats the generated command is dropped, as the benchmark
+    does with app_qspi_bench_same_cmd()."""
+    read_cmd = read_qspi(read(target, "cycfg_qspi_memslot.c"))["read"]
+    command = int(read_cmd["command"], 16)
+    mode = int(read_cmd["mode"], 16)
+    limits = dict((c[1], c[-1]) for c in COMMANDS)
+    generated = ("generated", command, LINES[read_cmd["addr_width"]],
+                 None if mode == NO_MODE else mode,
+                 None if mode == NO_MODE else LINES[read_cmd["mode_width"]],
+                 read_cmd["dummy_cycles"], LINES[read_cmd["data_width"]],
+                 limits.get(command, min(limits.values())))
+    return (generated,) + tuple(c for c in COMMANDS if c[1:7] != generated[1:7])
+
+
+def smif_hz(target):
+    tree = clock_tree(defines(read(target, "cycfg_system.c")))
+    return tree["hf"].get(2, hal_qspi_hz())
+
+
+def estimate(command, smif, model):
+    """Returns the modelled result of a read command."""
+    _, _, addr_lines, _, mode_lines, dummy, data_lines, limit_mhz = command
+    sck = min(smif / 2, limit_mhz * 1e6)
+    cycles = 8 + ADDR_BITS // addr_lines + dummy + LINE_SIZE * 8 // data_lines
+    if mode_lines:
+        cycles += 8 // mode_lines
+    line_ns = cycles * 1e9 / sck + model["overhead_ns"]
+    dma_line_ns = max(line_ns, LINE_SIZE // 4 * model["dma_word_ns"])
+    dma_ns = DMA_TRANSFER // LINE_SIZE * dma_line_ns + model["dma_setup_ns"]
+    return {
+        "valid": True,
+        "xip_kbps": int(LINE_SIZE * 1e6 / line_ns),
+        "dma_kbps": int(DMA_TRANSFER * 1e6 / dma_ns),
+        "latency_ns": int(line_ns),
+    }
+
+
+def cost_ns(result):
+    """Same as app_qspi_bench_cost_ns()."""
+    if not result["valid"] or not result["xip_kbps"]:
+        return 0xFFFFFFFF
+    return result["latency_ns"] + PATH_SIZE * 1000000 // result["xip_kbps"]
+
+
+def select(results):
+    """Same as app_qspi_bench_select(), returns the selected index."""
+    best = 0
+    for i in range(1, len(results)):
+        cost, best_cost = cost_ns(results[i]), cost_ns(results[best])
+        if results[i]["valid"] and (cost < best_cost or (
+                cost == best_cost and results[i]["dma_kbps"] > results[best]["dma_kbps"])):
+            best = i
+    return best
+
+
+def parse_log(path):
+    """Returns the results, the skipped commands and the selection of each
+    complete benchmark in a console log."""
+    benchmarks, results, skipped = [], None, set()
+    with open(path, errors="replace") as f:
+        for line in f:
+            m = RESULT.search(line)
+            if m:
+                if m.group(1) == "generated":
+                    results, skipped = {}, set()
+                if results is not None:
+                    results[m.group(1)] = {"valid": True, "xip_kbps": int(m.group(2)),
+                                           "dma_kbps": int(m.group(3)),
+                                           "latency_ns": int(m.group(4))}
+                continue
+            m = FAILED.search(line)
+            if m:
+                if m.group(1) == "generated":
+                    results, skipped = {}, set()
+                if results is not None:
+                    results[m.group(1)] = {"valid": False, "xip_kbps": 0, "dma_kbps": 0,
+                                           "latency_ns": 0}
+                continue
+            m = SKIPPED.search(line)
+            if m:
+                skipped.add(m.group(1))
+                continue
+            m = SELECTED.search(line)
+            if m and results is not None:
+                benchmarks.append((results, skipped, m.group(1)))
+                results = None
+    return benchmarks
+
+
+def print_row(name, result):
+    if not result["valid"]:
+        print("%-16s %10s" % (name, "fails"))
+        return
+    print("%-16s %10d %10d %10d %10d" % (name, result["xip_kbps"], result["dma_kbps"],
+                                         result["latency_ns"], cost_ns(result)))
+
+
+def targets():
+    return sorted(t for t in os.listdir(os.path.join(ROOT, DESIGN)) if t.startswith("TARGET_"))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--log", help="console output of a qspi-read-bench build")
+    parser.add_argument("--target", help="kit the log was captured on")
+    options = parser.parse_args()
+
+    header = "%-16s %10s %10s %10s %10s" % ("", "xip kB/s", "dma kB/s", "latency ns", "cost ns")
+    if options.log:
+        if not options.target:
+            parser.error("--log requires --target")
+        target = options.target if options.target.startswith("TARGET_") else "TARGET_" + options.target
+        benchmarks = parse_log(options.log)
+        if not benchmarks:
+            print("%s: no QSPI benchmark found" % options.log)
+            return 1
+        cmds = commands(target)
+        names = [c[0] for c in cmds]
+        dropped = set(c[0] for c in COMMANDS) - set(names)
+        smif = smif_hz(target)
+        differ = 0
+        for measured, skipped, selected in benchmarks:
+            results = [measured.get(n, {"valid": False, "xip_kbps": 0, "dma_kbps": 0,
+                                        "latency_ns": 0}) for n in names]
+            print("%s, SMIF %.1f MHz" % (target, smif / 1e6))
+            print(header)
+            for command, result in zip(cmds, results):
+                print_row(command[0], result)
+                print_row("  model", estimate(command, smif, MODEL))
+            choice = names[select(results)]
+            print()
+            print("selected on the kit %s, on the host %s" % (selected, choice))
+            if skipped != dropped:
+                print("skipped on the kit %s, on the host %s" % (
+                    ", ".join(sorted(skipped)) or "none", ", ".join(sorted(dropped)) or "none"))
+            print()
+            differ += (choice != selected) or (skipped != dropped)
+        print("%d of %d benchmarks differ" % (differ, len(benchmarks)))
+        return 1 if differ else 0
+
+    for target in targets():
+        smif = smif_hz(target)
+        cmds = commands(target)
+        results = [estimate(c, smif, MODEL) for c in cmds]
+        print("%s, SMIF %.1f MHz, selected %s" % (target, smif / 1e6, cmds[select(results)][0]))
+        print(header)
+        for command, result in zip(cmds, results):
+            print_row(command[0], result)
+        for name, command in DDR_COMMANDS:
+            print("%-16s %10s (0x%02X)" % (name, "no DDR", command))
+        print()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
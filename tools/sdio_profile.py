@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+"""
+Builds per-wake SDIO bus cost tables from the raw transactions printed by
+the application when it is built with the profiles/sdio_trace.json build
+profile and the sdio-trace-dump option in mbed_app.json enabled.
+
+Each transaction is printed as a single line
+
+    #B:<wake>:<start us>:<argument>:<response>:<length>:<duration us>:<flags>
+
+with all fields in hex. The transactions of each wake period are replayed
+through a model of the host driver bus accesses: they are classified like
+on the target, header reads followed by the rest of a frame are moved from
+the credit to the data class, and CMD52 reads returning the same value as
+the previous read of the same register, with no write to it in between,
+are reported as redundant read candidates.
+
+Usage:
+    python tools/sdio_profile.py [console.log]
+"""
+
+import argparse
+import collections
+import sys
+
+RECORD_PREFIX = "#B:"
+
+# Must stay in sync with app_sdio_class_t in source/app_sdio_trace.h.
+CLASSES = ("poll", "intr_ack", "credit", "data", "ctrl")
+
+FLAG_CMD53 = 1 << 0
+FLAG_FAIL = 1 << 1
+
+FUNC_BACKPLANE = 1
+FUNC_WLAN = 2
+SB_ACCESS_2_4B_FLAG = 0x8000
+SB_OFT_ADDR_MASK = 0x7FFF
+CORE_INT_STATUS = 0x2020
+CORE_TO_SB_MAILBOX = 0x2040
+CORE_TO_HOST_MAILBOX = 0x204C
+SDPCM_HEADER_SIZE = 12
+
+Transaction = collections.namedtuple(
+    "Transaction", "t_us arg resp length dur_us flags")
+
+
+def arg_write(arg):
+    return bool(arg & (1 << 31))
+
+
+def arg_func(arg):
+    return (arg >> 28) & 0x7
+
+
+def arg_addr(arg):
+    return (arg >> 9) & 0x1FFFF
+
+
+def classify(tr):
+    """Same rules as app_sdio_classify() in source/app_sdio_trace.cpp."""
+    write = arg_write(tr.arg)
+    addr = arg_addr(tr.arg)
+    if arg_func(tr.arg) == FUNC_WLAN:
+        return "credit" if not write and tr.length <= SDPCM_HEADER_SIZE else "data"
+    if arg_func(tr.arg) == FUNC_BACKPLANE and addr & SB_ACCESS_2_4B_FLAG:
+        offset = addr & SB_OFT_ADDR_MASK
+        if (write and offset in (CORE_INT_STATUS, CORE_TO_SB_MAILBOX)) or \
+                (not write and offset == CORE_TO_HOST_MAILBOX):
+            return "intr_ack"
+    return "ctrl" if write else "poll"
+
+
+def replay(transactions):
+    """Returns the cost table and the redundant read candidates of a wake."""
+    table = {name: [0, 0, 0] for name in CLASSES}
+    classes = [classify(tr) for tr in transactions]
+
+    # A header read followed by a read of the same function is a data frame.
+    for i, tr in enumerate(transactions[:-1]):
+        nxt = transactions[i + 1]
+        if classes[i] == "credit" and arg_func(nxt.arg) == FUNC_WLAN and \
+                not arg_write(nxt.arg):
+            classes[i] = "data"
+
+    last_value = {}
+    redundant = collections.defaultdict(lambda: [0, 0])
+    for cls, tr in zip(classes, transactions):
+        entry = table[cls]
+        entry[0] += 1
+        entry[1] += tr.length
+        entry[2] += tr.dur_us
+
+        if tr.flags & (FLAG_CMD53 | FLAG_FAIL):
+            continue
+        reg = (arg_func(tr.arg), arg_addr(tr.arg))
+        if arg_write(tr.arg):
+            last_value.pop(reg, None)
+            continue
+        value = tr.resp & 0xFF
+        if last_value.get(reg) == value:
+            redundant[reg][0] += 1
+            redundant[reg][1] += tr.dur_us
+        last_value[reg] = value
+
+    return table, redundant
+
+
+def parse(source):
+    wakes = collections.OrderedDict()
+    for line in source:
+        line = line.strip()
+        if not line.startswith(RECORD_PREFIX):
+            continue
+        fields = [int(f, 16) for f in line[len(RECORD_PREFIX):].split(":")]
+        if len(fields) != 7:
+            continue
+        wakes.setdefault(fields[0], []).append(Transaction(*fields[1:]))
+    return wakes
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("log", nargs="?", help="captured console output, stdin if omitted")
+    options = parser.parse_args()
+
+    source = open(options.log, "r", errors="replace") if options.log else sys.stdin
+    totals = {name: [0, 0, 0] for name in CLASSES}
+    total_redundant = collections.defaultdict(lambda: [0, 0])
+
+    for wake, transactions in parse(source).items():
+        table, redundant = replay(transactions)
+        span = transactions[-1].t_us + transactions[-1].dur_us
+        print("Wake %d: %d transactions over %d us" % (wake, len(transactions), span))
+        print("  %-8s %6s %8s %8s" % ("class", "count", "bytes", "us"))
+        for name in CLASSES:
+            print("  %-8s %6d %8d %8d" % ((name,) + tuple(table[name])))
+            for i in range(3):
+                totals[name][i] += table[name][i]
+        for reg, (count, dur_us) in redundant.items():
+            total_redundant[reg][0] += count
+            total_redundant[reg][1] += dur_us
+        print()
+
+    print("All wakes")
+    print("  %-8s %6s %8s %8s" % ("class", "count", "bytes", "us"))
+    for name in CLASSES:
+        print("  %-8s %6d %8d %8d" % ((name,) + tuple(totals[name])))
+
+    if total_redundant:
+        print()
+        print("Redundant CMD52 read candidates (same value, no write in between)")
+        print("  %-4s %-7s %6s %8s" % ("func", "addr", "count", "us"))
+        for (func, addr), (count, dur_us) in sorted(
+                total_redundant.items(), key=lambda item: -item[1][1]):
+            print("  %-4d 0x%05x %6d %8d" % (func, addr, count, dur_us))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,237 @@
+#!/usr/bin/env python3
+"""
+Generates the ULP power profile of each kit from its custom design and
+validates the clock tree of the generated configurations.
+
+COMPONENT_ULP_DESIGN_MODUS/TARGET_<kit> only holds the cycfg_system.c and
+cycfg_system.h generated by the Device Configurator in
+COMPONENT_CUSTOM_DESIGN_MODUS/TARGET_<kit>, changed to the ULP power mode:
+0.9 V core regulator output, the FLL retuned to at most 50 MHz and the
+CLK_FAST, CLK_PERI and CLK_SLOW dividers raised where needed. The ULP build
+keeps the custom design component for all other sources, and .mbedignore
+hides its two system files. The custom cycfg.h still includes its own
+cycfg_system.h, so the macros the ULP header changes must only be used by
+cycfg_system.c. The FLL parameters are
+computed the way Cy_SysClk_FllConfigure() of the PSoC 6 PDL does, the
+clock helpers are shared with tools/cycfg_gen.py.
+
+The validator computes the frequency of every clock from the generated
+macros and rejects frequencies above the limits of the power mode, as
+well as FREQ_MHZ macros which do not match the computed tree. On kits
+whose CLK_HF0 runs from the IMO, source/app_dvfs.cpp boosts CLK_HF0 to the
+FLL and scales the CLK_PERI divider with it, so the FLL frequency must be
+a multiple of CLK_PERI; the generator rounds the ULP FLL down to one and
+the validator rejects designs of either power mode which are not.
+
+Usage:
+    python tools/ulp_design.py                  regenerate the ULP designs
+    python tools/ulp_design.py --check          validate both designs and
+                                                check the ULP design is up
+                                                to date and only overrides
+                                                the system files
+    python tools/ulp_design.py --select ulp     build with the ULP designs
+    python tools/ulp_design.py --select custom  build with the LP designs
+"""
+
+import argparse
+import os
+import re
+import shutil
+import sys
+
+from cycfg_gen import LIMITS, MHZ, clock_tree, defines, number, set_define, \
+    set_divider, set_fll, set_hf_freqs, set_power_mode, validate
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir)
+SOURCE_DESIGN = "COMPONENT_CUSTOM_DESIGN_MODUS"
+ULP_DESIGN = "COMPONENT_ULP_DESIGN_MODUS"
+OVERRIDES = (os.path.join("GeneratedSource", "cycfg_system.c"),
+             os.path.join("GeneratedSource", "cycfg_system.h"))
+MBEDIGNORE = os.path.join(ROOT, ".mbedignore")
+IGNORE_OVERRIDDEN = "%s/*/GeneratedSource/cycfg_system.*" % SOURCE_DESIGN
+
+
+def dvfs_ratio(defs):
+    """Returns the FLL and CLK_PERI frequencies of the DVFS boost, see
+    app_dvfs_set_high(), or None if CLK_HF0 does not run from the IMO."""
+    if defs.get("CY_CFG_SYSCLK_CLKHF0_CLKPATH") != "CY_SYSCLK_CLKHF_IN_CLKPATH1" or \
+            defs.get("CY_CFG_SYSCLK_FLL_ENABLED") != "1":
+        return None
+    tree = clock_tree(defs)
+    return int(round(tree["fll"])), int(round(tree["peri"]))
+
+
+def dvfs_errors(name, text):
+    """Rejects a DVFS boost that cannot keep CLK_PERI at its frequency."""
+    ratio = dvfs_ratio(defines(text))
+    if ratio is None:
+        return []
+    fll, peri = ratio
+    if fll % peri or fll // peri > 256:
+        return ["%s: DVFS boost to the %.3f MHz FLL cannot keep CLK_PERI at %.3f MHz"
+                % (name, fll / MHZ, peri / MHZ)]
+    return []
+
+
+def ulp_system_c(text):
+    """Converts a cycfg_system.c to the ULP power mode."""
+    defs = defines(text)
+    limit = LIMITS["ULP"]
+
+    if defs.get("CY_CFG_SYSCLK_FLL_ENABLED") == "1":
+        text = set_fll(text, min(number(defs["CY_CFG_SYSCLK_FLL_OUT_FREQ"]), limit["fll"] * MHZ))
+    text = set_hf_freqs(text)
+
+    tree = clock_tree(defines(text))
+    hf0 = tree["hf"][0]
+    fast_div = number(defines(text).get("CY_CFG_SYSCLK_CLKFAST_DIVIDER", "0"))
+    fast_div = max(fast_div, -(-hf0 // (limit["fast"] * MHZ)) - 1)
+    peri_div = number(defines(text).get("CY_CFG_SYSCLK_CLKPERI_DIVIDER", "0"))
+    peri_div = max(peri_div, -(-hf0 // (limit["peri"] * MHZ)) - 1)
+    peri = hf0 / (peri_div + 1)
+    slow_div = number(defines(text).get("CY_CFG_SYSCLK_CLKSLOW_DIVIDER", "0"))
+    slow_div = max(slow_div, -(-peri // (limit["slow"] * MHZ)) - 1)
+    text = set_divider(text, "Fast", int(fast_div))
+    text = set_divider(text, "Peri", int(peri_div))
+    text = set_divider(text, "Slow", int(slow_div))
+
+    ratio = dvfs_ratio(defines(text))
+    if ratio and ratio[0] % ratio[1]:
+        text = set_hf_freqs(set_fll(text, ratio[0] // ratio[1] * ratio[1]))
+
+    return set_power_mode(text, "ULP")
+
+
+def ulp_system_h(text):
+    return set_define(text, "CY_CFG_PWR_SYS_ACTIVE_MODE", "CY_CFG_PWR_MODE_ULP")
+
+
+CONVERT = {"cycfg_system.c": ulp_system_c, "cycfg_system.h": ulp_system_h}
+
+
+def ulp_files(target):
+    """Yields (relative path, content) of the ULP overrides of a target."""
+    src = os.path.join(ROOT, SOURCE_DESIGN, target)
+    for name in OVERRIDES:
+        with open(os.path.join(src, name)) as f:
+            data = CONVERT[os.path.basename(name)](f.read()).encode("utf-8")
+        yield name, data
+
+
+def extra_files(target):
+    """Yields the files of the ULP design of a target that are not overrides."""
+    dst = os.path.join(ROOT, ULP_DESIGN, target)
+    for parent, _, files in os.walk(dst):
+        for name in files:
+            path = os.path.relpath(os.path.join(parent, name), dst)
+            if path not in OVERRIDES:
+                yield path
+
+
+def shadowed_macros(target):
+    """Yields (macro, file) for each macro the ULP cycfg_system.h changes
+    that a source other than cycfg_system.c uses. Those sources still see
+    the custom cycfg_system.h."""
+    src = os.path.join(ROOT, SOURCE_DESIGN, target, "GeneratedSource")
+    with open(os.path.join(src, "cycfg_system.h")) as f:
+        custom = defines(f.read())
+    ulp = defines(dict(ulp_files(target))[OVERRIDES[1]].decode("utf-8"))
+    changed = [m for m in ulp if custom.get(m) != ulp[m]]
+    users = [os.path.join(src, f) for f in sorted(os.listdir(src))
+             if not f.startswith("cycfg_system.")]
+    users += [os.path.join(ROOT, "main.cpp")]
+    users += [os.path.join(ROOT, "source", f)
+              for f in sorted(os.listdir(os.path.join(ROOT, "source")))]
+    for path in users:
+        with open(path, errors="replace") as f:
+            text = f.read()
+        for macro in changed:
+            if re.search(r"\b%s\b" % macro, text):
+                yield macro, os.path.relpath(path, ROOT)
+
+
+def targets():
+    return sorted(t for t in os.listdir(os.path.join(ROOT, SOURCE_DESIGN))
+                  if t.startswith("TARGET_"))
+
+
+def generate():
+    for target in targets():
+        dst = os.path.join(ROOT, ULP_DESIGN, target)
+        shutil.rmtree(dst, ignore_errors=True)
+        for name, data in ulp_files(target):
+            path = os.path.join(dst, name)
+            os.makedirs(os.path.dirname(path), exist_ok=True)
+            with open(path, "wb") as f:
+                f.write(data)
+        print("%s/%s" % (ULP_DESIGN, target))
+
+
+def check():
+    errors = []
+    for target in targets():
+        for design in (SOURCE_DESIGN, ULP_DESIGN):
+            path = os.path.join(ROOT, design, target, "GeneratedSource", "cycfg_system.c")
+            if os.path.exists(path):
+                with open(path) as f:
+                    text = f.read()
+                errors += validate("%s/%s" % (design, target), text)
+                errors += dvfs_errors("%s/%s" % (design, target), text)
+        for name, data in ulp_files(target):
+            path = os.path.join(ROOT, ULP_DESIGN, target, name)
+            if not os.path.exists(path) or open(path, "rb").read() != data:
+                errors.append("%s/%s/%s: out of date, run tools/ulp_design.py"
+                              % (ULP_DESIGN, target, name))
+        for name in extra_files(target):
+            errors.append("%s/%s/%s: not a system override, the ULP build takes it "
+                          "from %s" % (ULP_DESIGN, target, name, SOURCE_DESIGN))
+        for macro, path in shadowed_macros(target):
+            errors.append("%s/%s: %s differs from %s but %s uses it, which sees "
+                          "the custom cycfg_system.h" % (ULP_DESIGN, target, macro,
+                                                        SOURCE_DESIGN, path))
+    for error in errors:
+        print(error)
+    return 1 if errors else 0
+
+
+def select(profile):
+    """Selects the design components of every kit in mbed_app.json, and
+    hides the overridden system files of the custom design for ULP."""
+    ulp = profile == "ulp"
+    components = [SOURCE_DESIGN] + ([ULP_DESIGN] if ulp else [])
+    path = os.path.join(ROOT, "mbed_app.json")
+    with open(path) as f:
+        text = f.read()
+    text = re.sub(r'\[\s*"(?:CUSTOM|ULP)_DESIGN_MODUS"(?:,\s*"ULP_DESIGN_MODUS")?\s*\]',
+                  "[%s]" % ", ".join('"%s"' % c[len("COMPONENT_"):] for c in components),
+                  text)
+    with open(path, "w") as f:
+        f.write(text)
+
+    with open(MBEDIGNORE) as f:
+        lines = [line for line in f.read().splitlines() if line != IGNORE_OVERRIDDEN]
+    if ulp:
+        lines.append(IGNORE_OVERRIDDEN)
+    with open(MBEDIGNORE, "w") as f:
+        f.write("\n".join(lines) + "\n")
+    print("mbed_app.json: %s" % " + ".join(components))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--check", action="store_true",
+                        help="validate the designs instead of generating them")
+    parser.add_argument("--select", choices=("custom", "ulp"),
+                        help="select the design built for every kit")
+    args = parser.parse_args()
+    if args.check:
+        return check()
+    if args.select:
+        select(args.select)
+        return 0
+    generate()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
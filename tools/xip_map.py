@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+"""
+Reports where the code and data of a GCC_ARM build landed: in the QSPI
+memory executed in place (XIP), the internal flash or the SRAM.
+
+The report is read from the linker map file written by mbed compile, for
+example BUILD/<target>/GCC_ARM/<project>.map. Every input section is
+assigned the memory region of its address and the placement requested in
+the sources:
+
+    xip      .cy_xip, placed with APP_XIP (source/app_xip.h)
+    hot      .text.app_hot, placed with APP_HOT
+    ramfunc  .cy_ramfunc, the RAM functions of the PDL
+
+The map lists only the global symbols of each input section. Pass the ELF
+file with --elf to also attribute the static functions and data, this runs
+arm-none-eabi-nm.
+
+Errors are reported for hot or ramfunc code in the XIP region, ramfunc code
+outside the SRAM, XIP code outside the XIP region (the linker script has no
+.cy_xip output section), and for symbols matching a --hot expression in the
+XIP region. The exit status is 1 on errors, so the check can run after each
+build.
+
+Usage:
+    python tools/xip_map.py BUILD/<target>/GCC_ARM/<project>.map
+    python tools/xip_map.py <map> --elf <elf> --region xip
+    python tools/xip_map.py <map> --hot "Cy_SysPm_.*" --hot "whd_.*irq.*"
+"""
+
+import argparse
+import collections
+import os
+import re
+import subprocess
+import sys
+
+# PSoC 6 memory map, large enough for the devices of all kits.
+REGIONS = (
+    ("sram", 0x08000000, 0x08100000),
+    ("flash", 0x10000000, 0x10200000),
+    ("em_eeprom", 0x14000000, 0x14008000),
+    ("sflash", 0x16000000, 0x16008000),
+    ("xip", 0x18000000, 0x20000000),
+)
+
+# Input sections of the placement macros of source/app_xip.h.
+INTENTS = {".cy_xip": "xip", ".text.app_hot": "hot", ".cy_ramfunc": "ramfunc"}
+
+MAP_START = "Linker script and memory map"
+NAME_ONLY = re.compile(r"^ (\S+)\s*$")
+INPUT = re.compile(r"^ (\S+)?\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+SYMBOL = re.compile(r"^\s{16,}0x([0-9a-fA-F]+)\s+(\S.*)$")
+
+Section = collections.namedtuple("Section", "name addr size obj symbols")
+
+
+def region(addr):
+    for name, start, end in REGIONS:
+        if start <= addr < end:
+            return name
+    return "other"
+
+
+def intent(section):
+    for prefix, name in INTENTS.items():
+        if section.name == prefix or section.name.startswith(prefix + "."):
+            return name
+    return ""
+
+
+def parse_map(path):
+    """Returns the input sections of the memory map of a GNU ld map file."""
+    sections = []
+    pending = None
+    started = False
+    with open(path, errors="replace") as f:
+        for line in f:
+            line = line.rstrip("\n")
+            if not started:
+                started = line.startswith(MAP_START)
+                continue
+            m = INPUT.match(line)
+            if m and (m.group(1) or pending):
+                name = m.group(1) or pending
+                pending = None
+                size = int(m.group(3), 16)
+                if size and name != "*fill*":
+                    sections.append(Section(name, int(m.group(2), 16), size,
+                                            os.path.basename(m.group(4)), []))
+                continue
+            m = SYMBOL.match(line)
+            if m and "=" not in m.group(2) and sections:
+                addr = int(m.group(1), 16)
+                last = sections[-1]
+                if last.addr <= addr < last.addr + last.size:
+                    last.symbols.append(m.group(2).strip())
+                continue
+            m = NAME_ONLY.match(line)
+            pending = m.group(1) if m and not m.group(1).startswith("*(") else None
+    return sections
+
+
+def add_elf_symbols(sections, elf, nm):
+    """Attributes the symbols of the ELF file, including the static ones,
+    to the input sections containing them."""
+    out = subprocess.run([nm, "-C", "-S", "--defined-only", elf],
+                         check=True, stdout=subprocess.PIPE,
+                         universal_newlines=True).stdout
+    by_addr = sorted(sections, key=lambda s: s.addr)
+    starts = [s.addr for s in by_addr]
+    for line in out.splitlines():
+        fields = line.split(None, 3)
+        if len(fields) != 4 or fields[2].lower() not in "tdbr":
+            continue
+        addr = int(fields[0], 16) & ~1
+        lo, hi = 0, len(starts)
+        while lo < hi:
+            mid = (lo + hi) // 2
+            if starts[mid] <= addr:
+                lo = mid + 1
+            else:
+                hi = mid
+        if lo:
+            section = by_addr[lo - 1]
+            if addr < section.addr + section.size and fields[3] not in section.symbols:
+                section.symbols.append(fields[3])
+
+
+def check(sections, hot):
+    """Returns the placement errors and warnings."""
+    problems = []
+    for s in sections:
+        where, want = region(s.addr), intent(s)
+        label = "%s(%s)" % (s.obj, s.name)
+        if want in ("hot", "ramfunc") and where == "xip":
+            problems.append("error: %s code %s is in the XIP region" % (want, label))
+        if want == "ramfunc" and where != "sram":
+            problems.append("error: %s is in %s instead of the SRAM" % (label, where))
+        if want == "xip" and where != "xip":
+            problems.append("warning: %s is in %s, the linker script has no "
+                            ".cy_xip section" % (label, where))
+        if where == "xip":
+            for symbol in s.symbols:
+                if any(h.fullmatch(symbol) for h in hot):
+                    problems.append("error: hot symbol %s of %s is in the XIP region"
+                                    % (symbol, label))
+    return problems
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("map", help="linker map file of a GCC_ARM build")
+    parser.add_argument("--elf", help="ELF file, to attribute the static symbols")
+    parser.add_argument("--nm", default="arm-none-eabi-nm", help="nm of the toolchain")
+    parser.add_argument("--region", choices=[r[0] for r in REGIONS] + ["other"],
+                        help="only list the sections of this region")
+    parser.add_argument("--hot", action="append", default=[], metavar="REGEX",
+                        help="symbols which must not be in the XIP region")
+    parser.add_argument("--summary", action="store_true",
+                        help="only print the bytes of each object per region")
+    options = parser.parse_args()
+
+    sections = parse_map(options.map)
+    if not sections:
+        print("%s: no memory map found" % options.map)
+        return 1
+    if options.elf:
+        add_elf_symbols(sections, options.elf, options.nm)
+
+    if not options.summary:
+        print("%-10s %-10s %8s %-8s %s" % ("region", "address", "size", "intent", "section"))
+        for s in sections:
+            if options.region and region(s.addr) != options.region:
+                continue
+            print("%-10s 0x%08x %8d %-8s %s(%s)" % (region(s.addr), s.addr, s.size,
+                                                    intent(s), s.obj, s.name))
+            for symbol in s.symbols:
+                print("%41s %s" % ("", symbol))
+        print()
+
+    totals = collections.defaultdict(lambda: collections.Counter())
+    for s in sections:
+        totals[s.obj][region(s.addr)] += s.size
+    names = [r[0] for r in REGIONS if any(t[r[0]] for t in totals.values())]
+    print("%-32s %s" % ("bytes", " ".join("%10s" % n for n in names)))
+    for obj in sorted(totals):
+        print("%-32s %s" % (obj, " ".join("%10d" % totals[obj][n] for n in names)))
+    print("%-32s %s" % ("total", " ".join(
+        "%10d" % sum(t[n] for t in totals.values()) for n in names)))
+
+    problems = check(sections, [re.compile(h) for h in options.hot])
+    if problems:
+        print()
+    for problem in problems:
+        print(problem)
+    return 1 if any(p.startswith("error") for p in problems) else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())